@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+''"""
+Module: history_codec.py
+
+Decoder for the compressed history blocks a device publishes on
+SmartHome/<device_id>/history in reply to a get_history command.
+
+Block layout (little-endian header, MSB-first bit stream):
+
+    0   u8   magic 'H'
+    1   u8   version (1)
+    2   u8   flags, bit 0 = last block of the export
+    3   u8   reserved
+    4   u16  sequence number within the export
+    6   u16  sample count
+    8   u32  first timestamp (Unix seconds)
+    12  i16  first temperature (0.01 C)
+    14  u16  first humidity (0.01 %)
+    16  u16  first light (lux)
+    18  ...  columns for samples 1..count-1: timestamp delta-of-delta,
+             then temperature, humidity and light deltas
+
+Every column entry is a zig-zag mapped value written with a prefix code:
+'0' for zero, '10', '110', '1110' or '1111' followed by a payload of the
+class width (timestamps 7/9/12/32 bits, values 4/8/12/32 bits).
+
+Usage as a tool: history_codec.py BLOCK_FILE... prints the samples as CSV.
+"""''
+
+import struct
+import sys
+
+MAGIC = 0x48
+VERSION = 1
+HEADER = struct.Struct("<BBBBHHIhHH")
+FLAG_LAST = 0x01
+
+TS_CLASSES = (7, 9, 12, 32)
+VALUE_CLASSES = (4, 8, 12, 32)
+
+
+class HistoryBlockError(ValueError):
+    """Block is malformed or of an unknown version"""
+
+
+class HistoryBlock:
+    """One decoded block: sequence number, last flag and samples"""
+
+    def __init__(self, seq, last, samples):
+        self.seq = seq
+        self.last = last
+        self.samples = samples
+
+    def __repr__(self):
+        return f"HistoryBlock(seq={self.seq}, last={self.last}, samples={len(self.samples)})"
+
+
+class BitReader:
+    """MSB-first bit reader over a bytes object"""
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def bits(self, n):
+        value = 0
+        for _ in range(n):
+            byte = self.pos >> 3
+            if byte >= len(self.data):
+                raise HistoryBlockError("bit stream truncated")
+            value = (value << 1) | ((self.data[byte] >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return value
+
+    def code(self, classes):
+        """Read one prefix coded, zig-zag mapped value"""
+        prefix = 0
+        while prefix < 4 and self.bits(1):
+            prefix += 1
+        if prefix == 0:
+            return 0
+        zz = self.bits(classes[prefix - 1])
+        return (zz >> 1) ^ -(zz & 1)
+
+
+def decode_block(payload):
+    """Decode one block into a HistoryBlock
+
+    Samples are dicts with timestamp (int seconds), temperature and
+    humidity (float) and light (int), as in the /data message.
+    """
+    if len(payload) < HEADER.size:
+        raise HistoryBlockError("block shorter than header")
+
+    magic, version, flags, _, seq, count, t0, temp0, hum0, light0 = HEADER.unpack_from(payload)
+    if magic != MAGIC:
+        raise HistoryBlockError(f"bad magic 0x{magic:02x}")
+    if version != VERSION:
+        raise HistoryBlockError(f"unsupported version {version}")
+    if count == 0:
+        raise HistoryBlockError("empty block")
+
+    reader = BitReader(payload[HEADER.size:])
+    n = count - 1
+
+    # Timestamps: deltas wrap modulo 2^32 like on the device
+    timestamps = [t0]
+    delta = 0
+    for _ in range(n):
+        delta = (delta + reader.code(TS_CLASSES)) & 0xFFFFFFFF
+        timestamps.append((timestamps[-1] + delta) & 0xFFFFFFFF)
+
+    columns = []
+    for first in (temp0, hum0, light0):
+        values = [first]
+        for _ in range(n):
+            values.append(values[-1] + reader.code(VALUE_CLASSES))
+        columns.append(values)
+
+    samples = [
+        {
+            "timestamp": timestamps[i],
+            "temperature": columns[0][i] / 100.0,
+            "humidity": columns[1][i] / 100.0,
+            "light": columns[2][i],
+        }
+        for i in range(count)
+    ]
+    return HistoryBlock(seq, bool(flags & FLAG_LAST), samples)
+
+
+class HistoryAssembler:
+    """Collects the blocks of one export per device
+
+    Blocks are published with QoS 0 and may be lost. add() returns the
+    finished export once the last block has arrived; missing sequence
+    numbers are reported so the caller can request the gap again with a
+    narrower get_history range.
+    """
+
+    def __init__(self):
+        self.exports = {}
+
+    def add(self, device_id, block):
+        """Add a block. Returns (samples, missing_seqs) when the export is complete, else None."""
+        if block.seq == 0:
+            self.exports[device_id] = {}
+        blocks = self.exports.setdefault(device_id, {})
+        blocks[block.seq] = block
+
+        if not block.last:
+            return None
+
+        del self.exports[device_id]
+        missing = [seq for seq in range(block.seq + 1) if seq not in blocks]
+        samples = [s for seq in sorted(blocks) for s in blocks[seq].samples]
+        return samples, missing
+
+
+def main(paths):
+    print("timestamp,temperature,humidity,light")
+    for path in paths:
+        with open(path, "rb") as f:
+            block = decode_block(f.read())
+        for s in block.samples:
+            print(f"{s['timestamp']},{s['temperature']:.2f},{s['humidity']:.2f},{s['light']}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(f"usage: {sys.argv[0]} BLOCK_FILE...", file=sys.stderr)
+        sys.exit(2)
+    main(sys.argv[1:])
@@ -1,15 +1,28 @@
 #!/usr/bin/env python3
 ''"""
 Script: mqtt_to_db.py
+
+MQTT messages are parsed on the paho thread and queued; a writer thread
+drains the queue and writes batches in one transaction each, flushed when
+BATCH_MAX_ROWS rows are pending or FLUSH_INTERVAL_S has passed. Only lost
+connections retry a batch; a batch the server rejects is written row by
+row so one bad row does not take the others with it.
+
+Compressed history blocks from get_history exports are decoded with
+history_codec and queued as sensor data rows.
 """''
 
 import paho.mqtt.client as mqtt
 from paho.mqtt.client import CallbackAPIVersion
 import mysql.connector
 import json
+import queue
+import threading
 import time
 import sys
 
+from history_codec import HistoryAssembler, HistoryBlockError, decode_block
+
 # Configuration
 
 # MQTT Broker
@@ -25,9 +38,56 @@ DB_CONFIG = {
     'user': 'SmartHome',
     'password': 'SmartHome01',
     'database': 'SMARTHOME',
-    'autocommit': True
+    'autocommit': False
 }
 
+# Batching
+QUEUE_MAX = 20000         # Messages buffered between receive and write
+BATCH_MAX_ROWS = 500      # Flush when this many messages are pending
+FLUSH_INTERVAL_S = 1.0    # Flush at least this often when not empty
+INSERT_CHUNK_ROWS = 100   # Rows per prepared multi-row INSERT
+FLUSH_MAX_ATTEMPTS = 5    # Connection attempts per batch before it is dropped
+STATS_INTERVAL_S = 30     # Throughput/lag report period
+VERBOSE = False           # Print every received message
+
+MESSAGE_TYPES = ("info", "data", "state", "command", "response")
+
+# Errors that a reconnect can fix; anything else is about the data
+CONNECTION_ERRORS = (mysql.connector.errors.InterfaceError, mysql.connector.errors.OperationalError)
+
+# SQL
+
+SQL_DEVICE_INFO = """
+INSERT INTO devices (device_id, ssid, ip_address, broker, firmware)
+VALUES (%s, %s, %s, %s, %s)
+ON DUPLICATE KEY UPDATE
+    ssid = VALUES(ssid),
+    ip_address = VALUES(ip_address),
+    broker = VALUES(broker),
+    firmware = VALUES(firmware),
+    last_update = CURRENT_TIMESTAMP
+"""
+
+SQL_SENSOR_DATA = "INSERT INTO sensor_data (device_id, temperature, humidity, light, timestamp) VALUES "
+SQL_SENSOR_ROW = "(%s, %s, %s, %s, %s)"
+
+SQL_DEVICE_STATE = ("INSERT INTO device_states "
+                    "(device_id, mode, fan_status, light_status, ac_status, interval_value, timestamp) VALUES ")
+SQL_DEVICE_STATE_ROW = "(%s, %s, %s, %s, %s, %s, %s)"
+
+SQL_COMMAND = """
+INSERT INTO commands (device_id, cmd_id, command, params)
+VALUES (%s, %s, %s, %s)
+"""
+
+SQL_COMMAND_RESPONSE = """
+UPDATE commands
+SET status = %s
+WHERE device_id = %s AND cmd_id = %s
+ORDER BY created_at DESC
+LIMIT 1
+"""
+
 # DATABASE FUNCTIONS
 
 def connect_db():
@@ -39,125 +99,295 @@ def connect_db():
         print(f"Database connection error: {err}")
         return None
 
-def save_device_info(conn, device_id, info):
-    """Save/update device information"""
-    try:
-        cursor = conn.cursor()
-        query = """
-        INSERT INTO devices (device_id, ssid, ip_address, broker, firmware)
-        VALUES (%s, %s, %s, %s, %s)
-        ON DUPLICATE KEY UPDATE 
-            ssid = VALUES(ssid),
-            ip_address = VALUES(ip_address),
-            broker = VALUES(broker),
-            firmware = VALUES(firmware),
-            last_update = CURRENT_TIMESTAMP
-        """
-        cursor.execute(query, (
-            device_id,
-            info.get('ssid'),
-            info.get('ip'),
-            info.get('broker'),
-            info.get('firmware')
-        ))
-        cursor.close()
-        print(f"Updated device information: {device_id}")
-        return True
-    except Exception as e:
-        print(f"Error in save_device_info: {e}")
-        return False
+def device_info_row(device_id, info):
+    """Row for SQL_DEVICE_INFO"""
+    return (device_id, info.get('ssid'), info.get('ip'), info.get('broker'), info.get('firmware'))
 
-def save_sensor_data(conn, device_id, data):
-    """Save sensor data"""
-    try:
-        cursor = conn.cursor()
-        query = """
-        INSERT INTO sensor_data (device_id, temperature, humidity, light, timestamp) 
-        VALUES (%s, %s, %s, %s, %s)
-        """
-        cursor.execute(query, (
-            device_id,
-            data.get('temperature'),
-            data.get('humidity'),
-            data.get('light'),
-            data.get('timestamp')
-        ))
-        cursor.close()
-        print(f"Saved sensor_data: Temp={data.get('temperature')}°C, Humid={data.get('humidity')}%, Light={data.get('light')}")
-        return True
-    except Exception as e:
-        print(f"Error in save_sensor_data: {e}")
-        return False
+def sensor_data_row(device_id, data):
+    """Row for SQL_SENSOR_DATA"""
+    return (device_id, data.get('temperature'), data.get('humidity'), data.get('light'), data.get('timestamp'))
 
-def save_device_state(conn, device_id, state):
-    """Save device state"""
-    try:
-        cursor = conn.cursor()
-        query = """
-        INSERT INTO device_states 
-        (device_id, mode, fan_status, light_status, ac_status, interval_value, timestamp) 
-        VALUES (%s, %s, %s, %s, %s, %s, %s)
-        """
-        cursor.execute(query, (
-            device_id,
-            state.get('mode'),
-            state.get('fan'),
-            state.get('light'),
-            state.get('ac'),
-            state.get('interval'),
-            state.get('timestamp')
-        ))
-        cursor.close()
-        print(f"Saved device_states: Mode={state.get('mode')}, Fan={state.get('fan')}, Light={state.get('light')}, AC={state.get('ac')}")
-        return True
-    except Exception as e:
-        print(f"Error in save_device_state: {e}")
-        return False
+def device_state_row(device_id, state):
+    """Row for SQL_DEVICE_STATE"""
+    return (device_id, state.get('mode'), state.get('fan'), state.get('light'),
+            state.get('ac'), state.get('interval'), state.get('timestamp'))
 
-def save_command(conn, device_id, cmd):
-    """Save command"""
-    try:
-        cursor = conn.cursor()
-        query = """
-        INSERT INTO commands (device_id, cmd_id, command, params)
-        VALUES (%s, %s, %s, %s)
-        """
-        params_str = json.dumps(cmd.get('params', {}))
-        cursor.execute(query, (
-            device_id,
-            cmd.get('id'),
-            cmd.get('command'),
-            params_str
-        ))
-        cursor.close()
-        print(f"Saved command: {cmd.get('command')}")
-        return True
-    except Exception as e:
-        print(f"Error in save_command: {e}")
-        return False
+def command_row(device_id, cmd):
+    """Row for SQL_COMMAND"""
+    return (device_id, cmd.get('id'), cmd.get('command'), json.dumps(cmd.get('params', {})))
 
-def update_command_response(conn, device_id, response):
-    """Update command execution result"""
-    try:
-        cursor = conn.cursor()
-        query = """
-        UPDATE commands 
-        SET status = %s 
-        WHERE device_id = %s AND cmd_id = %s
-        ORDER BY created_at DESC
-        LIMIT 1
-        """
-        cursor.execute(query, (
-            response.get('status'),
-            device_id,
-            response.get('cmd_id')
-        ))
-        cursor.close()
-        print(f"Updated command response: {response.get('cmd_id')} → {response.get('status')}")
+def command_response_row(device_id, response):
+    """Row for SQL_COMMAND_RESPONSE"""
+    return (response.get('status'), device_id, response.get('cmd_id'))
+
+ROW_BUILDERS = {
+    "info": device_info_row,
+    "data": sensor_data_row,
+    "state": device_state_row,
+    "command": command_row,
+    "response": command_response_row,
+}
+
+# BATCH WRITER
+
+class BatchWriter:
+    """Drains the message queue and writes batches in transactions.
+
+    Statements are executed through prepared cursors kept for the lifetime
+    of the connection, one per statement shape, so the server parses each
+    shape once. Sensor data and states go out as multi-row INSERTs of
+    INSERT_CHUNK_ROWS rows; device info and command responses are collapsed
+    to the latest value per key within a batch.
+
+    Messages whose fields do not fit a row are skipped when the batch is
+    built. Connection errors reconnect and retry the batch; any other
+    database error rolls it back and writes each row in its own
+    transaction, dropping only the rows the server rejects.
+    """
+
+    def __init__(self, msg_queue):
+        self.queue = msg_queue
+        self.conn = None
+        self.cursors = {}
+        self.running = True
+        self.thread = threading.Thread(target=self.run, name="db-writer", daemon=True)
+
+        self.lock = threading.Lock()
+        self.received = 0
+        self.dropped = 0
+        self.reset_stats()
+
+    def reset_stats(self):
+        """Reset per-interval metrics"""
+        self.stats_start = time.monotonic()
+        self.rows_written = 0
+        self.flushes = 0
+        self.flush_time = 0.0
+        self.lag_sum = 0.0
+        self.lag_max = 0.0
+        self.failed_batches = 0
+        self.malformed = 0
+        self.rejected = 0
+
+    def start(self):
+        self.thread.start()
+
+    def stop(self):
+        """Flush what is queued and stop the writer thread"""
+        self.running = False
+        self.thread.join()
+
+    def submit(self, message_type, device_id, data):
+        """Queue a parsed message (paho thread). Drops it when the queue is full."""
+        with self.lock:
+            self.received += 1
+        try:
+            self.queue.put_nowait((time.monotonic(), message_type, device_id, data))
+        except queue.Full:
+            with self.lock:
+                self.dropped += 1
+
+    def cursor(self, sql):
+        """Prepared cursor for a statement, created on first use"""
+        cur = self.cursors.get(sql)
+        if cur is None:
+            cur = self.conn.cursor(prepared=True)
+            self.cursors[sql] = cur
+        return cur
+
+    def ensure_connection(self):
+        if self.conn is not None and self.conn.is_connected():
+            return True
+        self.close_connection()
+        self.conn = connect_db()
+        return self.conn is not None
+
+    def close_connection(self):
+        for cur in self.cursors.values():
+            try:
+                cur.close()
+            except Exception:
+                pass
+        self.cursors.clear()
+        if self.conn is not None:
+            try:
+                self.conn.close()
+            except Exception:
+                pass
+        self.conn = None
+
+    def insert_rows(self, head, row_sql, rows):
+        """Multi-row INSERT in chunks; full chunks share one prepared statement"""
+        for i in range(0, len(rows), INSERT_CHUNK_ROWS):
+            chunk = rows[i:i + INSERT_CHUNK_ROWS]
+            sql = head + ", ".join([row_sql] * len(chunk))
+            params = [value for row in chunk for value in row]
+            self.cursor(sql).execute(sql, params)
+
+    def build_rows(self, batch):
+        """Turn queued messages into rows, skipping those that do not fit"""
+        rows = []
+        for received_at, message_type, device_id, data in batch:
+            try:
+                row = ROW_BUILDERS[message_type](device_id, data)
+            except (AttributeError, TypeError, ValueError) as err:
+                print(f"Skipping malformed {message_type} from {device_id}: {err}")
+                self.malformed += 1
+                continue
+            rows.append((received_at, message_type, device_id, row))
+        return rows
+
+    def write_batch(self, rows):
+        """Write built rows in a single transaction"""
+        info = {}
+        sensor_rows = []
+        state_rows = []
+        command_rows = []
+        responses = {}
+
+        for _, message_type, device_id, row in rows:
+            if message_type == "info":
+                info[device_id] = row
+            elif message_type == "data":
+                sensor_rows.append(row)
+            elif message_type == "state":
+                state_rows.append(row)
+            elif message_type == "command":
+                command_rows.append(row)
+            else:
+                responses[(device_id, row[2])] = row
+
+        for row in info.values():
+            self.cursor(SQL_DEVICE_INFO).execute(SQL_DEVICE_INFO, row)
+        for row in command_rows:
+            self.cursor(SQL_COMMAND).execute(SQL_COMMAND, row)
+        if sensor_rows:
+            self.insert_rows(SQL_SENSOR_DATA, SQL_SENSOR_ROW, sensor_rows)
+        if state_rows:
+            self.insert_rows(SQL_DEVICE_STATE, SQL_DEVICE_STATE_ROW, state_rows)
+        # After commands, so a response in the same batch finds its row
+        for row in responses.values():
+            self.cursor(SQL_COMMAND_RESPONSE).execute(SQL_COMMAND_RESPONSE, row)
+
+        self.conn.commit()
+
+    def rollback(self):
+        try:
+            self.conn.rollback()
+        except Exception:
+            pass
+
+    def write_each(self, pending, written):
+        """Write rows in their own transactions, moving each from pending to
+        written, or dropping it when rejected. Connection errors propagate."""
+        while pending:
+            try:
+                self.write_batch(pending[:1])
+                written.append(pending[0])
+            except CONNECTION_ERRORS:
+                raise
+            except mysql.connector.Error as err:
+                self.rollback()
+                _, message_type, device_id, _ = pending[0]
+                print(f"Rejected {message_type} from {device_id}: {err}")
+                self.rejected += 1
+            del pending[0]
+
+    def flush(self, batch):
+        """Write a batch, reconnecting on connection loss. Returns False if dropped."""
+        pending = self.build_rows(batch)
+        written = []
+        start = time.monotonic()
+
+        for attempt in range(FLUSH_MAX_ATTEMPTS):
+            if not pending:
+                break
+            if not self.ensure_connection():
+                time.sleep(min(2 ** attempt, 10))
+                continue
+
+            try:
+                try:
+                    self.write_batch(pending)
+                    written.extend(pending)
+                    pending = []
+                except CONNECTION_ERRORS:
+                    raise
+                except mysql.connector.Error as err:
+                    print(f"Batch of {len(pending)} rejected: {err}, writing rows one by one")
+                    self.rollback()
+                    self.write_each(pending, written)
+            except CONNECTION_ERRORS as err:
+                print(f"Batch of {len(pending)} failed (attempt {attempt + 1}): {err}")
+                self.rollback()
+                self.close_connection()
+                time.sleep(min(2 ** attempt, 10))
+
+        done = time.monotonic()
+        self.flushes += 1
+        self.rows_written += len(written)
+        self.flush_time += done - start
+        for received_at, *_ in written:
+            lag = done - received_at
+            self.lag_sum += lag
+            self.lag_max = max(self.lag_max, lag)
+
+        if pending:
+            print(f"Dropping {len(pending)} rows after {FLUSH_MAX_ATTEMPTS} attempts")
+            self.failed_batches += 1
+            return False
         return True
-    except Exception as e:
-        print(f"Error in update_command_response: {e}")
-        return False
+
+    def report(self):
+        """Print throughput and lag for the last interval"""
+        elapsed = time.monotonic() - self.stats_start
+        with self.lock:
+            received, dropped = self.received, self.dropped
+            self.received = 0
+            self.dropped = 0
+
+        rows = self.rows_written
+        print(f"[stats] recv {received / elapsed:.1f} msg/s, "
+              f"written {rows / elapsed:.1f} rows/s in {self.flushes} flushes "
+              f"(avg {rows / self.flushes if self.flushes else 0:.0f} rows, "
+              f"{1000 * self.flush_time / self.flushes if self.flushes else 0:.1f} ms), "
+              f"lag avg {1000 * self.lag_sum / rows if rows else 0:.0f} ms max {1000 * self.lag_max:.0f} ms, "
+              f"queue {self.queue.qsize()}, dropped {dropped}, failed batches {self.failed_batches}, "
+              f"malformed {self.malformed}, rejected {self.rejected}")
+        self.reset_stats()
+
+    def run(self):
+        """Writer thread: collect until size or time threshold, then flush"""
+        batch = []
+        deadline = time.monotonic() + FLUSH_INTERVAL_S
+        next_report = time.monotonic() + STATS_INTERVAL_S
+
+        while self.running or not self.queue.empty() or batch:
+            timeout = max(0.0, deadline - time.monotonic())
+            try:
+                batch.append(self.queue.get(timeout=timeout))
+                # Take what is already queued without waiting
+                while len(batch) < BATCH_MAX_ROWS:
+                    batch.append(self.queue.get_nowait())
+            except queue.Empty:
+                pass
+
+            now = time.monotonic()
+            if batch and (len(batch) >= BATCH_MAX_ROWS or now >= deadline or not self.running):
+                self.flush(batch)
+                batch = []
+            if now >= deadline:
+                deadline = now + FLUSH_INTERVAL_S
+
+            if now >= next_report:
+                self.report()
+                next_report = now + STATS_INTERVAL_S
+
+        self.report()
+        self.close_connection()
+
+writer = None
+history = HistoryAssembler()
 
 # MQTT CALLBACKS
 
@@ -176,74 +406,60 @@ def on_connect(client, userdata, flags, rc, properties=None):
         sys.exit(1)
 
 def on_message(client, userdata, msg):
-    """Callback when receiving message from MQTT"""
+    """Callback when receiving message from MQTT. Only parses and queues."""
     topic = msg.topic
-    payload = msg.payload.decode('utf-8')
-    
-    # Display message information
-    timestamp = time.strftime("%Y-%m-%d %H:%M:%S")
-    print(f"\n[{timestamp}] Received new message:")
-    print(f"  Topic: {topic}")
-    print(f"  Payload: {payload[:150]}{'...' if len(payload) > 150 else ''}")
-    
-    try:
-        # Parse JSON
-        data = json.loads(payload)
-        
-        # Extract device_id and message_type from topic
-        # Example: SmartHome/esp_02/data → device_id = esp_02, message_type = data
-        parts = topic.split('/')
-        if len(parts) < 3:
-            print(f"Invalid topic, skipping")
-            return
-        
-        device_id = parts[1]
-        message_type = parts[2]
-        
-        print(f"  Device: {device_id}")
-        print(f"  Type: {message_type}")
-        
-        # Connect to database
-        db = connect_db()
-        if not db:
-            print(f"Cannot connect to database")
-            return
-        
-        # Process based on message type
-        success = False
-        
-        if message_type == "info":
-            success = save_device_info(db, device_id, data)
-        
-        elif message_type == "data":
-            success = save_sensor_data(db, device_id, data)
-        
-        elif message_type == "state":
-            success = save_device_state(db, device_id, data)
-        
-        elif message_type == "command":
-            success = save_command(db, device_id, data)
-        
-        elif message_type == "response":
-            success = update_command_response(db, device_id, data)
-        
-        else:
+
+    # Example: SmartHome/esp_02/data → device_id = esp_02, message_type = data
+    parts = topic.split('/')
+    if len(parts) < 3:
+        if VERBOSE:
+            print(f"Invalid topic {topic}, skipping")
+        return
+
+    device_id = parts[1]
+    message_type = parts[2]
+    if message_type == "history":
+        on_history(device_id, msg.payload)
+        return
+    if message_type not in MESSAGE_TYPES:
+        if VERBOSE:
             print(f"Unknown message type: {message_type}")
-        
-        # Close database connection
-        db.close()
-        
-        if success:
-            print(f"Processing successful!")
-        
-    except json.JSONDecodeError:
-        print(f"Payload is not valid JSON")
-    except Exception as e:
-        print(f"Error processing message: {e}")
-        import traceback
-        traceback.print_exc()
+        return
+
+    try:
+        data = json.loads(msg.payload)
+    except (json.JSONDecodeError, UnicodeDecodeError):
+        print(f"Payload on {topic} is not valid JSON")
+        return
+
+    # Row builders read fields by name, a list or number has none
+    if not isinstance(data, dict):
+        print(f"Payload on {topic} is not a JSON object")
+        return
+
+    if VERBOSE:
+        print(f"[{time.strftime('%Y-%m-%d %H:%M:%S')}] {topic}: {msg.payload[:150]!r}")
+
+    writer.submit(message_type, device_id, data)
+
+def on_history(device_id, payload):
+    """Decode a get_history block and queue its samples as sensor data"""
+    try:
+        block = decode_block(payload)
+    except HistoryBlockError as err:
+        print(f"Bad history block from {device_id}: {err}")
+        return
+
+    for sample in block.samples:
+        writer.submit("data", device_id, sample)
+
+    done = history.add(device_id, block)
+    if done is not None:
+        samples, missing = done
+        print(f"History export from {device_id}: {len(samples)} samples in {block.seq + 1} blocks"
+              + (f", missing blocks {missing}" if missing else ""))
 
-def on_disconnect(client, userdata, rc, properties=None):
+def on_disconnect(client, userdata, flags, rc, properties=None):
     """Callback when MQTT connection is lost"""
     if rc != 0:
         print(f"\nMQTT connection lost! Trying to reconnect...")
@@ -252,14 +468,17 @@ def on_disconnect(client, userdata, rc, properties=None):
 
 def main():
     """Main function"""
+    global writer
+
     print("=" * 60)
     print("SMART HOME - MQTT TO DATABASE LOGGER")
     print("=" * 60)
     print(f"MQTT Broker: {MQTT_BROKER}:{MQTT_PORT}")
     print(f"Database: {DB_CONFIG['database']}@{DB_CONFIG['host']}")
     print(f"Subscribed Topic: {MQTT_TOPIC}")
+    print(f"Batching: {BATCH_MAX_ROWS} rows / {FLUSH_INTERVAL_S}s, queue {QUEUE_MAX}")
     print("=" * 60)
-    
+
     # Check database connection
     print("\nChecking database connection...")
     db = connect_db()
@@ -269,28 +488,34 @@ def main():
     else:
         print("Cannot connect to database. Check configuration!")
         sys.exit(1)
-    
+
+    writer = BatchWriter(queue.Queue(maxsize=QUEUE_MAX))
+    writer.start()
+
     # Initialize MQTT client
     client = mqtt.Client(CallbackAPIVersion.VERSION2)
     client.username_pw_set(MQTT_USERNAME, MQTT_PASSWORD)
     client.on_connect = on_connect
     client.on_message = on_message
     client.on_disconnect = on_disconnect
-    
+
     # Connect to MQTT
     try:
         print("\nConnecting to MQTT Broker...")
         client.connect(MQTT_BROKER, MQTT_PORT, 60)
         client.loop_forever()
-    
+
     except KeyboardInterrupt:
         print("\n\nUser stopped the program (Ctrl+C)")
         client.disconnect()
+        print("Flushing queued messages...")
+        writer.stop()
         print("Goodbye!")
-    
+
     except Exception as e:
         print(f"\nError: {e}")
+        writer.stop()
         sys.exit(1)
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
@@ -0,0 +1,569 @@
+/**
+ * @file app_executor.c
+ *
+ * @brief Application Executor Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "app_executor.h"
+#include "task_registry.h"
+#include "jitter_probe.h"
+#include "loop_monitor.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_task_wdt.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define EXECUTOR_MAX_IDLE_MS 1000 //!< Upper bound on one wait, keeps the task watchdog fed
+#define EXECUTOR_MAX_REPORTS 4    //!< Report callback slots
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Work item carried by the executor queue
+ */
+typedef struct
+{
+    app_executor_handler_t handler; //!< Handler to run, NULL only wakes the loop
+    void *arg;                      //!< Handler argument
+} app_executor_item_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "APP_EXECUTOR";
+
+static QueueHandle_t work_queue = NULL;
+static TaskHandle_t executor_task_handle = NULL;
+
+static StaticQueue_t work_queue_buffer;
+static uint8_t work_queue_storage[APP_EXECUTOR_QUEUE_LENGTH * sizeof(app_executor_item_t)];
+TASK_REGISTRY_STORAGE(executor, TASK_STACK_APP_EXECUTOR);
+
+// Guards the timer list and stats.dropped, which ISRs update too
+static portMUX_TYPE timer_lock = portMUX_INITIALIZER_UNLOCKED;
+static app_executor_timer_t *timer_list = NULL;
+
+static app_executor_stats_t stats = {0};
+
+static app_executor_timer_t report_timer;
+static uint32_t report_last_wakeups = 0;
+static app_executor_report_t report_callbacks[EXECUTOR_MAX_REPORTS];
+static size_t report_count = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Executor task main loop
+ *
+ * @param[in] pvParameters Unused
+ */
+static void app_executor_task(void *pvParameters);
+
+/**
+ * @brief Compute how long the loop may block before the next timer expiry
+ *
+ * @return Ticks to wait on the work queue
+ */
+static TickType_t app_executor_next_wait(void);
+
+/**
+ * @brief Run every timer whose expiry has passed
+ */
+static void app_executor_run_due_timers(void);
+
+/**
+ * @brief Run one handler and account its execution time
+ *
+ * @param[in] handler Handler to run
+ * @param[in] arg Handler argument
+ */
+static void app_executor_run(app_executor_handler_t handler, void *arg);
+
+/**
+ * @brief Wake the executor so it recomputes its next deadline
+ */
+static void app_executor_wake(void);
+
+/**
+ * @brief Periodic resource report handler
+ *
+ * @param[in] arg Unused
+ */
+static void app_executor_report(void *arg);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Create the executor queue and task
+ */
+esp_err_t app_executor_init(void)
+{
+    if (executor_task_handle != NULL)
+    {
+        ESP_LOGW(TAG, "Executor already initialized");
+        return ESP_OK;
+    }
+
+    work_queue = xQueueCreateStatic(APP_EXECUTOR_QUEUE_LENGTH, sizeof(app_executor_item_t),
+                                    work_queue_storage, &work_queue_buffer);
+    if (work_queue == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create work queue");
+        return ESP_FAIL;
+    }
+
+    // Core and priority come from the task placement table
+    esp_err_t ret = task_registry_create_static(
+        TASK_ID_APP_EXECUTOR,
+        app_executor_task,
+        NULL,
+        executor_stack,
+        &executor_tcb,
+        &executor_task_handle);
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to create executor task");
+        vQueueDelete(work_queue);
+        work_queue = NULL;
+        executor_task_handle = NULL;
+        return ESP_FAIL;
+    }
+
+    if (APP_EXECUTOR_REPORT_INTERVAL_S > 0)
+    {
+        app_executor_timer_init(&report_timer, "report", app_executor_report, NULL);
+        app_executor_timer_start(&report_timer,
+                                 APP_EXECUTOR_REPORT_INTERVAL_S * 1000,
+                                 APP_EXECUTOR_REPORT_INTERVAL_S * 1000);
+    }
+
+    ESP_LOGI(TAG, "Executor started (free internal heap=%u, tasks=%u)",
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)uxTaskGetNumberOfTasks());
+    return ESP_OK;
+}
+
+/**
+ * @brief Queue a handler to run on the executor task
+ */
+esp_err_t app_executor_post(app_executor_handler_t handler, void *arg)
+{
+    if (work_queue == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    app_executor_item_t item = {
+        .handler = handler,
+        .arg = arg};
+
+    if (xQueueSend(work_queue, &item, 0) != pdTRUE)
+    {
+        portENTER_CRITICAL(&timer_lock);
+        stats.dropped++;
+        portEXIT_CRITICAL(&timer_lock);
+        ESP_LOGW(TAG, "Work queue full, item dropped");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Queue a handler to run on the executor task from an ISR
+ */
+esp_err_t app_executor_post_from_isr(app_executor_handler_t handler, void *arg)
+{
+    if (work_queue == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    app_executor_item_t item = {
+        .handler = handler,
+        .arg = arg};
+    BaseType_t higher_priority_woken = pdFALSE;
+
+    if (xQueueSendFromISR(work_queue, &item, &higher_priority_woken) != pdTRUE)
+    {
+        // Shared with task-side posts, the increment is not atomic on its own
+        portENTER_CRITICAL_ISR(&timer_lock);
+        stats.dropped++;
+        portEXIT_CRITICAL_ISR(&timer_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (higher_priority_woken == pdTRUE)
+    {
+        portYIELD_FROM_ISR();
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Register a software timer with the executor
+ */
+esp_err_t app_executor_timer_init(app_executor_timer_t *timer, const char *name,
+                                  app_executor_handler_t handler, void *arg)
+{
+    if (timer == NULL || handler == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&timer_lock);
+
+    // Re-initializing a registered timer only refreshes its handler
+    bool registered = false;
+    for (app_executor_timer_t *t = timer_list; t != NULL; t = t->next)
+    {
+        if (t == timer)
+        {
+            registered = true;
+            break;
+        }
+    }
+
+    timer->name = name;
+    timer->handler = handler;
+    timer->arg = arg;
+    timer->period_ms = 0;
+    timer->expiry_us = 0;
+    timer->active = false;
+    timer->monitor = LOOP_MONITOR_MAX;
+
+    if (!registered)
+    {
+        timer->next = timer_list;
+        timer_list = timer;
+    }
+
+    portEXIT_CRITICAL(&timer_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Arm (or re-arm) a timer
+ */
+esp_err_t app_executor_timer_start(app_executor_timer_t *timer, uint32_t delay_ms, uint32_t period_ms)
+{
+    if (timer == NULL || timer->handler == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t expiry = esp_timer_get_time() + (int64_t)delay_ms * 1000;
+
+    portENTER_CRITICAL(&timer_lock);
+    timer->period_ms = period_ms;
+    timer->expiry_us = expiry;
+    timer->active = true;
+    portEXIT_CRITICAL(&timer_lock);
+
+    // A new schedule, the gap since the last expiry is not lateness
+    loop_monitor_restart(timer->monitor);
+
+    // The loop may be blocked on a later deadline
+    app_executor_wake();
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Disarm a timer
+ */
+esp_err_t app_executor_timer_stop(app_executor_timer_t *timer)
+{
+    if (timer == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&timer_lock);
+    timer->active = false;
+    portEXIT_CRITICAL(&timer_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Report the lateness of a periodic timer to the loop monitor
+ */
+esp_err_t app_executor_timer_monitor(app_executor_timer_t *timer, loop_monitor_id_t id)
+{
+    if (timer == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&timer_lock);
+    timer->monitor = id;
+    portEXIT_CRITICAL(&timer_lock);
+
+    loop_monitor_restart(id);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Check if a timer is armed
+ */
+bool app_executor_timer_is_active(const app_executor_timer_t *timer)
+{
+    return (timer != NULL) && timer->active;
+}
+
+/**
+ * @brief Check if the caller runs on the executor task
+ */
+bool app_executor_in_context(void)
+{
+    return (executor_task_handle != NULL) &&
+           (xTaskGetCurrentTaskHandle() == executor_task_handle);
+}
+
+/**
+ * @brief Add a callback to the periodic resource report
+ */
+esp_err_t app_executor_register_report(app_executor_report_t report)
+{
+    if (report == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+
+    portENTER_CRITICAL(&timer_lock);
+    if (report_count < EXECUTOR_MAX_REPORTS)
+    {
+        report_callbacks[report_count++] = report;
+    }
+    else
+    {
+        ret = ESP_ERR_NO_MEM;
+    }
+    portEXIT_CRITICAL(&timer_lock);
+
+    return ret;
+}
+
+/**
+ * @brief Get executor runtime statistics
+ */
+esp_err_t app_executor_get_stats(app_executor_stats_t *out)
+{
+    if (out == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (executor_task_handle == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&timer_lock);
+    *out = stats;
+    portEXIT_CRITICAL(&timer_lock);
+    out->stack_free = uxTaskGetStackHighWaterMark(executor_task_handle);
+
+    return ESP_OK;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Executor task main loop
+ */
+static void app_executor_task(void *pvParameters)
+{
+    app_executor_item_t item;
+
+    // Buttons are scanned from here, so the executor inherits their watchdog
+    esp_task_wdt_add(NULL);
+
+    ESP_LOGI(TAG, "Executor task started");
+
+    while (1)
+    {
+        if (xQueueReceive(work_queue, &item, app_executor_next_wait()) == pdTRUE)
+        {
+            do
+            {
+                if (item.handler != NULL)
+                {
+                    stats.work_items++;
+                    app_executor_run(item.handler, item.arg);
+                }
+            } while (xQueueReceive(work_queue, &item, 0) == pdTRUE);
+        }
+
+        stats.wakeups++;
+
+        app_executor_run_due_timers();
+
+        esp_task_wdt_reset();
+    }
+}
+
+/**
+ * @brief Compute how long the loop may block before the next timer expiry
+ */
+static TickType_t app_executor_next_wait(void)
+{
+    int64_t now = esp_timer_get_time();
+    int64_t wait_us = (int64_t)EXECUTOR_MAX_IDLE_MS * 1000;
+
+    portENTER_CRITICAL(&timer_lock);
+    for (app_executor_timer_t *t = timer_list; t != NULL; t = t->next)
+    {
+        if (t->active && (t->expiry_us - now) < wait_us)
+        {
+            wait_us = t->expiry_us - now;
+        }
+    }
+    portEXIT_CRITICAL(&timer_lock);
+
+    if (wait_us <= 0)
+    {
+        return 0;
+    }
+
+    // Round up so a timer is never served one tick early
+    const int64_t tick_us = (int64_t)portTICK_PERIOD_MS * 1000;
+    return (TickType_t)((wait_us + tick_us - 1) / tick_us);
+}
+
+/**
+ * @brief Run every timer whose expiry has passed
+ */
+static void app_executor_run_due_timers(void)
+{
+    while (1)
+    {
+        int64_t now = esp_timer_get_time();
+        app_executor_timer_t *due = NULL;
+        uint32_t period_ms = 0;
+
+        portENTER_CRITICAL(&timer_lock);
+        for (app_executor_timer_t *t = timer_list; t != NULL; t = t->next)
+        {
+            if (t->active && t->expiry_us <= now)
+            {
+                due = t;
+                period_ms = t->period_ms;
+                if (t->period_ms > 0)
+                {
+                    t->expiry_us += (int64_t)t->period_ms * 1000;
+
+                    // Skip missed periods instead of firing a burst
+                    if (t->expiry_us <= now)
+                    {
+                        t->expiry_us = now + (int64_t)t->period_ms * 1000;
+                    }
+                }
+                else
+                {
+                    t->active = false;
+                }
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&timer_lock);
+
+        if (due == NULL)
+        {
+            break;
+        }
+
+        if (period_ms > 0)
+        {
+            // Lateness includes the time spent in the handlers before this one
+            loop_monitor_tick(due->monitor, period_ms * 1000);
+        }
+
+        stats.timer_fires++;
+        app_executor_run(due->handler, due->arg);
+    }
+}
+
+/**
+ * @brief Run one handler and account its execution time
+ */
+static void app_executor_run(app_executor_handler_t handler, void *arg)
+{
+    int64_t start = esp_timer_get_time();
+
+    handler(arg);
+
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    if (elapsed > stats.max_handler_us)
+    {
+        stats.max_handler_us = elapsed;
+    }
+}
+
+/**
+ * @brief Wake the executor so it recomputes its next deadline
+ */
+static void app_executor_wake(void)
+{
+    // The executor recomputes its deadline after every handler anyway
+    if (work_queue == NULL || app_executor_in_context())
+    {
+        return;
+    }
+
+    app_executor_item_t item = {
+        .handler = NULL,
+        .arg = NULL};
+
+    xQueueSend(work_queue, &item, 0);
+}
+
+/**
+ * @brief Periodic resource report handler
+ */
+static void app_executor_report(void *arg)
+{
+    uint32_t wakeups = stats.wakeups - report_last_wakeups;
+    report_last_wakeups = stats.wakeups;
+
+    portENTER_CRITICAL(&timer_lock);
+    uint32_t dropped = stats.dropped;
+    portEXIT_CRITICAL(&timer_lock);
+
+    ESP_LOGI(TAG, "Report: heap free=%u min=%u, tasks=%u, wakeups=%lu (%.2f/s), items=%lu, timers=%lu, dropped=%lu, max handler=%lu us, stack free=%u",
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)uxTaskGetNumberOfTasks(),
+             (unsigned long)wakeups,
+             (double)wakeups / APP_EXECUTOR_REPORT_INTERVAL_S,
+             (unsigned long)stats.work_items,
+             (unsigned long)stats.timer_fires,
+             (unsigned long)dropped,
+             (unsigned long)stats.max_handler_us,
+             (unsigned)uxTaskGetStackHighWaterMark(NULL));
+
+    // Compare every static task's high-water mark with its configured size
+    task_registry_check_stacks();
+    jitter_probe_report();
+    loop_monitor_log();
+
+    // Figures of the lower layers, registered at init
+    for (size_t i = 0; i < report_count; i++)
+    {
+        report_callbacks[i]();
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file app_executor.h
+ *
+ * @brief Application Executor API
+ *
+ * Single run-to-completion event loop shared by the application layer.
+ * Work items posted from any task (or ISR) and software timers are executed
+ * one after another on one FreeRTOS task, so short handlers no longer need a
+ * dedicated task and stack each.
+ */
+
+#ifndef APP_EXECUTOR_H
+#define APP_EXECUTOR_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "loop_monitor.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define APP_EXECUTOR_QUEUE_LENGTH       CONFIG_APP_EXECUTOR_QUEUE_LENGTH
+#define APP_EXECUTOR_REPORT_INTERVAL_S  CONFIG_APP_EXECUTOR_REPORT_INTERVAL_S
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Handler executed on the executor task
+ *
+ * Handlers must not block for long: every other handler waits behind them.
+ */
+typedef void (*app_executor_handler_t)(void *arg);
+
+/**
+ * @brief Report callback run after the periodic resource report
+ */
+typedef void (*app_executor_report_t)(void);
+
+/**
+ * @brief Executor software timer
+ *
+ * Storage is owned by the caller (usually a static variable) so the executor
+ * never allocates. Initialize with app_executor_timer_init() before use.
+ */
+typedef struct app_executor_timer
+{
+    const char *name;                 //!< Timer name for logging
+    app_executor_handler_t handler;   //!< Handler run on expiry
+    void *arg;                        //!< Handler argument
+    uint32_t period_ms;               //!< Reload period, 0 for one-shot
+    int64_t expiry_us;                //!< Next expiry in esp_timer time
+    bool active;                      //!< Timer is armed
+    loop_monitor_id_t monitor;        //!< Loop monitored on every periodic expiry, LOOP_MONITOR_MAX if none
+    struct app_executor_timer *next;  //!< Registered timer list link
+} app_executor_timer_t;
+
+/**
+ * @brief Executor runtime statistics
+ */
+typedef struct
+{
+    uint32_t wakeups;        //!< Times the executor task was woken up
+    uint32_t work_items;     //!< Work items executed
+    uint32_t timer_fires;    //!< Timer handlers executed
+    uint32_t dropped;        //!< Posts dropped because the queue was full
+    uint32_t max_handler_us; //!< Longest single handler run time
+    uint32_t stack_free;     //!< Executor stack high-water mark (bytes)
+} app_executor_stats_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Create the executor queue and task
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t app_executor_init(void);
+
+/**
+ * @brief Queue a handler to run on the executor task
+ *
+ * @param[in] handler Handler to execute
+ * @param[in] arg Handler argument
+ *
+ * @return ESP_OK on success, ESP_ERR_TIMEOUT if the queue is full
+ */
+esp_err_t app_executor_post(app_executor_handler_t handler, void *arg);
+
+/**
+ * @brief Queue a handler to run on the executor task from an ISR
+ *
+ * @param[in] handler Handler to execute
+ * @param[in] arg Handler argument
+ *
+ * @return ESP_OK on success, ESP_ERR_TIMEOUT if the queue is full
+ */
+esp_err_t app_executor_post_from_isr(app_executor_handler_t handler, void *arg);
+
+/**
+ * @brief Register a software timer with the executor
+ *
+ * @param[in] timer Caller-owned timer storage
+ * @param[in] name Timer name for logging
+ * @param[in] handler Handler run on expiry
+ * @param[in] arg Handler argument
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t app_executor_timer_init(app_executor_timer_t *timer, const char *name,
+                                  app_executor_handler_t handler, void *arg);
+
+/**
+ * @brief Arm (or re-arm) a timer
+ *
+ * @param[in] timer Timer to arm
+ * @param[in] delay_ms Delay before the first expiry
+ * @param[in] period_ms Reload period, 0 for a one-shot timer
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t app_executor_timer_start(app_executor_timer_t *timer, uint32_t delay_ms, uint32_t period_ms);
+
+/**
+ * @brief Disarm a timer
+ *
+ * @param[in] timer Timer to disarm
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t app_executor_timer_stop(app_executor_timer_t *timer);
+
+/**
+ * @brief Report the lateness of a periodic timer to the loop monitor
+ *
+ * Every expiry ticks the loop with the timer period; (re-)arming the timer
+ * restarts the measurement. One-shot expiries are not counted.
+ *
+ * @param[in] timer Initialized timer
+ * @param[in] id Loop to tick, LOOP_MONITOR_MAX to stop monitoring
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on NULL timer
+ */
+esp_err_t app_executor_timer_monitor(app_executor_timer_t *timer, loop_monitor_id_t id);
+
+/**
+ * @brief Check if a timer is armed
+ *
+ * @param[in] timer Timer to check
+ *
+ * @return true if armed, false otherwise
+ */
+bool app_executor_timer_is_active(const app_executor_timer_t *timer);
+
+/**
+ * @brief Check if the caller runs on the executor task
+ *
+ * @return true when called from an executor handler
+ */
+bool app_executor_in_context(void);
+
+/**
+ * @brief Add a callback to the periodic resource report
+ *
+ * Lets lower layers log their own figures with the report without the
+ * executor depending on them. Callbacks run in registration order on the
+ * executor task.
+ *
+ * @param[in] report Callback
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on NULL callback,
+ *         ESP_ERR_NO_MEM if all slots are taken
+ */
+esp_err_t app_executor_register_report(app_executor_report_t report);
+
+/**
+ * @brief Get executor runtime statistics
+ *
+ * @param[out] stats Statistics snapshot
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t app_executor_get_stats(app_executor_stats_t *stats);
+
+#endif /* APP_EXECUTOR_H */
@@ -21,13 +21,6 @@
 
 /* Exported variables --------------------------------------------------------*/
 
-/**
- * @brief Global device mode state
- *
- * @note true if mode is ON, false if OFF
- */
-extern bool isModeON;
-
 /**
  * @brief Data publish interval in seconds
  */
@@ -7,6 +7,7 @@
 /* Includes ------------------------------------------------------------------*/
 
 #include "mode_manager.h"
+#include "app_state.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "nvs.h"
@@ -21,10 +22,6 @@
 // Default mode
 #define DEFAULT_MODE MODE_ON
 
-/* Exported variables --------------------------------------------------------*/
-
-bool isModeON = false; //!< Global mode state indicator (true if mode is ON, false if OFF)
-
 /* Private variables ---------------------------------------------------------*/
 
 static const char *TAG = "MODE_MANAGER";
@@ -86,14 +83,7 @@ esp_err_t mode_manager_init(void)
 
     initialized = true;
 
-    if (current_mode == MODE_ON)
-    {
-        isModeON = true;
-    }
-    else
-    {
-        isModeON = false;
-    }
+    app_state_set_mode_on(current_mode == MODE_ON);
 
     ESP_LOGI(TAG, "Mode Manager initialized successfully, current mode: %s",
              mode_manager_get_mode_name(current_mode));
@@ -120,7 +110,6 @@ esp_err_t mode_manager_set_mode(device_mode_t mode)
 
     if (current_mode == mode)
     {
-        isModeON = (mode == MODE_ON) ? true : false;
         ESP_LOGI(TAG, "Mode already set to: %s", mode_manager_get_mode_name(mode));
         return ESP_OK;
     }
@@ -128,7 +117,7 @@ esp_err_t mode_manager_set_mode(device_mode_t mode)
     device_mode_t old_mode = current_mode;
     current_mode = mode;
 
-    isModeON = (current_mode == MODE_ON) ? true : false;
+    app_state_set_mode_on(current_mode == MODE_ON);
 
     ESP_LOGI(TAG, "Mode changed from %s to %s",
              mode_manager_get_mode_name(old_mode),
@@ -9,6 +9,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include "cJSON.h"
+#include "esp_err.h"
 #include <stdint.h>
 
 /* Exported types ------------------------------------------------------------*/
@@ -33,6 +35,11 @@ typedef void (*mqtt_cmd_get_status_cb_t)(const char *cmd_id);
 typedef void (*mqtt_cmd_ping_cb_t)(const char *cmd_id);
 typedef void (*mqtt_cmd_reboot_cb_t)(const char *cmd_id);
 typedef void (*mqtt_cmd_factory_reset_cb_t)(const char *cmd_id);
+typedef void (*mqtt_cmd_ota_cb_t)(const char *cmd_id, const char *url, const char *sha256, const char *signature);
+typedef void (*mqtt_cmd_trace_record_cb_t)(const char *cmd_id, const char *path, int samples);
+typedef void (*mqtt_cmd_set_brokers_cb_t)(const char *cmd_id, const char *brokers);
+typedef void (*mqtt_cmd_set_filter_cb_t)(const char *cmd_id, const char *channel, int median, double alpha);
+typedef void (*mqtt_cmd_get_history_cb_t)(const char *cmd_id, uint32_t from, uint32_t to);
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -54,12 +61,41 @@ void mqtt_callback_register_on_get_status(mqtt_cmd_get_status_cb_t callback);
 void mqtt_callback_register_on_ping(mqtt_cmd_ping_cb_t callback);
 void mqtt_callback_register_on_reboot(mqtt_cmd_reboot_cb_t callback);
 void mqtt_callback_register_on_factory_reset(mqtt_cmd_factory_reset_cb_t callback);
+void mqtt_callback_register_on_ota(mqtt_cmd_ota_cb_t callback);
+void mqtt_callback_register_on_trace_record(mqtt_cmd_trace_record_cb_t callback);
+void mqtt_callback_register_on_set_brokers(mqtt_cmd_set_brokers_cb_t callback);
+void mqtt_callback_register_on_set_filter(mqtt_cmd_set_filter_cb_t callback);
+void mqtt_callback_register_on_get_history(mqtt_cmd_get_history_cb_t callback);
 
 /**
  * @brief Initialize MQTT Callback Manager
  */
 void mqtt_callback_init(void);
 
+/**
+ * @brief Dispatch a command to its registered callback
+ *
+ * Registered with mqtt_manager and the LAN API by mqtt_callback_init().
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] command Command name
+ * @param[in] params Command parameters as cJSON object
+ */
+void mqtt_callback_handle_command(const char *cmd_id, const char *command, cJSON *params);
+
+/**
+ * @brief Reply to a command on the channel it arrived on
+ *
+ * Replies to LAN API commands are returned in the HTTP response; all
+ * others are published to the broker response topic.
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] status Status string literal (e.g., "success", "error")
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t mqtt_callback_respond(const char *cmd_id, const char *status);
+
 /**
  * @brief Callback invocation connected
  */
@@ -162,4 +198,50 @@ void mqtt_callback_invoke_reboot(const char *cmd_id);
  */
 void mqtt_callback_invoke_factory_reset(const char *cmd_id);
 
+/**
+ * @brief Callback invocation OTA command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] url Image or delta URL
+ * @param[in] sha256 SHA-256 of the resulting image (hex)
+ * @param[in] signature Signature over the SHA-256 (hex), empty if unsigned
+ */
+void mqtt_callback_invoke_ota(const char *cmd_id, const char *url, const char *sha256, const char *signature);
+
+/**
+ * @brief Callback invocation trace record command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] path Trace file, empty for the default
+ * @param[in] samples Samples to record, 0 to stop, negative for no limit
+ */
+void mqtt_callback_invoke_trace_record(const char *cmd_id, const char *path, int samples);
+
+/**
+ * @brief Callback invocation set brokers command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] brokers Comma separated host[:port] list, empty for the Kconfig list
+ */
+void mqtt_callback_invoke_set_brokers(const char *cmd_id, const char *brokers);
+
+/**
+ * @brief Callback invocation set filter command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] channel "temperature", "humidity", "light" or "all"
+ * @param[in] median Median window, negative to keep the current one
+ * @param[in] alpha IIR weight of a new sample (0-1], negative to keep the current one
+ */
+void mqtt_callback_invoke_set_filter(const char *cmd_id, const char *channel, int median, double alpha);
+
+/**
+ * @brief Callback invocation get history command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] from First Unix timestamp to export, 0 for the oldest sample
+ * @param[in] to Last Unix timestamp to export, 0 for the newest sample
+ */
+void mqtt_callback_invoke_get_history(const char *cmd_id, uint32_t from, uint32_t to);
+
 #endif /* MQTT_CALLBACK_H */
@@ -8,9 +8,12 @@
 
 #include "mqtt_callback.h"
 #include "mqtt_manager.h"
+#include "local_api.h"
 #include "json_helper.h"
 #include "esp_log.h"
 #include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <string.h>
 
 /* Private variables ---------------------------------------------------------*/
@@ -33,20 +36,21 @@ static mqtt_cmd_get_status_cb_t on_get_status_cb = NULL;
 static mqtt_cmd_ping_cb_t on_ping_cb = NULL;
 static mqtt_cmd_reboot_cb_t on_reboot_cb = NULL;
 static mqtt_cmd_factory_reset_cb_t on_factory_reset_cb = NULL;
+static mqtt_cmd_ota_cb_t on_ota_cb = NULL;
+static mqtt_cmd_trace_record_cb_t on_trace_record_cb = NULL;
+static mqtt_cmd_set_brokers_cb_t on_set_brokers_cb = NULL;
+static mqtt_cmd_set_filter_cb_t on_set_filter_cb = NULL;
+static mqtt_cmd_get_history_cb_t on_get_history_cb = NULL;
+
+// Reply sink of the LAN command being dispatched; only the HTTP server
+// task dispatches LAN commands, and handlers reply on the calling task
+static TaskHandle_t local_reply_task = NULL;
+static const char *local_reply_status = NULL;
 
 /* External functions --------------------------------------------------------*/
 
 /* Forward declarations ------------------------------------------------------*/
 
-/**
- * @brief Internal handler for MQTT commands
- *
- * @param[in] cmd_id Command ID
- * @param[in] command Command name
- * @param[in] params Command parameters as cJSON object
- */
-static void mqtt_callback_internal_command_handler(const char *cmd_id, const char *command, cJSON *params);
-
 /**
  * @brief Internal handler for MQTT connected event
  */
@@ -57,6 +61,17 @@ static void mqtt_callback_internal_connected_handler(void);
  */
 static void mqtt_callback_internal_disconnected_handler(void);
 
+/**
+ * @brief Dispatch a LAN API command, capturing the reply for the HTTP response
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] command Command name
+ * @param[in] params Command parameters as cJSON object
+ *
+ * @return Status the handler replied with, NULL if it did not reply
+ */
+static const char *mqtt_callback_handle_local_command(const char *cmd_id, const char *command, cJSON *params);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -69,11 +84,138 @@ void mqtt_callback_init(void)
     // Register internal handlers with MQTT manager
     mqtt_manager_register_connected_callback(mqtt_callback_internal_connected_handler);
     mqtt_manager_register_disconnected_callback(mqtt_callback_internal_disconnected_handler);
-    mqtt_manager_register_command_callback(mqtt_callback_internal_command_handler);
+    mqtt_manager_register_command_callback(mqtt_callback_handle_command);
+
+    // LAN API commands go through the same dispatch, replies go to the HTTP client
+    local_api_register_command_callback(mqtt_callback_handle_local_command);
 
     ESP_LOGI(TAG, "MQTT Callback Manager initialized");
 }
 
+/**
+ * @brief Dispatch a command to its registered callback
+ */
+void mqtt_callback_handle_command(const char *cmd_id, const char *command, cJSON *params)
+{
+    if (!cmd_id || !command)
+    {
+        ESP_LOGE(TAG, "Invalid command parameters");
+        return;
+    }
+
+    ESP_LOGI(TAG, "Processing command: %s (ID: %s)", command, cmd_id);
+
+    /* Command: set_device */
+    if (strcmp(command, "set_device") == 0)
+    {
+        const char *device = json_helper_get_string(params, "device", "");
+        int state = json_helper_get_int(params, "state", 0);
+        mqtt_callback_invoke_set_device(cmd_id, device, state);
+    }
+    /* Command: set_devices */
+    else if (strcmp(command, "set_devices") == 0)
+    {
+        int fan = json_helper_get_int(params, "fan", -1);
+        int light = json_helper_get_int(params, "light", -1);
+        int ac = json_helper_get_int(params, "ac", -1);
+        mqtt_callback_invoke_set_devices(cmd_id, fan, light, ac);
+    }
+    /* Command: set_mode */
+    else if (strcmp(command, "set_mode") == 0)
+    {
+        int mode = json_helper_get_int(params, "mode", 0);
+        mqtt_callback_invoke_set_mode(cmd_id, mode);
+    }
+    /* Command: set_interval */
+    else if (strcmp(command, "set_interval") == 0)
+    {
+        int interval = json_helper_get_int(params, "interval", 0);
+        mqtt_callback_invoke_set_interval(cmd_id, interval);
+    }
+    /* Command: set_timestamp */
+    else if (strcmp(command, "set_timestamp") == 0)
+    {
+        uint32_t timestamp = (uint32_t)json_helper_get_int(params, "timestamp", 0);
+        mqtt_callback_invoke_set_timestamp(cmd_id, timestamp);
+    }
+    /* Command: get_status */
+    else if (strcmp(command, "get_status") == 0)
+    {
+        mqtt_callback_invoke_get_status(cmd_id);
+    }
+    /* Command: ping */
+    else if (strcmp(command, "ping") == 0)
+    {
+        mqtt_callback_invoke_ping(cmd_id);
+    }
+    /* Command: reboot */
+    else if (strcmp(command, "reboot") == 0)
+    {
+        mqtt_callback_invoke_reboot(cmd_id);
+    }
+    /* Command: factory_reset */
+    else if (strcmp(command, "factory_reset") == 0)
+    {
+        mqtt_callback_invoke_factory_reset(cmd_id);
+    }
+    /* Command: ota */
+    else if (strcmp(command, "ota") == 0)
+    {
+        const char *url = json_helper_get_string(params, "url", "");
+        const char *sha256 = json_helper_get_string(params, "sha256", "");
+        const char *signature = json_helper_get_string(params, "signature", "");
+        mqtt_callback_invoke_ota(cmd_id, url, sha256, signature);
+    }
+    /* Command: trace_record */
+    else if (strcmp(command, "trace_record") == 0)
+    {
+        const char *path = json_helper_get_string(params, "path", "");
+        int samples = json_helper_get_int(params, "samples", -1);
+        mqtt_callback_invoke_trace_record(cmd_id, path, samples);
+    }
+    /* Command: set_brokers */
+    else if (strcmp(command, "set_brokers") == 0)
+    {
+        const char *brokers = json_helper_get_string(params, "brokers", "");
+        mqtt_callback_invoke_set_brokers(cmd_id, brokers);
+    }
+    /* Command: set_filter */
+    else if (strcmp(command, "set_filter") == 0)
+    {
+        const char *channel = json_helper_get_string(params, "channel", "all");
+        int median = json_helper_get_int(params, "median", -1);
+        double alpha = json_helper_get_number(params, "alpha", -1.0);
+        mqtt_callback_invoke_set_filter(cmd_id, channel, median, alpha);
+    }
+    /* Command: get_history */
+    else if (strcmp(command, "get_history") == 0)
+    {
+        uint32_t from = (uint32_t)json_helper_get_number(params, "from", 0);
+        uint32_t to = (uint32_t)json_helper_get_number(params, "to", 0);
+        mqtt_callback_invoke_get_history(cmd_id, from, to);
+    }
+    /* Unknown Command */
+    else
+    {
+        ESP_LOGW(TAG, "Unknown command: %s (ID: %s)", command, cmd_id);
+        mqtt_callback_respond(cmd_id, "error");
+    }
+}
+
+/**
+ * @brief Reply to a command on the channel it arrived on
+ */
+esp_err_t mqtt_callback_respond(const char *cmd_id, const char *status)
+{
+    if (local_reply_task != NULL && local_reply_task == xTaskGetCurrentTaskHandle())
+    {
+        local_reply_status = status;
+        return ESP_OK;
+    }
+
+    return mqtt_manager_publish_response(cmd_id, status);
+}
+
 /**
  * @brief Callback registration API
  */
@@ -191,6 +333,51 @@ void mqtt_callback_register_on_factory_reset(mqtt_cmd_factory_reset_cb_t callbac
     ESP_LOGI(TAG, "Registered: on_factory_reset");
 }
 
+/**
+ * @brief Callback registration API
+ */
+void mqtt_callback_register_on_ota(mqtt_cmd_ota_cb_t callback)
+{
+    on_ota_cb = callback;
+    ESP_LOGI(TAG, "Registered: on_ota");
+}
+
+/**
+ * @brief Callback registration API
+ */
+void mqtt_callback_register_on_trace_record(mqtt_cmd_trace_record_cb_t callback)
+{
+    on_trace_record_cb = callback;
+    ESP_LOGI(TAG, "Registered: on_trace_record");
+}
+
+/**
+ * @brief Callback registration API
+ */
+void mqtt_callback_register_on_set_brokers(mqtt_cmd_set_brokers_cb_t callback)
+{
+    on_set_brokers_cb = callback;
+    ESP_LOGI(TAG, "Registered: on_set_brokers");
+}
+
+/**
+ * @brief Callback registration API
+ */
+void mqtt_callback_register_on_set_filter(mqtt_cmd_set_filter_cb_t callback)
+{
+    on_set_filter_cb = callback;
+    ESP_LOGI(TAG, "Registered: on_set_filter");
+}
+
+/**
+ * @brief Callback registration API
+ */
+void mqtt_callback_register_on_get_history(mqtt_cmd_get_history_cb_t callback)
+{
+    on_get_history_cb = callback;
+    ESP_LOGI(TAG, "Registered: on_get_history");
+}
+
 /**
  * @brief Callback invocation APIs
  */
@@ -386,96 +573,111 @@ void mqtt_callback_invoke_factory_reset(const char *cmd_id)
     }
 }
 
-/* Private functions ---------------------------------------------------------*/
-
 /**
- * @brief Internal handler for MQTT connected event
+ * @brief Callback invocation APIs
  */
-static void mqtt_callback_internal_connected_handler(void)
+void mqtt_callback_invoke_ota(const char *cmd_id, const char *url, const char *sha256, const char *signature)
 {
-    ESP_LOGI(TAG, "MQTT connected");
-    mqtt_callback_invoke_connected();
+    if (on_ota_cb)
+    {
+        on_ota_cb(cmd_id, url, sha256, signature);
+    }
+    else
+    {
+        ESP_LOGW(TAG, "[%s] No callback for: ota", cmd_id);
+    }
 }
 
 /**
- * @brief Internal handler for MQTT disconnected event
+ * @brief Callback invocation APIs
  */
-static void mqtt_callback_internal_disconnected_handler(void)
+void mqtt_callback_invoke_trace_record(const char *cmd_id, const char *path, int samples)
 {
-    ESP_LOGW(TAG, "MQTT disconnected");
-    mqtt_callback_invoke_disconnected();
+    if (on_trace_record_cb)
+    {
+        on_trace_record_cb(cmd_id, path, samples);
+    }
+    else
+    {
+        ESP_LOGW(TAG, "[%s] No callback for: trace_record", cmd_id);
+    }
 }
 
 /**
- * @brief Internal handler for MQTT commands
+ * @brief Callback invocation APIs
  */
-static void mqtt_callback_internal_command_handler(const char *cmd_id, const char *command, cJSON *params)
+void mqtt_callback_invoke_set_brokers(const char *cmd_id, const char *brokers)
 {
-    if (!cmd_id || !command)
-    {
-        ESP_LOGE(TAG, "Invalid command parameters");
-        return;
-    }
-
-    ESP_LOGI(TAG, "Processing command: %s (ID: %s)", command, cmd_id);
-
-    /* Command: set_device */
-    if (strcmp(command, "set_device") == 0)
-    {
-        const char *device = json_helper_get_string(params, "device", "");
-        int state = json_helper_get_int(params, "state", 0);
-        mqtt_callback_invoke_set_device(cmd_id, device, state);
-    }
-    /* Command: set_devices */
-    else if (strcmp(command, "set_devices") == 0)
-    {
-        int fan = json_helper_get_int(params, "fan", -1);
-        int light = json_helper_get_int(params, "light", -1);
-        int ac = json_helper_get_int(params, "ac", -1);
-        mqtt_callback_invoke_set_devices(cmd_id, fan, light, ac);
-    }
-    /* Command: set_mode */
-    else if (strcmp(command, "set_mode") == 0)
-    {
-        int mode = json_helper_get_int(params, "mode", 0);
-        mqtt_callback_invoke_set_mode(cmd_id, mode);
-    }
-    /* Command: set_interval */
-    else if (strcmp(command, "set_interval") == 0)
+    if (on_set_brokers_cb)
     {
-        int interval = json_helper_get_int(params, "interval", 0);
-        mqtt_callback_invoke_set_interval(cmd_id, interval);
-    }
-    /* Command: set_timestamp */
-    else if (strcmp(command, "set_timestamp") == 0)
-    {
-        uint32_t timestamp = (uint32_t)json_helper_get_int(params, "timestamp", 0);
-        mqtt_callback_invoke_set_timestamp(cmd_id, timestamp);
+        on_set_brokers_cb(cmd_id, brokers);
     }
-    /* Command: get_status */
-    else if (strcmp(command, "get_status") == 0)
+    else
     {
-        mqtt_callback_invoke_get_status(cmd_id);
+        ESP_LOGW(TAG, "[%s] No callback for: set_brokers", cmd_id);
     }
-    /* Command: ping */
-    else if (strcmp(command, "ping") == 0)
+}
+
+/**
+ * @brief Callback invocation APIs
+ */
+void mqtt_callback_invoke_set_filter(const char *cmd_id, const char *channel, int median, double alpha)
+{
+    if (on_set_filter_cb)
     {
-        mqtt_callback_invoke_ping(cmd_id);
+        on_set_filter_cb(cmd_id, channel, median, alpha);
     }
-    /* Command: reboot */
-    else if (strcmp(command, "reboot") == 0)
+    else
     {
-        mqtt_callback_invoke_reboot(cmd_id);
+        ESP_LOGW(TAG, "[%s] No callback for: set_filter", cmd_id);
     }
-    /* Command: factory_reset */
-    else if (strcmp(command, "factory_reset") == 0)
+}
+
+/**
+ * @brief Callback invocation APIs
+ */
+void mqtt_callback_invoke_get_history(const char *cmd_id, uint32_t from, uint32_t to)
+{
+    if (on_get_history_cb)
     {
-        mqtt_callback_invoke_factory_reset(cmd_id);
+        on_get_history_cb(cmd_id, from, to);
     }
-    /* Unknown Command */
     else
     {
-        ESP_LOGW(TAG, "Unknown command: %s (ID: %s)", command, cmd_id);
-        mqtt_manager_publish_response(cmd_id, "error");
+        ESP_LOGW(TAG, "[%s] No callback for: get_history", cmd_id);
     }
 }
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Internal handler for MQTT connected event
+ */
+static void mqtt_callback_internal_connected_handler(void)
+{
+    ESP_LOGI(TAG, "MQTT connected");
+    mqtt_callback_invoke_connected();
+}
+
+/**
+ * @brief Internal handler for MQTT disconnected event
+ */
+static void mqtt_callback_internal_disconnected_handler(void)
+{
+    ESP_LOGW(TAG, "MQTT disconnected");
+    mqtt_callback_invoke_disconnected();
+}
+
+/**
+ * @brief Dispatch a LAN API command, capturing the reply for the HTTP response
+ */
+static const char *mqtt_callback_handle_local_command(const char *cmd_id, const char *command, cJSON *params)
+{
+    local_reply_status = NULL;
+    local_reply_task = xTaskGetCurrentTaskHandle();
+
+    mqtt_callback_handle_command(cmd_id, command, params);
+
+    local_reply_task = NULL;
+    return local_reply_status;
+}
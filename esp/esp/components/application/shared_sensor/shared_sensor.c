@@ -24,6 +24,7 @@ static shared_sensor_data_t sensor_data = {
     .valid = false};
 
 static SemaphoreHandle_t data_mutex = NULL;
+static StaticSemaphore_t data_mutex_buffer;
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -38,7 +39,7 @@ esp_err_t shared_sensor_data_init(void)
         return ESP_OK;
     }
 
-    data_mutex = xSemaphoreCreateMutex();
+    data_mutex = xSemaphoreCreateMutexStatic(&data_mutex_buffer);
     if (data_mutex == NULL)
     {
         ESP_LOGE(TAG, "Failed to create mutex");
@@ -13,40 +13,40 @@
 /* Exported functions --------------------------------------------------------*/
 
 /**
- * @brief Initialize button processing task and queue
+ * @brief Register button handlers on the application executor
  */
 esp_err_t task_button_init(void);
 
 /**
- * @brief Button interval callback implementations - just queues event
+ * @brief Button interval callback implementations - runs on the executor
  *
  * @param[in] button Button type pressed
  */
 void task_button_wifi_pressed(button_type_t button);
 
 /**
- * @brief Button device callback implementations - just queues event
+ * @brief Button device callback implementations - runs on the executor
  *
  * @param[in] button Button type pressed
  */
 void task_button_mode_pressed(button_type_t button);
 
 /**
- * @brief Button light callback implementations - just queues event
+ * @brief Button light callback implementations - runs on the executor
  *
  * @param[in] button Button type pressed
  */
 void task_button_light_pressed(button_type_t button);
 
 /**
- * @brief Button fan callback implementations - just queues event
+ * @brief Button fan callback implementations - runs on the executor
  *
  * @param[in] button Button type pressed
  */
 void task_button_fan_pressed(button_type_t button);
 
 /**
- * @brief Button ac callback implementations - just queues event
+ * @brief Button ac callback implementations - runs on the executor
  *
  * @param[in] button Button type pressed
  */
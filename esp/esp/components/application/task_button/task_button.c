@@ -8,174 +8,185 @@
 
 #include "task_button.h"
 #include "task_manager.h"
+#include "app_executor.h"
 #include "button_handler.h"
 #include "device_control.h"
 #include "mode_manager.h"
 #include "wifi_manager.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "freertos/queue.h"
+#include "jitter_probe.h"
+#include "task_mode.h"
+#include "esp_system.h"
 #include "esp_log.h"
 
+/* PRIVATE DEFINES ----------------------------------------------------------*/
+
+#define WIFI_RESET_DELAY_MS 1000 //!< Delay before restarting into provisioning
+
 /* PRIVATE VARIABLES --------------------------------------------------------*/
 
 static const char *TAG = "TASK_BUTTON";
 
-// Button event queue to defer processing
-static QueueHandle_t button_event_queue = NULL;
-static TaskHandle_t button_task_handle = NULL;
+// Debounce scan, armed by the button interrupt until all buttons are idle
+static app_executor_timer_t scan_timer;
+
+// Deferred restart after clearing WiFi credentials
+static app_executor_timer_t restart_timer;
 
 /* PRIVATE FUNCTIONS --------------------------------------------------------*/
 
 /**
- * @brief Button processing task - handles button events from queue
+ * @brief Process a debounced button press (runs on the executor)
  */
-static void button_processing_task(void *arg)
+static void task_button_process(button_type_t button)
 {
-    button_type_t button_event;
+    // Any press lights the panel; the press still acts if it was off
+    task_mode_wake_display();
 
-    ESP_LOGI(TAG, "Button processing task started");
-
-    while (1)
+    switch (button)
     {
-        // Wait for button events from queue
-        if (xQueueReceive(button_event_queue, &button_event, portMAX_DELAY) == pdTRUE)
-        {
-            // Process button event based on type
-            switch (button_event)
-            {
-            case BUTTON_WIFI:
-                ESP_LOGW(TAG, "WiFi credentials clear button pressed");
-                wifi_manager_clear_credentials();
-                ESP_LOGI(TAG, "Restarting to provisioning mode...");
-                vTaskDelay(pdMS_TO_TICKS(1000));
-                esp_restart();
-                break;
-
-            case BUTTON_MODE:
-                ESP_LOGI(TAG, "Device button pressed");
-                mode_manager_toggle_mode();
-                task_mqtt_publish_current_state();
-                break;
-
-            case BUTTON_LIGHT:
-                ESP_LOGI(TAG, "Light button pressed");
-                device_control_toggle(DEVICE_LIGHT);
-                task_mqtt_publish_current_state();
-                break;
-
-            case BUTTON_FAN:
-                ESP_LOGI(TAG, "Fan button pressed");
-                device_control_toggle(DEVICE_FAN);
-                task_mqtt_publish_current_state();
-                break;
-
-            case BUTTON_AC:
-                ESP_LOGI(TAG, "AC button pressed");
-                device_control_toggle(DEVICE_AC);
-                task_mqtt_publish_current_state();
-                break;
-
-            default:
-                ESP_LOGW(TAG, "Unknown button event: %d", button_event);
-                break;
-            }
-        }
+    case BUTTON_WIFI:
+        ESP_LOGW(TAG, "WiFi credentials clear button pressed");
+        wifi_manager_clear_credentials();
+        ESP_LOGI(TAG, "Restarting to provisioning mode...");
+        app_executor_timer_start(&restart_timer, WIFI_RESET_DELAY_MS, 0);
+        break;
+
+    case BUTTON_MODE:
+        ESP_LOGI(TAG, "Device button pressed");
+        mode_manager_toggle_mode();
+        task_mqtt_publish_current_state();
+        break;
+
+    case BUTTON_LIGHT:
+        ESP_LOGI(TAG, "Light button pressed");
+        device_control_toggle(DEVICE_LIGHT);
+        jitter_probe_stop(JITTER_PROBE_BUTTON_TO_RELAY);
+        task_mqtt_publish_current_state();
+        break;
+
+    case BUTTON_FAN:
+        ESP_LOGI(TAG, "Fan button pressed");
+        device_control_toggle(DEVICE_FAN);
+        jitter_probe_stop(JITTER_PROBE_BUTTON_TO_RELAY);
+        task_mqtt_publish_current_state();
+        break;
+
+    case BUTTON_AC:
+        ESP_LOGI(TAG, "AC button pressed");
+        device_control_toggle(DEVICE_AC);
+        jitter_probe_stop(JITTER_PROBE_BUTTON_TO_RELAY);
+        task_mqtt_publish_current_state();
+        break;
+
+    default:
+        ESP_LOGW(TAG, "Unknown button event: %d", button);
+        break;
     }
 }
 
-/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Debounce scan timer handler
+ */
+static void task_button_scan(void *arg)
+{
+    // Press callbacks run from inside the scan, on the executor
+    if (!button_handler_poll())
+    {
+        app_executor_timer_stop(&scan_timer);
+    }
+}
 
 /**
- * @brief Initialize button processing task and queue
+ * @brief Start debounce scanning (runs on the executor)
  */
-esp_err_t task_button_init(void)
+static void task_button_scan_start(void *arg)
 {
-    // Create queue for button events (10 events max)
-    button_event_queue = xQueueCreate(10, sizeof(button_type_t));
-    if (button_event_queue == NULL)
+    if (!app_executor_timer_is_active(&scan_timer))
     {
-        ESP_LOGE(TAG, "Failed to create button event queue");
-        return ESP_FAIL;
+        app_executor_timer_start(&scan_timer, 0, BUTTON_POLL_INTERVAL_MS);
     }
+}
 
-    // Create button processing task with higher priority and larger stack
-    BaseType_t result = xTaskCreate(
-        button_processing_task,
-        "button_proc",
-        4096, // Stack size - increased for MQTT operations
-        NULL,
-        6, // Priority - higher than button polling task
-        &button_task_handle);
+/**
+ * @brief Button wakeup from GPIO interrupt
+ *
+ * @return true if the scan was queued on the executor
+ */
+static bool task_button_wakeup_isr(void)
+{
+    jitter_probe_start(JITTER_PROBE_BUTTON_TO_RELAY);
+    return app_executor_post_from_isr(task_button_scan_start, NULL) == ESP_OK;
+}
 
-    if (result != pdPASS)
+/**
+ * @brief Restart timer handler
+ */
+static void task_button_restart(void *arg)
+{
+    esp_restart();
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Register button handlers on the application executor
+ */
+esp_err_t task_button_init(void)
+{
+    app_executor_timer_init(&scan_timer, "button_scan", task_button_scan, NULL);
+    app_executor_timer_init(&restart_timer, "button_restart", task_button_restart, NULL);
+    app_executor_timer_monitor(&scan_timer, LOOP_MONITOR_BUTTON_SCAN);
+
+    esp_err_t ret = button_handler_set_wakeup_callback(task_button_wakeup_isr);
+    if (ret != ESP_OK)
     {
-        ESP_LOGE(TAG, "Failed to create button processing task");
-        vQueueDelete(button_event_queue);
-        button_event_queue = NULL;
-        return ESP_FAIL;
+        ESP_LOGE(TAG, "Failed to set button wakeup callback: %s", esp_err_to_name(ret));
+        return ret;
     }
 
+    // A button held during boot produced no edge, scan once to catch it
+    app_executor_post(task_button_scan_start, NULL);
+
     ESP_LOGI(TAG, "Button processing system initialized");
     return ESP_OK;
 }
 
 /**
- * @brief Button interval callback implementations - just queues event
+ * @brief Button interval callback implementations - runs on the executor
  */
 void task_button_wifi_pressed(button_type_t button)
 {
-    // Queue button event for deferred processing
-    if (button_event_queue != NULL)
-    {
-        xQueueSend(button_event_queue, &button, 0);
-    }
+    task_button_process(button);
 }
 
 /**
- * @brief Button device callback implementations - just queues event
+ * @brief Button device callback implementations - runs on the executor
  */
 void task_button_mode_pressed(button_type_t button)
 {
-    // Queue button event for deferred processing
-    if (button_event_queue != NULL)
-    {
-        xQueueSend(button_event_queue, &button, 0);
-    }
+    task_button_process(button);
 }
 
 /**
- * @brief Button light callback implementations - just queues event
+ * @brief Button light callback implementations - runs on the executor
  */
 void task_button_light_pressed(button_type_t button)
 {
-    // Queue button event for deferred processing
-    if (button_event_queue != NULL)
-    {
-        xQueueSend(button_event_queue, &button, 0);
-    }
+    task_button_process(button);
 }
 
 /**
- * @brief Button fan callback implementations - just queues event
+ * @brief Button fan callback implementations - runs on the executor
  */
 void task_button_fan_pressed(button_type_t button)
 {
-    // Queue button event for deferred processing
-    if (button_event_queue != NULL)
-    {
-        xQueueSend(button_event_queue, &button, 0);
-    }
+    task_button_process(button);
 }
 
 /**
- * @brief Button ac callback implementations - just queues event
+ * @brief Button ac callback implementations - runs on the executor
  */
 void task_button_ac_pressed(button_type_t button)
 {
-    // Queue button event for deferred processing
-    if (button_event_queue != NULL)
-    {
-        xQueueSend(button_event_queue, &button, 0);
-    }
+    task_button_process(button);
 }
@@ -14,6 +14,16 @@
 
 /* Exported types ------------------------------------------------------------*/
 
+/**
+ * @brief Panel power states
+ */
+typedef enum
+{
+    DISPLAY_POWER_ACTIVE = 0, //!< Full contrast
+    DISPLAY_POWER_DIMMED,     //!< Low contrast after the dim timeout
+    DISPLAY_POWER_OFF         //!< Panel off, nothing rendered or flushed
+} display_power_t;
+
 /**
  * @brief Complete display data structure
  */
@@ -61,4 +71,22 @@ void task_display_update_time(int hour, int minute, int second);
  */
 void task_display_show_message(const char *message);
 
+/**
+ * @brief Record user-visible activity
+ *
+ * Restarts the inactivity timeouts. The panel returns to active at the
+ * next task_display_power_update(). Safe to call from any task.
+ */
+void task_display_note_activity(void);
+
+/**
+ * @brief Apply the power state due for the current inactivity time
+ *
+ * Sends the contrast or display on/off command on a state change. Called
+ * by the rendering task before each frame.
+ *
+ * @return Power state in effect; do not render while DISPLAY_POWER_OFF
+ */
+display_power_t task_display_power_update(void);
+
 #endif /* TASK_DISPLAY_H */
@@ -8,6 +8,7 @@
 
 #include "task_display.h"
 #include "sensor_manager.h"
+#include "task_registry.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -28,6 +29,14 @@
 #define SENSOR_HUM_X 50
 #define SENSOR_LIGHT_X 94
 
+/* Power management */
+#define DISPLAY_DIM_TIMEOUT_MS (CONFIG_DISPLAY_DIM_TIMEOUT_S * 1000U)
+#define DISPLAY_OFF_TIMEOUT_MS (CONFIG_DISPLAY_OFF_TIMEOUT_S * 1000U)
+
+/* FNV-1a parameters for page change detection */
+#define PAGE_HASH_OFFSET 2166136261u
+#define PAGE_HASH_PRIME 16777619u
+
 /* Private variables ---------------------------------------------------------*/
 
 static const char *TAG = "TASK_DISPLAY";
@@ -35,6 +44,20 @@ static const char *TAG = "TASK_DISPLAY";
 /* Global device pointer */
 static sh1106_t *display_device = NULL;
 
+/* Frame hand-off between rendering and the flush task */
+static portMUX_TYPE frame_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t frame_seq = 0;         //!< Presented frames, guarded by frame_lock
+static TaskHandle_t flush_task_handle = NULL;
+TASK_REGISTRY_STORAGE(display_flush, TASK_STACK_DISPLAY_FLUSH);
+
+/* Panel contents as last written, flush task only */
+static uint32_t page_hash[SH1106_PAGE_COUNT];
+static uint8_t page_known = 0;         //!< Bit per page whose hash matches the panel
+
+/* Power state, owned by the rendering task */
+static display_power_t power_state = DISPLAY_POWER_ACTIVE;
+static volatile TickType_t last_activity = 0; //!< Written from any task
+
 /* Font data */
 // Font 5x7 for digits 0-9 and colon
 static const uint8_t font_5x7[][5] = {
@@ -86,6 +109,47 @@ static const uint8_t font_dot[5] = {0x00, 0x60, 0x60, 0x00, 0x00};
 
 /* Private functions prototypes ----------------------------------------------*/
 
+/**
+ * @brief Present the rendered frame
+ *
+ * Swaps the frame buffers and wakes the flush task. Returns without
+ * waiting for the bus.
+ */
+static void task_display_present(void);
+
+/**
+ * @brief Flush task: stream presented frames to the panel
+ *
+ * @param[in] arg Unused
+ */
+static void display_flush_task(void *arg);
+
+/**
+ * @brief Write every page of the front buffer that differs from the panel
+ *
+ * Each page is copied out under frame_lock, so a frame presented mid-pass
+ * is picked up by the remaining pages.
+ */
+static void flush_dirty_pages(void);
+
+/**
+ * @brief Hash one page
+ *
+ * @param[in] data SH1106_PAGE_WIDTH bytes
+ *
+ * @return FNV-1a hash
+ */
+static uint32_t page_hash_of(const uint8_t *data);
+
+/**
+ * @brief Send the panel commands for a power state
+ *
+ * @param[in] state Target state
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t display_apply_power(display_power_t state);
+
 /**
  * @brief Draw a single character on display
  *
@@ -192,15 +256,24 @@ esp_err_t task_display_init(void)
 
     ESP_LOGI(TAG, "Got display device from sensor_manager");
 
-    // Clear display on init
-    sh1106_clear_display(display_device);
-    esp_err_t ret = sh1106_update_display(display_device);
+    // Bus time moves to a background task; without it frames flush inline
+    esp_err_t ret = task_registry_create_static(TASK_ID_DISPLAY_FLUSH, display_flush_task, NULL,
+                                                display_flush_stack, &display_flush_tcb,
+                                                &flush_task_handle);
     if (ret != ESP_OK)
     {
-        ESP_LOGE(TAG, "Failed to update display: %s", esp_err_to_name(ret));
-        return ret;
+        ESP_LOGW(TAG, "Flush task not started, flushing on the rendering task");
+        flush_task_handle = NULL;
     }
 
+    // Clear display on init
+    sh1106_clear_display(display_device);
+    task_display_present();
+
+    last_activity = xTaskGetTickCount();
+    power_state = DISPLAY_POWER_ACTIVE;
+    display_apply_power(DISPLAY_POWER_ACTIVE);
+
     ESP_LOGI(TAG, "Display interface initialized successfully");
     return ESP_OK;
 }
@@ -226,7 +299,7 @@ void task_display_render_full_ui(const display_data_t *data)
     draw_version_info(data->version);
     draw_interval_info(data->interval);
 
-    sh1106_update_display(display_device);
+    task_display_present();
 }
 
 /**
@@ -247,7 +320,7 @@ void task_display_update_time(int hour, int minute, int second)
     }
 
     draw_time_display(hour, minute, second);
-    sh1106_update_display(display_device);
+    task_display_present();
 }
 
 /**
@@ -267,11 +340,182 @@ void task_display_show_message(const char *message)
     int y = 28; // Center vertically
     draw_text(x, y, message, 1);
 
-    sh1106_update_display(display_device);
+    task_display_present();
+}
+
+/**
+ * @brief Record user-visible activity
+ */
+void task_display_note_activity(void)
+{
+    last_activity = xTaskGetTickCount();
+}
+
+/**
+ * @brief Apply the power state due for the current inactivity time
+ */
+display_power_t task_display_power_update(void)
+{
+    if (!display_device)
+    {
+        return DISPLAY_POWER_OFF;
+    }
+
+    uint32_t idle_ms = pdTICKS_TO_MS(xTaskGetTickCount() - last_activity);
+    display_power_t target = DISPLAY_POWER_ACTIVE;
+
+    if (DISPLAY_OFF_TIMEOUT_MS > 0 && idle_ms >= DISPLAY_OFF_TIMEOUT_MS)
+    {
+        target = DISPLAY_POWER_OFF;
+    }
+    else if (DISPLAY_DIM_TIMEOUT_MS > 0 && idle_ms >= DISPLAY_DIM_TIMEOUT_MS)
+    {
+        target = DISPLAY_POWER_DIMMED;
+    }
+
+    if (target != power_state)
+    {
+        // On failure the state is kept and the command retried next frame
+        if (display_apply_power(target) == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Panel %s", target == DISPLAY_POWER_OFF      ? "off"
+                                      : target == DISPLAY_POWER_DIMMED ? "dimmed"
+                                                                       : "active");
+            power_state = target;
+        }
+    }
+
+    return power_state;
 }
 
 /* Private functions ---------------------------------------------------------*/
 
+/**
+ * @brief Send the panel commands for a power state
+ */
+static esp_err_t display_apply_power(display_power_t state)
+{
+    if (state == DISPLAY_POWER_OFF)
+    {
+        return sh1106_set_display_on(display_device, false);
+    }
+
+    esp_err_t ret = sh1106_set_contrast(display_device, state == DISPLAY_POWER_DIMMED
+                                                            ? CONFIG_DISPLAY_CONTRAST_DIM
+                                                            : CONFIG_DISPLAY_CONTRAST_ACTIVE);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    // Panel RAM survives display-off, so waking shows the last frame at once
+    return sh1106_set_display_on(display_device, true);
+}
+
+/**
+ * @brief Present the rendered frame
+ */
+static void task_display_present(void)
+{
+    portENTER_CRITICAL(&frame_lock);
+    sh1106_swap_buffers(display_device);
+    frame_seq++;
+    portEXIT_CRITICAL(&frame_lock);
+
+    if (flush_task_handle != NULL)
+    {
+        xTaskNotifyGive(flush_task_handle);
+    }
+    else
+    {
+        flush_dirty_pages();
+    }
+}
+
+/**
+ * @brief Flush task: stream presented frames to the panel
+ */
+static void display_flush_task(void *arg)
+{
+    uint32_t flushed_seq = 0;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Latest wins: keep passing until no frame arrived during the pass
+        uint32_t seq, newest;
+        do
+        {
+            portENTER_CRITICAL(&frame_lock);
+            seq = frame_seq;
+            portEXIT_CRITICAL(&frame_lock);
+
+            flush_dirty_pages();
+
+            portENTER_CRITICAL(&frame_lock);
+            newest = frame_seq;
+            portEXIT_CRITICAL(&frame_lock);
+        } while (newest != seq);
+
+        if (seq - flushed_seq > 1)
+        {
+            ESP_LOGD(TAG, "%lu frame(s) superseded before flush", (unsigned long)(seq - flushed_seq - 1));
+        }
+        flushed_seq = seq;
+    }
+}
+
+/**
+ * @brief Write every page of the front buffer that differs from the panel
+ */
+static void flush_dirty_pages(void)
+{
+    uint8_t page[SH1106_PAGE_WIDTH];
+
+    for (uint8_t p = 0; p < SH1106_PAGE_COUNT; p++)
+    {
+        portENTER_CRITICAL(&frame_lock);
+        memcpy(page, sh1106_get_front_buffer(display_device) + p * SH1106_PAGE_WIDTH, sizeof(page));
+        portEXIT_CRITICAL(&frame_lock);
+
+        uint32_t hash = page_hash_of(page);
+        uint8_t bit = (uint8_t)(1U << p);
+
+        if ((page_known & bit) && page_hash[p] == hash)
+        {
+            continue;
+        }
+
+        if (sh1106_write_page(display_device, p, page) == ESP_OK)
+        {
+            page_hash[p] = hash;
+            page_known |= bit;
+        }
+        else
+        {
+            // Panel contents unknown, rewrite with the next frame
+            page_known &= (uint8_t)~bit;
+        }
+    }
+}
+
+/**
+ * @brief Hash one page
+ */
+static uint32_t page_hash_of(const uint8_t *data)
+{
+    uint32_t hash = PAGE_HASH_OFFSET;
+
+    for (int i = 0; i < SH1106_PAGE_WIDTH; i++)
+    {
+        hash ^= data[i];
+        hash *= PAGE_HASH_PRIME;
+    }
+
+    return hash;
+}
+
 /**
  * @brief Draw text string on display
  */
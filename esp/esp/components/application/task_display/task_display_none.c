@@ -0,0 +1,69 @@
+/**
+ * @file task_display_none.c
+ *
+ * @brief Task Display Implementation for boards without a panel
+ *
+ * Built instead of task_display.c when CONFIG_DISPLAY_NONE is set. The
+ * panel reports itself off, so the rendering task only samples sensors.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "task_display.h"
+#include "esp_log.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "TASK_DISPLAY";
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize display task and hardware
+ */
+esp_err_t task_display_init(void)
+{
+    ESP_LOGI(TAG, "Built without display");
+    return ESP_OK;
+}
+
+/**
+ * @brief Render complete UI with all elements
+ */
+void task_display_render_full_ui(const display_data_t *data)
+{
+    (void)data;
+}
+
+/**
+ * @brief Update only time display (faster partial update)
+ */
+void task_display_update_time(int hour, int minute, int second)
+{
+    (void)hour;
+    (void)minute;
+    (void)second;
+}
+
+/**
+ * @brief Show a centered message on display
+ */
+void task_display_show_message(const char *message)
+{
+    ESP_LOGD(TAG, "Message: %s", message);
+}
+
+/**
+ * @brief Record user-visible activity
+ */
+void task_display_note_activity(void)
+{
+}
+
+/**
+ * @brief Apply the power state due for the current inactivity time
+ */
+display_power_t task_display_power_update(void)
+{
+    return DISPLAY_POWER_OFF;
+}
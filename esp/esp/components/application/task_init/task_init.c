@@ -8,14 +8,21 @@
 
 #include "task_init.h"
 #include "task_manager.h"
+#include "app_executor.h"
 #include "shared_sensor.h"
 #include "sensor_manager.h"
+#include "i2cdev.h"
+#include "sensor_trace.h"
+#include "sensor_filter.h"
+#include "sensor_history.h"
 #include "mode_manager.h"
 #include "button_handler.h"
 #include "device_control.h"
 #include "status_led.h"
 #include "wifi_manager.h"
 #include "mqtt_manager.h"
+#include "ota_manager.h"
+#include "heap_account.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "freertos/FreeRTOS.h"
@@ -47,6 +54,11 @@ extern void task_wifi_event_callback(wifi_manager_event_t event, void *data);
  */
 static void task_init_nvs(void);
 
+/**
+ * @brief Initialize application executor
+ */
+static void task_init_executor(void);
+
 /**
  * @brief Initialize hardware components
  */
@@ -82,13 +94,27 @@ static void task_init_mqtt(void);
  */
 static void task_init_mode_manager(void);
 
+/**
+ * @brief Start the serial console
+ */
+static void task_init_console(void);
+
 /* Exported functions --------------------------------------------------------*/
 
 void task_init(void)
 {
+    // Count cJSON allocations from the first one on
+    heap_account_init();
+
+    // Seed the state store before any consumer reads the interval
+    app_state_set_interval_ms(INTERVAL_TIME_MS);
+
     // Initialize NVS
     task_init_nvs();
 
+    // Initialize application executor (runs button, LED and MQTT handlers)
+    task_init_executor();
+
     // Initialize status LEDs
     task_init_status_led();
 
@@ -116,6 +142,9 @@ void task_init(void)
 
     // Initialize MQTT components
     task_init_mqtt();
+
+    // Serial console (heap report)
+    task_init_console();
 }
 
 /* Private functions --------------------------------------------------------*/
@@ -140,6 +169,18 @@ static void task_init_nvs(void)
     ESP_LOGI(TAG, "NVS initialized");
 }
 
+/**
+ * @brief Initialize application executor
+ */
+static void task_init_executor(void)
+{
+    esp_err_t ret = app_executor_init();
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Application executor initialize failed: %s", esp_err_to_name(ret));
+    }
+}
+
 /**
  * @brief Initialize hardware components
  */
@@ -148,7 +189,7 @@ static void task_init_status_led(void)
     // Initialize Status LEDs
     status_led_init();
 
-    // Initialize Task Status LED Polling
+    // Register status LED handlers on the executor
     task_status_set_init();
 }
 
@@ -163,7 +204,7 @@ static void task_init_button(void)
     // Initialize Button Handler
     button_handler_init();
 
-    // Initialize button processing task and queue
+    // Register button scan and press handlers on the executor
     task_button_init();
 
     // Set button callbacks
@@ -181,6 +222,19 @@ static void task_init_hardware_protocol(void)
 {
     // Initialize Sensor Manager
     sensor_manager_init(I2C_MASTER_SDA_PIN, I2C_MASTER_SCL_PIN);
+
+    // Bus utilization and per-sensor read statistics with every executor report
+    app_executor_register_report(i2c_bus_report);
+    app_executor_register_report(sensor_manager_report);
+
+    // Trace replay backend and trace_record command
+    sensor_trace_init();
+
+    // Per-channel median and IIR defaults
+    sensor_filter_init();
+
+    // Sample ring read by the get_history command
+    sensor_history_init();
 }
 
 /**
@@ -260,12 +314,6 @@ static void task_init_wifi(void)
         ESP_LOGE(TAG, "WiFi Manager start failed: %s", esp_err_to_name(ret));
     }
 
-    ret = task_wifi_set_wifi_connecting_init();
-    if (ret != ESP_OK)
-    {
-        ESP_LOGE(TAG, "Task WiFi connecting init failed: %s", esp_err_to_name(ret));
-    }
-
     // Check provisioning status
     if (wifi_manager_is_provisioned())
     {
@@ -292,5 +340,24 @@ void task_init_mqtt(void)
         ESP_LOGE(TAG, "MQTT Manager initialize failed: %s", esp_err_to_name(ret));
     }
 
+    // Initialize OTA manager (update commands arrive over MQTT)
+    ret = ota_manager_init();
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "OTA Manager initialize failed: %s", esp_err_to_name(ret));
+    }
+
     task_mqtt_init();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Start the serial console
+ */
+static void task_init_console(void)
+{
+    esp_err_t ret = heap_account_console_start();
+    if (ret != ESP_OK && ret != ESP_ERR_NOT_SUPPORTED)
+    {
+        ESP_LOGE(TAG, "Console start failed: %s", esp_err_to_name(ret));
+    }
+}
@@ -10,8 +10,10 @@
 /* Includes ------------------------------------------------------------------*/
 
 #include "esp_err.h"
+#include "app_state.h"
 
 // Component headers
+#include "app_executor.h"
 #include "task_init.h"
 #include "task_button.h"
 #include "task_status.h"
@@ -37,17 +39,11 @@
 
 /* External variables --------------------------------------------------------*/
 
-/**
- * @brief Global state flags (defined in respective managers)
- */
-extern bool isModeON; //!< Device mode state (mode_manager.c)
-extern bool isWiFi;   //!< WiFi connection state (wifi_manager.c)
-extern bool isMQTT;   //!< MQTT connection state (mqtt_manager.c)
-
 /**
  * @brief Exported variables definitions
+ *
+ * @note Mode, connection flags and the publish interval live in app_state
  */
-extern char g_app_version[16];      //!< Application version string
-extern uint32_t g_interval_time_ms; //!< Data publish interval in milliseconds
+extern char g_app_version[16]; //!< Application version string
 
 #endif /* TASK_MANAGER_H */
\ No newline at end of file
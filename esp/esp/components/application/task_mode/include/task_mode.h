@@ -29,6 +29,14 @@ esp_err_t task_mode_init(void);
  */
 void task_mode_change_event_callback(device_mode_t old_mode, device_mode_t new_mode);
 
+/**
+ * @brief Wake the display on user activity
+ *
+ * Restarts the dim/off timeouts and redraws right away if the panel was
+ * off. Safe to call from any task.
+ */
+void task_mode_wake_display(void);
+
 /**
  * @brief Stop display task
  */
@@ -10,8 +10,13 @@
 #include "task_manager.h"
 #include "sensor_manager.h"
 #include "sensor_reader.h"
+#include "sensor_filter.h"
 #include "mode_manager.h"
 #include "shared_sensor.h"
+#include "task_registry.h"
+#include "loop_monitor.h"
+#include "app_state.h"
+#include "device_control.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -24,8 +29,7 @@
 
 /* External variables --------------------------------------------------------*/
 
-extern char g_app_version[16];      //!< Application version from task_manager.c
-extern uint32_t g_interval_time_ms; //!< Shared interval from task_manager.h
+extern char g_app_version[16]; //!< Application version from task_manager.c
 
 /* Private variables ---------------------------------------------------------*/
 
@@ -33,11 +37,40 @@ static const char *TAG = "TASK_MODE";
 
 static volatile bool display_task_running = false;
 static TaskHandle_t display_task_handle = NULL;
+TASK_REGISTRY_STORAGE(display_task, TASK_STACK_DISPLAY);
 
 /* Private function prototypes -----------------------------------------------*/
 
 static void display_update_task(void *pvParameters);
 
+/**
+ * @brief Wake the display task on mode or interval change
+ *
+ * @param[in] changed Changed APP_STATE_* bits
+ * @param[in] arg Unused
+ */
+static void task_mode_on_state_change(uint32_t changed, void *arg);
+
+/**
+ * @brief Wake the display on relay change
+ *
+ * @param[in] device Device that changed
+ * @param[in] state New state
+ */
+static void task_mode_on_device_change(device_type_t device, device_state_t state);
+
+/**
+ * @brief Give channels whose read failed their last shared value
+ *
+ * The channel bits stay clear, so the filter skips the held values.
+ *
+ * @param[in,out] data Reading from sensor_reader_read_all()
+ *
+ * @return false if nothing usable remains: no channel was decoded, or a
+ *         channel failed before any value was shared
+ */
+static bool task_mode_fill_missing(sensor_data_t *data);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -49,22 +82,34 @@ esp_err_t task_mode_init(void)
 
     display_task_running = true;
 
-    // Create display update task with larger stack
-    BaseType_t ret = xTaskCreate(
+    // Sampling class on the local I/O core, below the button-to-relay path
+    esp_err_t ret = task_registry_create_static(
+        TASK_ID_DISPLAY,
         display_update_task,
-        "display_task",
-        6144, // Increased stack size (was 4096)
         NULL,
-        4, // Lower priority to not block other tasks
+        display_task_stack,
+        &display_task_tcb,
         &display_task_handle);
 
-    if (ret != pdPASS)
+    if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to create display task");
         display_task_running = false;
         return ESP_FAIL;
     }
 
+    // Redraw and resample right away on change instead of at the next tick
+    ret = app_state_subscribe(APP_STATE_MODE_ON | APP_STATE_INTERVAL, task_mode_on_state_change, NULL);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "State changes will show at the next display tick");
+    }
+
+    if (device_control_set_change_callback(task_mode_on_device_change) != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Relay changes will not wake the display");
+    }
+
     ESP_LOGI(TAG, "Display management task initialized successfully");
     return ESP_OK;
 }
@@ -88,6 +133,19 @@ void task_mode_change_event_callback(device_mode_t old_mode, device_mode_t new_m
     }
 }
 
+/**
+ * @brief Wake the display on user activity
+ */
+void task_mode_wake_display(void)
+{
+    task_display_note_activity();
+
+    if (display_task_handle != NULL)
+    {
+        xTaskNotifyGive(display_task_handle);
+    }
+}
+
 /**
  * @brief Stop display task (cleanup)
  */
@@ -97,6 +155,10 @@ void task_mode_stop(void)
     {
         ESP_LOGI(TAG, "Stopping display task");
         display_task_running = false;
+        if (display_task_handle != NULL)
+        {
+            xTaskNotifyGive(display_task_handle); // May be asleep with the panel off
+        }
 
         // Wait for task to finish
         vTaskDelay(pdMS_TO_TICKS(100));
@@ -106,6 +168,57 @@ void task_mode_stop(void)
 
 /* Private functions ---------------------------------------------------------*/
 
+/**
+ * @brief Wake the display task on mode or interval change
+ */
+static void task_mode_on_state_change(uint32_t changed, void *arg)
+{
+    task_mode_wake_display();
+}
+
+/**
+ * @brief Wake the display on relay change
+ */
+static void task_mode_on_device_change(device_type_t device, device_state_t state)
+{
+    task_mode_wake_display();
+}
+
+/**
+ * @brief Give channels whose read failed their last shared value
+ */
+static bool task_mode_fill_missing(sensor_data_t *data)
+{
+    uint32_t missing = SENSOR_CHANNEL_READINGS & ~data->channels;
+    shared_sensor_data_t previous;
+
+    if (missing == 0)
+    {
+        return true;
+    }
+
+    if (missing == SENSOR_CHANNEL_READINGS || shared_sensor_data_get(&previous) != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Sensor reading dropped, channels 0x%lx not decoded", (unsigned long)missing);
+        return false;
+    }
+
+    if (missing & SENSOR_CHANNEL_TEMPERATURE)
+    {
+        data->temperature = previous.temperature;
+    }
+    if (missing & SENSOR_CHANNEL_HUMIDITY)
+    {
+        data->humidity = previous.humidity;
+    }
+    if (missing & SENSOR_CHANNEL_LIGHT)
+    {
+        data->light = (uint16_t)previous.light;
+    }
+
+    return true;
+}
+
 /**
  * @brief Display update task
  */
@@ -113,20 +226,46 @@ static void display_update_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "Display update task started");
 
+    app_state_snapshot_t state;
+    app_state_get_snapshot(&state);
+
     display_data_t display_data = {
         .version = g_app_version,
-        .interval = g_interval_time_ms / 1000};
+        .interval = state.interval_ms / 1000};
 
-    TickType_t last_wake_time = xTaskGetTickCount();
+    TickType_t next_wake_time = xTaskGetTickCount();
     // Initialize to trigger immediate sensor read on first iteration
-    TickType_t last_sensor_read = xTaskGetTickCount() - pdMS_TO_TICKS(g_interval_time_ms);
+    TickType_t last_sensor_read = xTaskGetTickCount() - pdMS_TO_TICKS(state.interval_ms);
+    bool prev_mode_on = state.mode_on;
+    uint32_t prev_interval_ms = state.interval_ms;
+    bool timed_wake = true;
 
     while (display_task_running)
     {
         TickType_t now = xTaskGetTickCount();
 
-        // Update interval from global variable (may be changed by MQTT)
-        display_data.interval = g_interval_time_ms / 1000;
+        // Only periodic wakeups count as samples, not state-change wakeups
+        if (timed_wake)
+        {
+            loop_monitor_tick(LOOP_MONITOR_DISPLAY, DISPLAY_UPDATE_INTERVAL_MS * 1000);
+        }
+        else
+        {
+            // Cadence restarts from this redraw
+            loop_monitor_restart(LOOP_MONITOR_DISPLAY);
+        }
+
+        display_power_t power = task_display_power_update();
+
+        app_state_get_snapshot(&state);
+        if ((state.mode_on && !prev_mode_on) || state.interval_ms != prev_interval_ms)
+        {
+            // Mode switched on or interval changed: sample now
+            last_sensor_read = now - pdMS_TO_TICKS(state.interval_ms);
+        }
+        prev_mode_on = state.mode_on;
+        prev_interval_ms = state.interval_ms;
+        display_data.interval = state.interval_ms / 1000;
 
         // Read time from sensor_manager (DS3231) - every second
         struct tm time_data;
@@ -142,18 +281,19 @@ static void display_update_task(void *pvParameters)
             display_data.second = time_data.tm_sec;
         }
 
-        // Get current mode
-        device_mode_t current_mode = mode_manager_get_mode();
-
-        if (current_mode == MODE_ON)
+        if (state.mode_on)
         {
-            // Read sensors at intervals and update shared data
-            if ((now - last_sensor_read) >= pdMS_TO_TICKS(g_interval_time_ms))
+            // Read sensors at intervals and update shared data, also with the panel off
+            if ((now - last_sensor_read) >= pdMS_TO_TICKS(state.interval_ms))
             {
                 sensor_data_t sensor_data;
 
-                if (sensor_reader_read_all(&sensor_data) == ESP_OK)
+                if (sensor_reader_read_all(&sensor_data) == ESP_OK &&
+                    task_mode_fill_missing(&sensor_data))
                 {
+                    // Reject spikes and smooth before anything sees the value
+                    sensor_filter_process(&sensor_data);
+
                     // Update shared sensor data (single source of truth)
                     shared_sensor_data_update(
                         sensor_data.temperature,
@@ -168,7 +308,11 @@ static void display_update_task(void *pvParameters)
 
             // Get data from shared store for display
             shared_sensor_data_t shared_data;
-            if (shared_sensor_data_get(&shared_data) == ESP_OK)
+            if (power == DISPLAY_POWER_OFF)
+            {
+                // Panel off: nothing rendered, nothing flushed
+            }
+            else if (shared_sensor_data_get(&shared_data) == ESP_OK)
             {
                 display_data.temperature = shared_data.temperature;
                 display_data.humidity = shared_data.humidity;
@@ -183,7 +327,7 @@ static void display_update_task(void *pvParameters)
                                          display_data.second);
             }
         }
-        else
+        else if (power != DISPLAY_POWER_OFF)
         {
             // MODE_OFF: Only update time
             task_display_update_time(display_data.hour,
@@ -191,10 +335,40 @@ static void display_update_task(void *pvParameters)
                                      display_data.second);
         }
 
-        // Update display every second
-        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(DISPLAY_UPDATE_INTERVAL_MS));
+        if (power == DISPLAY_POWER_OFF)
+        {
+            // Sleep until the next sample is due or activity wakes the panel
+            TickType_t wait = portMAX_DELAY;
+            if (state.mode_on)
+            {
+                TickType_t due = last_sensor_read + pdMS_TO_TICKS(state.interval_ms);
+                now = xTaskGetTickCount();
+                wait = ((int32_t)(due - now) > 0) ? (due - now) : 0;
+            }
+            ulTaskNotifyTake(pdTRUE, wait);
+
+            // Not a one second period, keep it out of the jitter samples
+            timed_wake = false;
+            next_wake_time = xTaskGetTickCount();
+            continue;
+        }
+
+        // Update display every second, or earlier when the state changes
+        next_wake_time += pdMS_TO_TICKS(DISPLAY_UPDATE_INTERVAL_MS);
+        now = xTaskGetTickCount();
+        if ((int32_t)(next_wake_time - now) <= 0)
+        {
+            next_wake_time = now;
+        }
+        timed_wake = (ulTaskNotifyTake(pdTRUE, next_wake_time - now) == 0);
+        if (!timed_wake)
+        {
+            // Keep the one second cadence from the redraw on
+            next_wake_time = xTaskGetTickCount();
+        }
     }
 
     ESP_LOGI(TAG, "Display task stopped");
+    task_registry_remove(TASK_ID_DISPLAY);
     vTaskDelete(NULL);
 }
\ No newline at end of file
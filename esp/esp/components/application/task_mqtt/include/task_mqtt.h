@@ -114,6 +114,55 @@ void task_mqtt_on_reboot(const char *cmd_id);
  */
 void task_mqtt_on_factory_reset(const char *cmd_id);
 
+/**
+ * @brief Handle ota command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] url Image or delta URL
+ * @param[in] sha256 SHA-256 of the resulting image (hex)
+ * @param[in] signature Signature over the SHA-256 (hex), empty if unsigned
+ */
+void task_mqtt_on_ota(const char *cmd_id, const char *url, const char *sha256, const char *signature);
+
+/**
+ * @brief Handle trace_record command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] path Trace file, empty for the default
+ * @param[in] samples Samples to record, 0 to stop, negative for no limit
+ */
+void task_mqtt_on_trace_record(const char *cmd_id, const char *path, int samples);
+
+/**
+ * @brief Handle set_brokers command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] brokers Comma separated host[:port] list, empty for the Kconfig list
+ */
+void task_mqtt_on_set_brokers(const char *cmd_id, const char *brokers);
+
+/**
+ * @brief Handle set_filter command
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] channel "temperature", "humidity", "light" or "all"
+ * @param[in] median Median window, negative to keep the current one
+ * @param[in] alpha IIR weight of a new sample (0-1], negative to keep the current one
+ */
+void task_mqtt_on_set_filter(const char *cmd_id, const char *channel, int median, double alpha);
+
+/**
+ * @brief Handle get_history command
+ *
+ * Replies "in_progress", publishes the samples of the range as compressed
+ * blocks on the history topic from the executor, then replies "success".
+ *
+ * @param[in] cmd_id Command ID
+ * @param[in] from First Unix timestamp, 0 for the oldest sample
+ * @param[in] to Last Unix timestamp, 0 for the newest sample
+ */
+void task_mqtt_on_get_history(const char *cmd_id, uint32_t from, uint32_t to);
+
 /**
  * @brief Initialize MQTT task and register callbacks
  */
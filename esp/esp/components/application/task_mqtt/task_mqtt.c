@@ -7,7 +7,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "task_mqtt.h"
 #include "task_manager.h"
+#include "app_executor.h"
 #include "mqtt_manager.h"
+#include "mqtt_broker.h"
+#include "heap_account.h"
+#include "loop_monitor.h"
 #include "mqtt_callback.h"
 #include "json_helper.h"
 #include "shared_sensor.h"
@@ -15,33 +19,45 @@
 #include "mode_manager.h"
 #include "sensor_manager.h"
 #include "wifi_manager.h"
+#include "local_api.h"
+#include "ota_manager.h"
+#include "sensor_trace.h"
+#include "sensor_filter.h"
+#include "sensor_history.h"
+#include "history_codec.h"
+#include "app_state.h"
+#include "task_registry.h"
 
 #include "esp_wifi.h"
 #include "esp_netif.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_system.h"
 #include "nvs_flash.h"
 #include "cJSON.h"
 
+#include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
-/* Extern variables ----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+
+#define RESTART_DELAY_MS 1000 //!< Delay so the command response leaves before restart
 
-extern bool isMQTT;
+#define HISTORY_EXPORT_BATCH      512 //!< Samples buffered per history export step
+#define HISTORY_BLOCK_INTERVAL_MS 20  //!< Pause between history blocks
+#define HISTORY_CMD_ID_MAX_LEN    64  //!< Command ID echoed when the export ends
 
 /* Private types -------------------------------------------------------------*/
 
 /**
- * @brief System state structure holding all device states
+ * @brief Output device states (mode and interval live in app_state)
  */
 typedef struct
 {
-    int mode;         //!< Current mode (0=OFF, 1=ON)
-    int interval_sec; //!< Data publish interval in seconds
     int fan;          //!< Fan state (0=OFF, 1=ON)
     int light;        //!< Light state (0=OFF, 1=ON)
     int ac;           //!< AC state (0=OFF, 1=ON)
@@ -56,19 +72,51 @@ typedef struct
     int *state_ptr;   //!< Pointer to state variable
 } device_registry_entry_t;
 
+/**
+ * @brief Running get_history export, heap allocated for its duration
+ */
+typedef struct
+{
+    char cmd_id[HISTORY_CMD_ID_MAX_LEN];            //!< Echoed in the final response
+    uint32_t from;                                  //!< First timestamp
+    uint32_t to;                                    //!< Last timestamp
+    uint32_t cursor;                                //!< sensor_history read position
+    bool more;                                      //!< Ring holds further samples in the range
+    uint16_t seq;                                   //!< Next block sequence number
+    size_t pending;                                 //!< Samples buffered, not yet encoded
+    uint32_t sent_samples;                          //!< Samples published
+    uint32_t sent_bytes;                            //!< Block bytes published
+    history_sample_t samples[HISTORY_EXPORT_BATCH]; //!< Samples read ahead
+    uint8_t block[MQTT_HISTORY_BLOCK_BYTES];        //!< Encoded block
+} history_export_t;
+
 /* Private variables ---------------------------------------------------------*/
 
 static const char *TAG = "TASK_MQTT";
 
 static system_state_t device_state = {
-    .mode = 0,
-    .interval_sec = INTERVAL_TIME_MS / 1000,
     .fan = 0,
     .light = 0,
     .ac = 0};
 
 static SemaphoreHandle_t state_mutex = NULL;
-static volatile bool interval_changed = false;
+static StaticSemaphore_t state_mutex_buffer;
+
+// Executor timers replacing the polling task and the ad-hoc restart tasks
+static app_executor_timer_t data_timer;
+static app_executor_timer_t state_timer;
+static app_executor_timer_t metrics_timer;
+static app_executor_timer_t reboot_timer;
+static app_executor_timer_t factory_reset_timer;
+
+// Set by the command handler, cleared by the export task when it ends
+static portMUX_TYPE history_lock = portMUX_INITIALIZER_UNLOCKED;
+static history_export_t *history_job = NULL;
+static TaskHandle_t history_task_handle = NULL;
+TASK_REGISTRY_STORAGE(history_task, TASK_STACK_HISTORY_EXPORT);
+
+// Only touched on the executor task
+static uint32_t history_last_ts = 0; //!< Sample timestamp of the last history append
 
 // Device registry for extensible device handling
 static device_registry_entry_t device_registry[] = {
@@ -81,9 +129,75 @@ static device_registry_entry_t device_registry[] = {
 /* Private function prototypes -----------------------------------------------*/
 
 /**
- * @brief MQTT task periodic publishing with proper timing
+ * @brief Periodic sensor data publish handler
+ *
+ * @param[in] arg Unused
+ */
+static void task_mqtt_data_timer_handler(void *arg);
+
+/**
+ * @brief Periodic state backup publish handler
+ *
+ * @param[in] arg Unused
+ */
+static void task_mqtt_state_timer_handler(void *arg);
+
+/**
+ * @brief Periodic metrics publish handler
+ *
+ * @param[in] arg Unused
+ */
+static void task_mqtt_metrics_timer_handler(void *arg);
+
+/**
+ * @brief Build the metrics payload
+ *
+ * @param[in] timestamp Unix timestamp in seconds
+ * @param[in] heap Heap report
+ * @param[in] mqtt_outbox MQTT outbox size in bytes
+ * @param[in] loops Loop monitor report, NULL if disabled
+ *
+ * @return Unformatted JSON string (free with cJSON_free), NULL on error
+ */
+static char *task_mqtt_create_metrics(uint32_t timestamp, const heap_account_report_t *heap,
+                                      int mqtt_outbox, const loop_monitor_report_t *loops);
+
+/**
+ * @brief Background task running get_history exports
+ *
+ * Archive reads decode whole flash pages and wait behind archive writes,
+ * so exports stay off the executor.
+ *
+ * @param[in] arg Unused
+ */
+static void task_mqtt_history_task(void *arg);
+
+/**
+ * @brief Publish the next history block of the running export
+ */
+static void task_mqtt_history_step(void);
+
+/**
+ * @brief End the running export and send the final response
+ *
+ * @param[in] status Response status
  */
-static void task_mqtt_run(void *pvParameters);
+static void task_mqtt_history_finish(const char *status);
+
+/**
+ * @brief Restart the data timer with the current interval
+ *
+ * @param[in] arg Unused
+ */
+static void task_mqtt_restart_data_timer(void *arg);
+
+/**
+ * @brief State store change notification (interval)
+ *
+ * @param[in] changed Changed APP_STATE_* bits
+ * @param[in] arg Unused
+ */
+static void task_mqtt_on_state_change(uint32_t changed, void *arg);
 
 /**
  * @brief Find device state by name using registry
@@ -99,6 +213,16 @@ static int *task_mqtt_find_device_state(const char *device_name);
  */
 static uint32_t task_mqtt_get_timestamp(void);
 
+/**
+ * @brief Collect sensor data and refresh the local API data response
+ *
+ * @param[out] timestamp RTC timestamp
+ * @param[out] temp Temperature
+ * @param[out] hum Humidity
+ * @param[out] light Light level
+ */
+static void task_mqtt_collect_sensor_data(uint32_t *timestamp, float *temp, float *hum, int *light);
+
 /**
  * @brief Publish sensor data
  */
@@ -115,18 +239,26 @@ static void task_mqtt_sync_device_states(void);
 static void task_mqtt_publish_info_data(void);
 
 /**
- * @brief Delayed reboot task to avoid blocking MQTT handler
+ * @brief OTA result handler, runs on the OTA task
+ *
+ * @param[in] cmd_id Command ID of the ota command
+ * @param[in] result ESP_OK when the new image is ready to boot
+ */
+static void task_mqtt_on_ota_result(const char *cmd_id, esp_err_t result);
+
+/**
+ * @brief Delayed reboot handler to avoid blocking MQTT handler
  *
- * @param[in] pvParameters Command ID string
+ * @param[in] arg Unused
  */
-static void task_mqtt_delayed_reboot_task(void *pvParameters);
+static void task_mqtt_delayed_reboot(void *arg);
 
 /**
- * @brief Delayed factory reset task
+ * @brief Delayed factory reset handler
  *
- * @param[in] pvParameters Command ID string
+ * @param[in] arg Unused
  */
-static void task_mqtt_delayed_factory_reset_task(void *pvParameters);
+static void task_mqtt_delayed_factory_reset(void *arg);
 
 /**
  * @brief Get current connected SSID
@@ -147,6 +279,9 @@ void task_mqtt_on_connected(void)
 {
     ESP_LOGI(TAG, "MQTT Connected");
 
+    // Reaching the broker proves a freshly updated image, cancel rollback
+    ota_manager_mark_valid();
+
     // Publish info on connection (per spec: Boot + network change)
     task_mqtt_publish_info_data();
 }
@@ -239,7 +374,7 @@ void task_mqtt_on_set_device(const char *cmd_id, const char *device, int state)
     }
 
     // Publish response
-    mqtt_manager_publish_response(cmd_id, (result == ESP_OK) ? "success" : "error");
+    mqtt_callback_respond(cmd_id, (result == ESP_OK) ? "success" : "error");
 
     // Publish updated state
     task_mqtt_publish_current_state();
@@ -299,7 +434,7 @@ void task_mqtt_on_set_devices(const char *cmd_id, int fan, int light, int ac)
     }
 
     // Publish response
-    mqtt_manager_publish_response(cmd_id, (result == ESP_OK) ? "success" : "error");
+    mqtt_callback_respond(cmd_id, (result == ESP_OK) ? "success" : "error");
 
     // Publish updated state
     task_mqtt_publish_current_state();
@@ -312,18 +447,11 @@ void task_mqtt_on_set_mode(const char *cmd_id, int mode)
 {
     ESP_LOGI(TAG, "[%s] set_mode: %d", cmd_id, mode);
 
-    // Update internal state
-    if (xSemaphoreTake(state_mutex, portMAX_DELAY) == pdTRUE)
-    {
-        device_state.mode = mode;
-        xSemaphoreGive(state_mutex);
-    }
-
-    // Update mode manager
+    // Mode manager updates app_state
     mode_manager_set_mode(mode);
 
     // Publish response
-    mqtt_manager_publish_response(cmd_id, "success");
+    mqtt_callback_respond(cmd_id, "success");
 
     // Publish updated state
     task_mqtt_publish_current_state();
@@ -338,19 +466,13 @@ void task_mqtt_on_set_interval(const char *cmd_id, int interval)
 
     if (interval >= MIN_INTERVAL && interval <= MAX_INTERVAL)
     {
-        // Thread-safe write - update both local and global interval
-        if (xSemaphoreTake(state_mutex, portMAX_DELAY) == pdTRUE)
-        {
-            device_state.interval_sec = interval;
-            g_interval_time_ms = interval * 1000; // Sync to global variable
-            interval_changed = true;
-            xSemaphoreGive(state_mutex);
-        }
+        // Subscribers (data timer, display) pick the change up
+        app_state_set_interval_ms((uint32_t)interval * 1000);
 
-        ESP_LOGI(TAG, "Data interval: %d seconds (synced to g_interval_time_ms: %lu ms)", interval, (unsigned long)g_interval_time_ms);
+        ESP_LOGI(TAG, "Data interval: %d seconds", interval);
 
         // Publish response - success
-        mqtt_manager_publish_response(cmd_id, "success");
+        mqtt_callback_respond(cmd_id, "success");
 
         // Publish updated state
         task_mqtt_publish_current_state();
@@ -360,7 +482,7 @@ void task_mqtt_on_set_interval(const char *cmd_id, int interval)
         ESP_LOGW(TAG, "Invalid interval: %d (must be %d-%d)", interval, MIN_INTERVAL, MAX_INTERVAL);
 
         // Publish response - error
-        mqtt_manager_publish_response(cmd_id, "error");
+        mqtt_callback_respond(cmd_id, "error");
     }
 }
 
@@ -375,12 +497,12 @@ void task_mqtt_on_set_timestamp(const char *cmd_id, uint32_t timestamp)
     if (ret == ESP_OK)
     {
         ESP_LOGI(TAG, "Timestamp updated successfully");
-        mqtt_manager_publish_response(cmd_id, "success");
+        mqtt_callback_respond(cmd_id, "success");
     }
     else
     {
         ESP_LOGE(TAG, "Failed to set timestamp: %s", esp_err_to_name(ret));
-        mqtt_manager_publish_response(cmd_id, "error");
+        mqtt_callback_respond(cmd_id, "error");
     }
 }
 
@@ -392,7 +514,7 @@ void task_mqtt_on_get_status(const char *cmd_id)
     ESP_LOGI(TAG, "[%s] get_status publishing all topics", cmd_id);
 
     // Publish response first
-    mqtt_manager_publish_response(cmd_id, "success");
+    mqtt_callback_respond(cmd_id, "success");
 
     // Publish all topics
     task_mqtt_publish_sensor_data();
@@ -408,7 +530,7 @@ void task_mqtt_on_ping(const char *cmd_id)
     ESP_LOGI(TAG, "[%s] ping received", cmd_id);
 
     // Just respond with success - simple connectivity check
-    mqtt_manager_publish_response(cmd_id, "success");
+    mqtt_callback_respond(cmd_id, "success");
 }
 
 /**
@@ -419,10 +541,11 @@ void task_mqtt_on_reboot(const char *cmd_id)
     ESP_LOGW(TAG, "[%s] Reboot requested", cmd_id);
 
     // Publish response before reboot
-    mqtt_manager_publish_response(cmd_id, "success");
+    mqtt_callback_respond(cmd_id, "success");
 
-    // Start delayed reboot task
-    xTaskCreate(task_mqtt_delayed_reboot_task, "reboot_task", 2048, (void *)cmd_id, 1, NULL);
+    // Schedule delayed reboot on the executor
+    ESP_LOGW(TAG, "Reboot in 1 seconds...");
+    app_executor_timer_start(&reboot_timer, RESTART_DELAY_MS, 0);
 }
 
 /**
@@ -433,10 +556,170 @@ void task_mqtt_on_factory_reset(const char *cmd_id)
     ESP_LOGW(TAG, "[%s] Factory reset requested", cmd_id);
 
     // Publish response before factory reset
-    mqtt_manager_publish_response(cmd_id, "success");
+    mqtt_callback_respond(cmd_id, "success");
 
-    // Start delayed factory reset task
-    xTaskCreate(task_mqtt_delayed_factory_reset_task, "factory_reset_task", 2048, (void *)cmd_id, 1, NULL);
+    // Schedule delayed factory reset on the executor
+    ESP_LOGW(TAG, "Factory reset in 1 seconds...");
+    app_executor_timer_start(&factory_reset_timer, RESTART_DELAY_MS, 0);
+}
+
+/**
+ * @brief Handle ota command
+ */
+void task_mqtt_on_ota(const char *cmd_id, const char *url, const char *sha256, const char *signature)
+{
+    ESP_LOGW(TAG, "[%s] OTA requested: %s", cmd_id, url);
+
+    // Download runs on the OTA task; the final status follows as a second response
+    esp_err_t ret = ota_manager_start(cmd_id, url, sha256, signature);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "[%s] OTA not started: %s", cmd_id, esp_err_to_name(ret));
+    }
+
+    mqtt_callback_respond(cmd_id, (ret == ESP_OK) ? "in_progress" : "error");
+}
+
+/**
+ * @brief Handle trace_record command
+ */
+void task_mqtt_on_trace_record(const char *cmd_id, const char *path, int samples)
+{
+    if (samples == 0)
+    {
+        uint32_t written = sensor_trace_record_stop();
+        ESP_LOGI(TAG, "[%s] Trace recording stopped after %lu samples", cmd_id, (unsigned long)written);
+        mqtt_callback_respond(cmd_id, "success");
+        return;
+    }
+
+    // Samples are appended by the sensor reader at the publish interval
+    esp_err_t ret = sensor_trace_record_start(path, (samples > 0) ? (uint32_t)samples : 0);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "[%s] Trace recording not started: %s", cmd_id, esp_err_to_name(ret));
+    }
+
+    mqtt_callback_respond(cmd_id, (ret == ESP_OK) ? "success" : "error");
+}
+
+/**
+ * @brief Handle set_brokers command
+ */
+void task_mqtt_on_set_brokers(const char *cmd_id, const char *brokers)
+{
+    ESP_LOGI(TAG, "[%s] set_brokers: %s", cmd_id, brokers[0] ? brokers : "(Kconfig)");
+
+    // The probe task moves the connection, the response goes out first
+    esp_err_t ret = mqtt_manager_set_brokers(brokers);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "[%s] Broker list rejected: %s", cmd_id, esp_err_to_name(ret));
+    }
+
+    mqtt_callback_respond(cmd_id, (ret == ESP_OK) ? "success" : "error");
+}
+
+/**
+ * @brief Handle set_filter command
+ */
+void task_mqtt_on_set_filter(const char *cmd_id, const char *channel, int median, double alpha)
+{
+    sensor_filter_channel_t first = SENSOR_FILTER_TEMPERATURE;
+    sensor_filter_channel_t last = (sensor_filter_channel_t)(SENSOR_FILTER_CHANNEL_MAX - 1);
+
+    if (strcmp(channel, "all") != 0)
+    {
+        first = last = sensor_filter_channel_from_name(channel);
+        if (first == SENSOR_FILTER_CHANNEL_MAX)
+        {
+            ESP_LOGW(TAG, "[%s] Unknown filter channel: %s", cmd_id, channel);
+            mqtt_callback_respond(cmd_id, "error");
+            return;
+        }
+    }
+
+    esp_err_t ret = ESP_OK;
+    for (int ch = first; ch <= last && ret == ESP_OK; ch++)
+    {
+        sensor_filter_config_t config;
+        sensor_filter_get_config((sensor_filter_channel_t)ch, &config);
+
+        if (median >= 0)
+        {
+            config.median_n = (median > UINT8_MAX) ? 0 : (uint8_t)median;
+        }
+        if (alpha >= 0.0)
+        {
+            // Out of range values map to 0 and are rejected by configure
+            config.iir_alpha = (alpha > 0.0 && alpha <= 1.0)
+                                   ? (uint16_t)(alpha * SENSOR_FILTER_ALPHA_ONE + 0.5)
+                                   : 0;
+        }
+
+        ret = sensor_filter_configure((sensor_filter_channel_t)ch, &config);
+    }
+
+    if (ret == ESP_OK)
+    {
+        ESP_LOGI(TAG, "[%s] Filter %s: median=%d alpha=%.3f", cmd_id, channel, median, alpha);
+    }
+    else
+    {
+        ESP_LOGW(TAG, "[%s] Invalid filter settings: median=%d alpha=%.3f", cmd_id, median, alpha);
+    }
+
+    mqtt_callback_respond(cmd_id, (ret == ESP_OK) ? "success" : "error");
+}
+
+/**
+ * @brief Handle get_history command
+ */
+void task_mqtt_on_get_history(const char *cmd_id, uint32_t from, uint32_t to)
+{
+    ESP_LOGI(TAG, "[%s] get_history: %lu..%lu", cmd_id, (unsigned long)from, (unsigned long)to);
+
+    if (!mqtt_manager_is_connected())
+    {
+        mqtt_callback_respond(cmd_id, "error");
+        return;
+    }
+
+    history_export_t *job = heap_account_malloc(HEAP_ACCOUNT_MQTT, sizeof(*job));
+    if (job == NULL)
+    {
+        ESP_LOGE(TAG, "[%s] No memory for history export", cmd_id);
+        mqtt_callback_respond(cmd_id, "error");
+        return;
+    }
+
+    memset(job, 0, offsetof(history_export_t, samples));
+    strncpy(job->cmd_id, cmd_id, sizeof(job->cmd_id) - 1);
+    job->from = from;
+    job->to = (to == 0) ? UINT32_MAX : to;
+    job->more = true;
+
+    // Blocks go out from the export task, one per HISTORY_BLOCK_INTERVAL_MS
+    bool busy = true;
+
+    portENTER_CRITICAL(&history_lock);
+    if (history_job == NULL && history_task_handle != NULL)
+    {
+        history_job = job;
+        busy = false;
+    }
+    portEXIT_CRITICAL(&history_lock);
+
+    if (busy)
+    {
+        ESP_LOGW(TAG, "[%s] History export already running", cmd_id);
+        heap_account_free(HEAP_ACCOUNT_MQTT, job);
+        mqtt_callback_respond(cmd_id, "error");
+        return;
+    }
+
+    mqtt_callback_respond(cmd_id, "in_progress");
+    xTaskNotifyGive(history_task_handle);
 }
 
 /**
@@ -461,28 +744,57 @@ esp_err_t task_mqtt_init(void)
     mqtt_callback_register_on_ping(task_mqtt_on_ping);
     mqtt_callback_register_on_reboot(task_mqtt_on_reboot);
     mqtt_callback_register_on_factory_reset(task_mqtt_on_factory_reset);
+    mqtt_callback_register_on_ota(task_mqtt_on_ota);
+    mqtt_callback_register_on_trace_record(task_mqtt_on_trace_record);
+    mqtt_callback_register_on_set_brokers(task_mqtt_on_set_brokers);
+    mqtt_callback_register_on_set_filter(task_mqtt_on_set_filter);
+    mqtt_callback_register_on_get_history(task_mqtt_on_get_history);
+    ota_manager_register_result_callback(task_mqtt_on_ota_result);
+    local_api_register_history_reader(sensor_history_read);
 
     // Create mutex for thread-safe device state access
-    state_mutex = xSemaphoreCreateMutex();
+    state_mutex = xSemaphoreCreateMutexStatic(&state_mutex_buffer);
     if (state_mutex == NULL)
     {
         ESP_LOGE(TAG, "Failed to create state mutex");
         return ESP_FAIL;
     }
 
-    // Create MQTT task
-    BaseType_t ret = xTaskCreate(
-        task_mqtt_run,
-        "task_mqtt",
-        4096,
-        NULL,
-        5,
-        NULL);
+    // Periodic publishing runs as executor timers instead of a polling task
+    app_executor_timer_init(&data_timer, "mqtt_data", task_mqtt_data_timer_handler, NULL);
+    app_executor_timer_init(&state_timer, "mqtt_state", task_mqtt_state_timer_handler, NULL);
+    app_executor_timer_init(&metrics_timer, "mqtt_metrics", task_mqtt_metrics_timer_handler, NULL);
+    app_executor_timer_init(&reboot_timer, "reboot", task_mqtt_delayed_reboot, NULL);
+    app_executor_timer_init(&factory_reset_timer, "factory_reset", task_mqtt_delayed_factory_reset, NULL);
+    app_executor_timer_monitor(&data_timer, LOOP_MONITOR_MQTT_DATA);
+    app_executor_timer_monitor(&metrics_timer, LOOP_MONITOR_MQTT_METRICS);
+
+    uint32_t interval_ms = app_state_get_interval_ms();
+    esp_err_t ret = app_executor_timer_start(&data_timer, interval_ms, interval_ms);
+    if (ret == ESP_OK)
+    {
+        ret = app_state_subscribe(APP_STATE_INTERVAL, task_mqtt_on_state_change, NULL);
+    }
+    if (ret == ESP_OK)
+    {
+        ret = app_executor_timer_start(&state_timer, STATE_BACKUP_INTERVAL * 1000, STATE_BACKUP_INTERVAL * 1000);
+    }
+    if (ret == ESP_OK && MQTT_METRICS_INTERVAL_SEC > 0)
+    {
+        ret = app_executor_timer_start(&metrics_timer, MQTT_METRICS_INTERVAL_SEC * 1000, MQTT_METRICS_INTERVAL_SEC * 1000);
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to start MQTT publish timers");
+        return ret;
+    }
 
-    if (ret != pdPASS)
+    // get_history answers "error" without it, publishing is unaffected
+    if (task_registry_create_static(TASK_ID_HISTORY_EXPORT, task_mqtt_history_task, NULL,
+                                    history_task_stack, &history_task_tcb, &history_task_handle) != ESP_OK)
     {
-        ESP_LOGE(TAG, "Failed to create Task MQTT");
-        return ESP_FAIL;
+        ESP_LOGE(TAG, "Failed to create history export task");
     }
 
     ESP_LOGI(TAG, "Task MQTT initialized");
@@ -524,22 +836,42 @@ static int *task_mqtt_find_device_state(const char *device_name)
 }
 
 /**
- * @brief Publish sensor data
+ * @brief Collect sensor data and refresh the local API data response
  */
-static void task_mqtt_publish_sensor_data(void)
+static void task_mqtt_collect_sensor_data(uint32_t *timestamp, float *temp, float *hum, int *light)
 {
-    uint32_t timestamp = task_mqtt_get_timestamp();
-
-    float temp = 0.0f, hum = 0.0f;
-    int light = 0;
+    *timestamp = task_mqtt_get_timestamp();
+    *temp = 0.0f;
+    *hum = 0.0f;
+    *light = 0;
 
     // Invoke data_publish callback to get sensor values
     if (xSemaphoreTake(state_mutex, portMAX_DELAY) == pdTRUE)
     {
-        mqtt_callback_invoke_data_publish(timestamp, &temp, &hum, &light);
+        mqtt_callback_invoke_data_publish(*timestamp, temp, hum, light);
         xSemaphoreGive(state_mutex);
     }
 
+    // Encode once here so LAN requests are served from the buffer
+    char *json = json_helper_create_data(*timestamp, *temp, *hum, *light);
+    if (json != NULL)
+    {
+        local_api_set_data(json, strlen(json));
+        cJSON_free(json);
+    }
+}
+
+/**
+ * @brief Publish sensor data
+ */
+static void task_mqtt_publish_sensor_data(void)
+{
+    uint32_t timestamp;
+    float temp, hum;
+    int light;
+
+    task_mqtt_collect_sensor_data(&timestamp, &temp, &hum, &light);
+
     mqtt_manager_publish_data(timestamp, temp, hum, light);
 }
 
@@ -548,25 +880,23 @@ static void task_mqtt_publish_sensor_data(void)
  */
 void task_mqtt_publish_current_state(void)
 {
-    // Check MQTT connection first to avoid unnecessary work
-    if (!mqtt_manager_is_connected())
-    {
-        ESP_LOGD(TAG, "MQTT not connected, skipping state publish");
-        return;
-    }
-
-    // Sync device states from hardware BEFORE taking mutex
+    // No early return when MQTT is down: the local API state still has to
+    // follow every change. Sync device states from hardware BEFORE taking mutex
     task_mqtt_sync_device_states();
 
     uint32_t timestamp = task_mqtt_get_timestamp();
 
-    int mode = 0, fan = 0, light = 0, ac = 0, interval = 0;
+    // Mode and interval from one state store version
+    app_state_snapshot_t state;
+    app_state_get_snapshot(&state);
+
+    int mode = state.mode_on ? 1 : 0;
+    int interval = (int)(state.interval_ms / 1000);
+    int fan = 0, light = 0, ac = 0;
 
     // Use timeout instead of portMAX_DELAY
     if (xSemaphoreTake(state_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
     {
-        mode = device_state.mode;
-        interval = device_state.interval_sec;
         fan = device_state.fan;
         light = device_state.light;
         ac = device_state.ac;
@@ -576,6 +906,19 @@ void task_mqtt_publish_current_state(void)
 
         xSemaphoreGive(state_mutex);
 
+        char *json = json_helper_create_state(timestamp, mode, interval, fan, light, ac);
+        if (json != NULL)
+        {
+            local_api_set_state(json, strlen(json));
+            cJSON_free(json);
+        }
+
+        if (!mqtt_manager_is_connected())
+        {
+            ESP_LOGD(TAG, "MQTT not connected, skipping state publish");
+            return;
+        }
+
         // Publish after releasing mutex
         mqtt_manager_publish_state(timestamp, mode, interval, fan, light, ac);
     }
@@ -604,9 +947,6 @@ static void task_mqtt_sync_device_states(void)
     // Update internal state with timeout (100ms max)
     if (xSemaphoreTake(state_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
     {
-        // Sync mode from mode_manager
-        device_state.mode = (mode_manager_get_mode() == MODE_ON) ? 1 : 0;
-
         // Sync device states from hardware
         device_state.fan = (fan_state == DEVICE_ON) ? 1 : 0;
         device_state.light = (light_state == DEVICE_ON) ? 1 : 0;
@@ -625,106 +965,325 @@ static void task_mqtt_sync_device_states(void)
 static void task_mqtt_publish_info_data(void)
 {
     uint32_t timestamp = task_mqtt_get_timestamp();
+    char broker[MQTT_BROKER_HOST_MAX_LEN];
+
+    mqtt_broker_get_active_host(broker, sizeof(broker));
 
     mqtt_manager_publish_info(timestamp,
                               MQTT_DEVICE_ID,               //!< Device ID
                               task_mqtt_get_current_ssid(), //!< SSID
                               task_mqtt_get_current_ip(),   //!< IP
-                              MQTT_BROKER_URI,              //!< MQTT URI
+                              broker,                       //!< Active broker
                               g_app_version);               //!< Firmware version
 }
 
 /**
- * @brief Delayed reboot task to avoid blocking MQTT handler
+ * @brief OTA result handler, runs on the OTA task
  */
-static void task_mqtt_delayed_reboot_task(void *pvParameters)
+static void task_mqtt_on_ota_result(const char *cmd_id, esp_err_t result)
 {
+    mqtt_callback_respond(cmd_id, (result == ESP_OK) ? "success" : "error");
 
-    ESP_LOGW(TAG, "Reboot in 1 seconds...");
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
-    esp_restart();
-
-    vTaskDelete(NULL);
+    if (result == ESP_OK)
+    {
+        ESP_LOGW(TAG, "[%s] OTA complete, reboot in 1 seconds...", cmd_id);
+        app_executor_timer_start(&reboot_timer, RESTART_DELAY_MS, 0);
+    }
 }
 
 /**
- * @brief Delayed factory reset task
+ * @brief Delayed reboot handler to avoid blocking MQTT handler
  */
-static void task_mqtt_delayed_factory_reset_task(void *pvParameters)
+static void task_mqtt_delayed_reboot(void *arg)
 {
+    // Keep the samples not archived yet
+    sensor_history_flush();
 
-    ESP_LOGW(TAG, "Factory reset in 1 seconds...");
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    esp_restart();
+}
 
+/**
+ * @brief Delayed factory reset handler
+ */
+static void task_mqtt_delayed_factory_reset(void *arg)
+{
     // Erase NVS flash
     nvs_flash_erase();
 
     esp_restart();
+}
+
+/**
+ * @brief Periodic sensor data publish handler
+ */
+static void task_mqtt_data_timer_handler(void *arg)
+{
+    uint32_t timestamp;
+    float temp, hum;
+    int light;
+
+    // Local API data is refreshed every interval, broker or not
+    task_mqtt_collect_sensor_data(&timestamp, &temp, &hum, &light);
+
+    // Recorded while offline too, get_history fills the gap later. Only
+    // new readings: with MODE OFF sampling stops and the shared sample ages
+    shared_sensor_data_t shared;
+    if (shared_sensor_data_get(&shared) == ESP_OK && shared.valid &&
+        shared.timestamp != 0 && shared.timestamp != history_last_ts)
+    {
+        history_sample_t sample;
+        history_codec_make_sample(shared.timestamp, shared.temperature, shared.humidity, shared.light, &sample);
+        sensor_history_append(&sample);
+        history_last_ts = shared.timestamp;
+    }
+
+    if (!mqtt_manager_is_connected())
+    {
+        return;
+    }
 
-    vTaskDelete(NULL);
+    // Publish sensor data only when MODE is ON (LED is on)
+    if (app_state_is_mode_on())
+    {
+        mqtt_manager_publish_data(timestamp, temp, hum, light);
+    }
+    else
+    {
+        ESP_LOGD(TAG, "Skipping sensor data publish - Mode is OFF");
+    }
 }
 
 /**
- * @brief MQTT task - periodic publishing with proper timing
+ * @brief Periodic state backup publish handler
  */
-static void task_mqtt_run(void *pvParameters)
+static void task_mqtt_state_timer_handler(void *arg)
 {
-    ESP_LOGI(TAG, "MQTT task started");
+    // Skips itself when MQTT is not connected
+    task_mqtt_publish_current_state();
+}
 
-    // Proper tick timing without overflow issues
-    TickType_t last_data_publish = xTaskGetTickCount();
-    TickType_t last_state_publish = xTaskGetTickCount();
+/**
+ * @brief Periodic metrics publish handler
+ */
+static void task_mqtt_metrics_timer_handler(void *arg)
+{
+    if (!mqtt_manager_is_connected())
+    {
+        return;
+    }
 
-    // Initialize from global interval
-    uint32_t current_interval_ms = g_interval_time_ms;
+    heap_account_report_t report;
+    heap_account_get_report(&report);
 
-    while (1)
+    // Left out of the message when the monitor is disabled
+    loop_monitor_report_t loops;
+    bool have_loops = (loop_monitor_get_report(&loops) == ESP_OK);
+
+    char *json = task_mqtt_create_metrics(task_mqtt_get_timestamp(), &report,
+                                          mqtt_manager_get_outbox_size(),
+                                          have_loops ? &loops : NULL);
+    if (json == NULL)
     {
-        if (mqtt_manager_is_connected())
+        return;
+    }
+
+    mqtt_manager_publish_metrics(json);
+    cJSON_free(json);
+}
+
+/**
+ * @brief Build the metrics payload
+ */
+static char *task_mqtt_create_metrics(uint32_t timestamp, const heap_account_report_t *heap,
+                                      int mqtt_outbox, const loop_monitor_report_t *loops)
+{
+    if (heap == NULL)
+    {
+        return NULL;
+    }
+
+    cJSON *root = cJSON_CreateObject();
+    if (root == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create JSON object");
+        return NULL;
+    }
+
+    cJSON_AddNumberToObject(root, "timestamp", timestamp);
+
+    cJSON *heap_obj = cJSON_AddObjectToObject(root, "heap");
+    cJSON *modules = (heap_obj != NULL) ? cJSON_AddObjectToObject(heap_obj, "modules") : NULL;
+    if (modules == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create heap object");
+        cJSON_Delete(root);
+        return NULL;
+    }
+
+    cJSON_AddNumberToObject(heap_obj, "free", heap->free_bytes);
+    cJSON_AddNumberToObject(heap_obj, "min_free", heap->min_free_bytes);
+    cJSON_AddNumberToObject(heap_obj, "largest_block", heap->largest_block);
+    cJSON_AddNumberToObject(heap_obj, "mqtt_outbox", mqtt_outbox);
+
+    for (int i = 0; i < HEAP_ACCOUNT_MAX; i++)
+    {
+        const heap_account_stats_t *m = &heap->modules[i];
+        cJSON *module = cJSON_AddObjectToObject(modules, m->name);
+        if (module == NULL)
         {
-            TickType_t now = xTaskGetTickCount();
+            continue;
+        }
 
-            // Thread-safe read of interval (use global variable)
-            current_interval_ms = g_interval_time_ms;
+        cJSON_AddNumberToObject(module, "live", m->live_bytes);
+        cJSON_AddNumberToObject(module, "peak", m->peak_bytes);
+        cJSON_AddNumberToObject(module, "allocs", m->allocs);
+        cJSON_AddNumberToObject(module, "frees", m->frees);
+    }
 
-            // If interval changed, reset timer immediately
-            if (interval_changed)
+    cJSON *loops_obj = (loops != NULL) ? cJSON_AddObjectToObject(root, "loops") : NULL;
+    if (loops_obj != NULL)
+    {
+        for (int i = 0; i < LOOP_MONITOR_MAX; i++)
+        {
+            const loop_monitor_stats_t *l = &loops->loops[i];
+            cJSON *loop = cJSON_AddObjectToObject(loops_obj, l->name);
+            if (loop == NULL)
             {
-                interval_changed = false;
-                last_data_publish = now;
-                ESP_LOGI(TAG, "Interval timer reset - next publish in %lu seconds",
-                         (unsigned long)(current_interval_ms / 1000));
+                continue;
             }
 
-            // Publish sensor data only when MODE is ON (LED is on)
-            TickType_t data_elapsed = now - last_data_publish;
-            if (data_elapsed >= pdMS_TO_TICKS(current_interval_ms))
-            {
-                if (isModeON)
-                {
-                    task_mqtt_publish_sensor_data();
-                }
-                else
-                {
-                    ESP_LOGD(TAG, "Skipping sensor data publish - Mode is OFF");
-                }
-                last_data_publish = now;
-            }
+            cJSON_AddNumberToObject(loop, "period_ms", l->period_us / 1000);
+            cJSON_AddNumberToObject(loop, "cycles", l->cycles);
+            cJSON_AddNumberToObject(loop, "missed", l->missed);
+            cJSON_AddNumberToObject(loop, "max_late_us", l->max_late_us);
+            cJSON_AddNumberToObject(loop, "max_stall_us", l->max_stall_us);
 
-            // Publish state backup every 60 seconds
-            TickType_t state_elapsed = now - last_state_publish;
-            if (state_elapsed >= pdMS_TO_TICKS(STATE_BACKUP_INTERVAL * 1000))
+            cJSON *hist = cJSON_AddArrayToObject(loop, "late_hist");
+            for (int b = 0; hist != NULL && b < LOOP_MONITOR_BUCKETS; b++)
             {
-                task_mqtt_publish_current_state();
-                last_state_publish = now;
+                cJSON_AddItemToArray(hist, cJSON_CreateNumber(l->hist[b]));
             }
         }
+    }
+
+    // Published every interval, whitespace would only cost airtime
+    char *json_str = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+
+    if (json_str == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to print JSON");
+        return NULL;
+    }
+
+    return json_str;
+}
+
+/**
+ * @brief Background task running get_history exports
+ */
+static void task_mqtt_history_task(void *arg)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Only this task ends a job, so the pointer stays valid between steps
+        while (history_job != NULL)
+        {
+            task_mqtt_history_step();
+            vTaskDelay(pdMS_TO_TICKS(HISTORY_BLOCK_INTERVAL_MS));
+        }
+    }
+}
+
+/**
+ * @brief Publish the next history block of the running export
+ */
+static void task_mqtt_history_step(void)
+{
+    history_export_t *job = history_job;
+
+    // Top up the read-ahead buffer; the leftovers of the last block stay in front
+    if (job->more && job->pending < HISTORY_EXPORT_BATCH)
+    {
+        job->pending += sensor_history_read(&job->cursor, job->from, job->to,
+                                            &job->samples[job->pending],
+                                            HISTORY_EXPORT_BATCH - job->pending, &job->more);
+    }
+
+    if (job->pending == 0)
+    {
+        // Empty range, no block is sent
+        task_mqtt_history_finish("success");
+        return;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(1000));
+    size_t len = 0;
+    size_t encoded = 0;
+    history_codec_encode(job->samples, job->pending, job->seq, job->block, sizeof(job->block), &len, &encoded);
+
+    bool last = !job->more && encoded == job->pending;
+    if (last)
+    {
+        history_codec_set_last(job->block);
+    }
+
+    if (mqtt_manager_publish_history(job->block, len) != ESP_OK)
+    {
+        task_mqtt_history_finish("error");
+        return;
+    }
+
+    job->seq++;
+    job->sent_samples += encoded;
+    job->sent_bytes += len;
+    job->pending -= encoded;
+    memmove(job->samples, &job->samples[encoded], job->pending * sizeof(job->samples[0]));
+
+    if (last)
+    {
+        task_mqtt_history_finish("success");
     }
 }
 
+/**
+ * @brief End the running export and send the final response
+ */
+static void task_mqtt_history_finish(const char *status)
+{
+    history_export_t *job = history_job;
+
+    ESP_LOGI(TAG, "[%s] History export %s: %lu samples in %u blocks, %lu bytes", job->cmd_id, status,
+             (unsigned long)job->sent_samples, job->seq, (unsigned long)job->sent_bytes);
+
+    mqtt_callback_respond(job->cmd_id, status);
+
+    portENTER_CRITICAL(&history_lock);
+    history_job = NULL;
+    portEXIT_CRITICAL(&history_lock);
+
+    heap_account_free(HEAP_ACCOUNT_MQTT, job);
+}
+
+/**
+ * @brief Restart the data timer with the current interval
+ */
+static void task_mqtt_restart_data_timer(void *arg)
+{
+    // Next publish is one full interval away
+    uint32_t interval_ms = app_state_get_interval_ms();
+    app_executor_timer_start(&data_timer, interval_ms, interval_ms);
+}
+
+/**
+ * @brief State store change notification (interval)
+ */
+static void task_mqtt_on_state_change(uint32_t changed, void *arg)
+{
+    app_executor_post(task_mqtt_restart_data_timer, NULL);
+}
+
 /**
  * @brief Get current SSID as string
  */
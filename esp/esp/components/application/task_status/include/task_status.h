@@ -14,8 +14,18 @@
 /* Exported functions --------------------------------------------------------*/
 
 /**
- * @brief Task polling LED
+ * @brief Register status LED handlers on the application executor
+ *
+ * @return ESP_OK on success, error code otherwise
  */
 esp_err_t task_status_set_init(void);
 
+/**
+ * @brief Request a status LED refresh
+ *
+ * Safe to call from any task. Called on every app_state change of mode,
+ * WiFi or MQTT state, so the LEDs follow without polling.
+ */
+void task_status_refresh(void);
+
 #endif /* TASK_STATUS_H */
\ No newline at end of file
@@ -8,38 +8,56 @@
 
 #include "task_status.h"
 #include "status_led.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
+#include "app_executor.h"
+#include "app_state.h"
 #include "esp_log.h"
 
 /* Private defines -----------------------------------------------------------*/
 
-#define CHECK_INTERVAL_MS 50
+#define WIFI_BLINK_MS 250 //!< WiFi LED blink half-period while connecting
 
-/* External variables --------------------------------------------------------*/
-
-extern bool isModeON; //!< Defined in mode_manager.c
-extern bool isWiFi;   //!< Defined in wifi_manager.c
-extern bool isMQTT;   //!< Defined in mqtt_manager.c
+#define STATUS_STATE_MASK (APP_STATE_MODE_ON | APP_STATE_WIFI_CONNECTED | \
+                           APP_STATE_WIFI_CONNECTING | APP_STATE_MQTT_CONNECTED)
 
 /* Private variables ---------------------------------------------------------*/
 
 static const char *TAG = "TASK_STATUS";
 
-static TaskHandle_t task_handle = NULL;
 static bool running = false;
 
+static app_executor_timer_t blink_timer;
+
+static led_state_t last_device, last_wifi, last_mqtt;
+static bool blink_phase = false;
+
 /* Private function prototypes -----------------------------------------------*/
 
 /**
- * @brief Task polling LED
+ * @brief Apply the state store to the status LEDs (runs on the executor)
+ *
+ * @param[in] arg Unused
+ */
+static void task_status_apply(void *arg);
+
+/**
+ * @brief State store change notification
+ *
+ * @param[in] changed Changed APP_STATE_* bits
+ * @param[in] arg Unused
+ */
+static void task_status_on_state_change(uint32_t changed, void *arg);
+
+/**
+ * @brief WiFi connecting blink handler
+ *
+ * @param[in] arg Unused
  */
-static void led_polling_task(void *pvParameters);
+static void task_status_blink(void *arg);
 
 /** Exported functions ------------------------------------------------------- */
 
 /**
- * @brief Task polling LED
+ * @brief Register status LED handlers on the application executor
  */
 esp_err_t task_status_set_init(void)
 {
@@ -49,76 +67,118 @@ esp_err_t task_status_set_init(void)
         return ESP_OK;
     }
 
-    // Start polling task
-    running = true;
-    BaseType_t result = xTaskCreate(
-        led_polling_task,
-        "led_polling",
-        2048,
-        NULL,
-        5,
-        &task_handle);
-
-    if (result != pdPASS)
-    {
-        ESP_LOGE(TAG, "Failed to create polling task");
-        running = false;
-        task_handle = NULL;
+    // Get current LED states
+    status_led_get_state(LED_DEVICE, &last_device);
+    status_led_get_state(LED_WIFI, &last_wifi);
+    status_led_get_state(LED_MQTT, &last_mqtt);
 
-        return ESP_FAIL;
+    app_executor_timer_init(&blink_timer, "wifi_blink", task_status_blink, NULL);
+
+    // LEDs change only when the state store does, no periodic resync
+    esp_err_t ret = app_state_subscribe(STATUS_STATE_MASK, task_status_on_state_change, NULL);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to subscribe to state changes");
+        return ret;
     }
 
+    running = true;
+
+    // Pick up state set before the subscription
+    task_status_refresh();
+
     ESP_LOGI(TAG, "Task status initialized");
     return ESP_OK;
 }
 
+/**
+ * @brief Request a status LED refresh
+ */
+void task_status_refresh(void)
+{
+    if (!running)
+    {
+        return;
+    }
+
+    if (app_executor_in_context())
+    {
+        task_status_apply(NULL);
+    }
+    else
+    {
+        app_executor_post(task_status_apply, NULL);
+    }
+}
+
 /* Private functions ----------------------------------------------------------*/
 
 /**
- * @brief Task polling LED
+ * @brief State store change notification
  */
-static void led_polling_task(void *pvParameters)
+static void task_status_on_state_change(uint32_t changed, void *arg)
 {
-    // Get current LED states
-    led_state_t last_device, last_wifi, last_mqtt;
+    task_status_refresh();
+}
 
-    status_led_get_state(LED_DEVICE, &last_device);
-    status_led_get_state(LED_WIFI, &last_wifi);
-    status_led_get_state(LED_MQTT, &last_mqtt);
+/**
+ * @brief Apply the state store to the status LEDs
+ */
+static void task_status_apply(void *arg)
+{
+    app_state_snapshot_t state;
+    app_state_get_snapshot(&state);
+
+    // Blink the WiFi LED while a connection attempt is in progress
+    if (state.wifi_connecting && !app_executor_timer_is_active(&blink_timer))
+    {
+        app_executor_timer_start(&blink_timer, WIFI_BLINK_MS, WIFI_BLINK_MS);
+    }
 
-    while (running)
+    // Check LED_DEVICE
+    led_state_t current_device = state.mode_on ? LED_ON : LED_OFF;
+    if (last_device != current_device)
+    {
+        status_led_set_state(LED_DEVICE, current_device);
+        ESP_LOGI(TAG, "Mode LED: %s", state.mode_on ? "ON" : "OFF");
+        last_device = current_device;
+    }
+
+    // Check LED_WIFI
+    bool wifi_on = state.wifi_connecting ? blink_phase : state.wifi_connected;
+    led_state_t current_wifi = wifi_on ? LED_ON : LED_OFF;
+    if (last_wifi != current_wifi)
+    {
+        status_led_set_state(LED_WIFI, current_wifi);
+        ESP_LOGD(TAG, "WiFi LED: %s", wifi_on ? "ON" : "OFF");
+        last_wifi = current_wifi;
+    }
+
+    // Check LED_MQTT
+    led_state_t current_mqtt = state.mqtt_connected ? LED_ON : LED_OFF;
+    if (last_mqtt != current_mqtt)
+    {
+        status_led_set_state(LED_MQTT, current_mqtt);
+        ESP_LOGI(TAG, "MQTT LED: %s", state.mqtt_connected ? "ON" : "OFF");
+        last_mqtt = current_mqtt;
+    }
+}
+
+/**
+ * @brief WiFi connecting blink handler
+ */
+static void task_status_blink(void *arg)
+{
+    if (app_state_is_wifi_connecting())
+    {
+        // Toggle LED blink state
+        blink_phase = !blink_phase;
+    }
+    else
     {
-        // Check LED_DEVICE
-        led_state_t current_device = isModeON ? LED_ON : LED_OFF;
-        if (last_device != current_device)
-        {
-            status_led_set_state(LED_DEVICE, current_device);
-            ESP_LOGI(TAG, "Mode LED: %s", isModeON ? "ON" : "OFF");
-            last_device = current_device;
-        }
-
-        // Check LED_WIFI
-        led_state_t current_wifi = isWiFi ? LED_ON : LED_OFF;
-        if (last_wifi != current_wifi)
-        {
-            status_led_set_state(LED_WIFI, current_wifi);
-            ESP_LOGI(TAG, "WiFi LED: %s", isWiFi ? "ON" : "OFF");
-            last_wifi = current_wifi;
-        }
-
-        // Check LED_MQTT
-        led_state_t current_mqtt = isMQTT ? LED_ON : LED_OFF;
-        if (last_mqtt != current_mqtt)
-        {
-            status_led_set_state(LED_MQTT, current_mqtt);
-            ESP_LOGI(TAG, "MQTT LED: %s", isMQTT ? "ON" : "OFF");
-            last_mqtt = current_mqtt;
-        }
-
-        // Delay before the next check
-        vTaskDelay(pdMS_TO_TICKS(CHECK_INTERVAL_MS));
+        app_executor_timer_stop(&blink_timer);
+        blink_phase = false;
     }
 
-    ESP_LOGI(TAG, "LED polling task stopped");
-    vTaskDelete(NULL);
+    task_status_apply(NULL);
 }
@@ -21,9 +21,4 @@
  */
 void task_wifi_event_callback(wifi_manager_event_t event, void *data);
 
-/**
- * @brief Initialize WiFi connecting task
- */
-esp_err_t task_wifi_set_wifi_connecting_init(void);
-
 #endif /* TASK_WIFI_H */
\ No newline at end of file
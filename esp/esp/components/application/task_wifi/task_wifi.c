@@ -8,25 +8,16 @@
 
 #include "task_wifi.h"
 #include "task_manager.h"
+#include "task_status.h"
 #include "mqtt_manager.h"
+#include "local_api.h"
+#include "app_state.h"
 #include "esp_log.h"
 
 /* PRIVATE VARIABLES --------------------------------------------------------*/
 
 static const char *TAG = "TASK_WIFI";
 
-bool isWiFiConnecting = false;
-
-static TaskHandle_t task_handle = NULL;
-static bool running = false;
-
-/* Private function prototypes -----------------------------------------------*/
-
-/**
- * @brief WiFi connecting task
- */
-static void task_wifi_set_wifi_connecting_task(void *pvParameters);
-
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -38,11 +29,14 @@ void task_wifi_event_callback(wifi_manager_event_t event, void *data)
     {
     case WIFI_EVENT_DISCONNECTED:
         ESP_LOGW(TAG, "Disconnected from network");
+        // Free port 80 before a failed reconnect falls back to provisioning,
+        // the server is started again on the next GOT_IP
+        local_api_stop();
         break;
 
     case WIFI_EVENT_CONNECTING:
         ESP_LOGI(TAG, "Connecting to network...");
-        isWiFiConnecting = true;
+        app_state_set_wifi_connecting(true);
         break;
 
     case WIFI_EVENT_CONNECTED:
@@ -54,7 +48,7 @@ void task_wifi_event_callback(wifi_manager_event_t event, void *data)
         esp_netif_ip_info_t ip_info;
         if (wifi_manager_get_ip_info(&ip_info) == ESP_OK)
         {
-            isWiFiConnecting = false;
+            app_state_set_wifi_connecting(false);
             ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&ip_info.ip));
             ESP_LOGI(TAG, "Gateway: " IPSTR, IP2STR(&ip_info.gw));
             ESP_LOGI(TAG, "Netmask: " IPSTR, IP2STR(&ip_info.netmask));
@@ -70,12 +64,23 @@ void task_wifi_event_callback(wifi_manager_event_t event, void *data)
             {
                 ESP_LOGE(TAG, "Failed to start MQTT client: %d", ret);
             }
+
+            // LAN control keeps working when the broker is unreachable
+            ret = local_api_start();
+            if (ret == ESP_OK)
+            {
+                task_mqtt_publish_current_state();
+            }
+            else if (ret != ESP_ERR_NOT_SUPPORTED)
+            {
+                ESP_LOGE(TAG, "Failed to start local API: %s", esp_err_to_name(ret));
+            }
         }
         break;
     }
 
     case WIFI_EVENT_PROVISIONING_STARTED:
-        isWiFiConnecting = false;
+        app_state_set_wifi_connecting(false);
         ESP_LOGI(TAG, "Provisioning started");
         ESP_LOGI(TAG, "AP SSID: %s", WIFI_AP_SSID);
         ESP_LOGI(TAG, "AP IP: 192.168.4.1");
@@ -96,55 +101,3 @@ void task_wifi_event_callback(wifi_manager_event_t event, void *data)
         break;
     }
 }
-
-/**
- * @brief Initialize WiFi connecting task
- */
-esp_err_t task_wifi_set_wifi_connecting_init(void)
-{
-    if (running)
-    {
-        ESP_LOGW(TAG, "Task WiFi connecting already initialized");
-        return ESP_OK;
-    }
-
-    // Start WiFi connecting task
-    running = true;
-    BaseType_t result = xTaskCreate(
-        task_wifi_set_wifi_connecting_task,
-        "wifi_connecting",
-        2048,
-        NULL,
-        5,
-        &task_handle);
-
-    if (result != pdPASS)
-    {
-        ESP_LOGE(TAG, "Failed to create WiFi connecting task");
-        running = false;
-        task_handle = NULL;
-        return ESP_FAIL;
-    }
-
-    ESP_LOGI(TAG, "Task WiFi connecting initialized");
-    return ESP_OK;
-}
-
-/* Private functions ----------------------------------------------------------*/
-
-/**
- * @brief WiFi connecting task
- */
-static void task_wifi_set_wifi_connecting_task(void *pvParameters)
-{
-    while (running)
-    {
-        if (isWiFiConnecting)
-        {
-            // Toggle LED blink state
-            isWiFi = !isWiFi;
-        }
-
-        vTaskDelay(pdMS_TO_TICKS(250));
-    }
-}
\ No newline at end of file
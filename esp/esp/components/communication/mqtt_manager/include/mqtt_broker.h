@@ -0,0 +1,139 @@
+/**
+ * @file mqtt_broker.h
+ *
+ * @brief Ordered broker list with RTT probing and selection
+ *
+ * The list comes from NVS when one was stored with mqtt_broker_set_list(),
+ * otherwise from Kconfig: MQTT_BROKER_URI followed by MQTT_BROKER_FALLBACKS.
+ * Each entry may start with mqtt:// or mqtts:// to pick its transport.
+ * A probe opens a separate MQTT session to a broker and times PINGREQ to
+ * PINGRESP. Selection prefers the healthy broker with the lowest smoothed
+ * RTT, earlier entries on ties.
+ */
+
+#ifndef MQTT_BROKER_H
+#define MQTT_BROKER_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define MQTT_BROKER_MAX          4  //!< Brokers in the list
+#define MQTT_BROKER_HOST_MAX_LEN 64 //!< Hostname length including NUL
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Broker entry with probe statistics
+ */
+typedef struct
+{
+    char host[MQTT_BROKER_HOST_MAX_LEN]; //!< Hostname or IP address
+    uint16_t port;                       //!< Broker port
+    bool tls;                            //!< mqtts:// entry, plain TCP otherwise
+    uint32_t srtt_us;                    //!< Smoothed PINGREQ RTT, 0 until probed
+    uint32_t last_rtt_us;                //!< RTT of the last successful probe
+    uint32_t probes;                     //!< Successful probes
+    uint16_t failures;                   //!< Consecutive failed probes or connects
+    bool healthy;                        //!< Last probe succeeded and not marked down
+} mqtt_broker_info_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Load the broker list from NVS or Kconfig
+ *
+ * The first entry becomes the active broker.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if no valid entry was found
+ */
+esp_err_t mqtt_broker_init(void);
+
+/**
+ * @brief Replace the broker list and store it in NVS
+ *
+ * @param[in] list Comma separated [scheme://]host[:port] entries. The
+ *                 scheme is mqtt:// or mqtts://, default port 1883 or 8883.
+ *                 Without a scheme the entry uses the MQTT_TRANSPORT choice
+ *                 and MQTT_BROKER_PORT. Empty restores the Kconfig list.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on a malformed or too long list
+ *
+ * @note The active broker keeps its place when it is still in the list,
+ *       otherwise no broker is active until mqtt_broker_select() picks one
+ */
+esp_err_t mqtt_broker_set_list(const char *list);
+
+/**
+ * @brief Number of brokers in the list
+ *
+ * @return Broker count
+ */
+int mqtt_broker_get_count(void);
+
+/**
+ * @brief Get a broker entry
+ *
+ * @param[in] index List index
+ * @param[out] info Destination
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for a bad index or NULL info
+ */
+esp_err_t mqtt_broker_get(int index, mqtt_broker_info_t *info);
+
+/**
+ * @brief Index of the active broker
+ *
+ * @return List index, -1 while none is active
+ */
+int mqtt_broker_get_active(void);
+
+/**
+ * @brief Set the active broker
+ *
+ * @param[in] index List index
+ */
+void mqtt_broker_set_active(int index);
+
+/**
+ * @brief Copy the active broker hostname
+ *
+ * @param[out] host Destination
+ * @param[in] len Destination size
+ */
+void mqtt_broker_get_active_host(char *host, size_t len);
+
+/**
+ * @brief Probe every broker and update its RTT and health
+ *
+ * Blocks for up to one connect timeout per unreachable broker.
+ */
+void mqtt_broker_probe_all(void);
+
+/**
+ * @brief Count a failed connect to a broker and mark it down
+ *
+ * @param[in] index List index
+ */
+void mqtt_broker_mark_down(int index);
+
+/**
+ * @brief Pick the broker to switch to
+ *
+ * Without failover the fastest healthy broker is returned only when it
+ * beats the active one by MQTT_BROKER_SWITCH_MARGIN_PERCENT, or when the
+ * active one is down. With failover any other healthy broker is taken,
+ * and the next entry in list order when none is known to be healthy.
+ *
+ * @param[in] failover The active broker stopped accepting connections
+ *
+ * @return List index to switch to, -1 to stay
+ */
+int mqtt_broker_select(bool failover);
+
+#endif /* MQTT_BROKER_H */
@@ -18,9 +18,22 @@
 // Broker configuration
 #define MQTT_BROKER_URI         CONFIG_MQTT_BROKER_URI
 #define MQTT_BROKER_PORT        CONFIG_MQTT_BROKER_PORT
+#define MQTT_BROKER_FALLBACKS   CONFIG_MQTT_BROKER_FALLBACKS
 #define MQTT_USERNAME           CONFIG_MQTT_USERNAME
 #define MQTT_PASSWORD           CONFIG_MQTT_PASSWORD
 
+// Broker probing and failover
+#define MQTT_BROKER_PROBE_INTERVAL_SEC    CONFIG_MQTT_BROKER_PROBE_INTERVAL_SEC
+#define MQTT_BROKER_PROBE_PINGS           CONFIG_MQTT_BROKER_PROBE_PINGS
+#define MQTT_BROKER_SWITCH_MARGIN_PERCENT CONFIG_MQTT_BROKER_SWITCH_MARGIN_PERCENT
+#define MQTT_BROKER_FAILOVER_ATTEMPTS     CONFIG_MQTT_BROKER_FAILOVER_ATTEMPTS
+
+// Metrics
+#define MQTT_METRICS_INTERVAL_SEC CONFIG_MQTT_METRICS_INTERVAL_SEC
+
+// History export
+#define MQTT_HISTORY_BLOCK_BYTES CONFIG_MQTT_HISTORY_BLOCK_BYTES
+
 // MQTT settings
 
 #define MQTT_QOS_0              0 // Fire and forget
@@ -35,5 +48,7 @@
 #define MQTT_TOPIC_INFO_FMT     "%s/%s/info"     //!< QoS=1, Retain=Yes
 #define MQTT_TOPIC_COMMAND_FMT  "%s/%s/command"  //!< QoS=1, Retain=No
 #define MQTT_TOPIC_RESPONSE_FMT "%s/%s/response" //!< QoS=1, Retain=Yes
+#define MQTT_TOPIC_METRICS_FMT  "%s/%s/metrics"  //!< QoS=0, Retain=No
+#define MQTT_TOPIC_HISTORY_FMT  "%s/%s/history"  //!< QoS=0, Retain=No
 
 #endif /* MQTT_CONFIG_H */
\ No newline at end of file
@@ -13,17 +13,9 @@
 #include "cJSON.h"
 #include "mqtt_config.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-/* Exported variables --------------------------------------------------------*/
-
-/**
- * @brief Global MQTT connection state
- *
- * @note true when MQTT client is connected to broker, false otherwise
- */
-extern bool isMQTT;
-
 /* Exported types ------------------------------------------------------------*/
 
 /**
@@ -132,6 +124,54 @@ esp_err_t mqtt_manager_publish_info(uint32_t timestamp, const char *device_id, c
  */
 esp_err_t mqtt_manager_publish_response(const char *cmd_id, const char *status);
 
+/**
+ * @brief Publish metrics to {base}/{device_id}/metrics
+ *
+ * @param[in] json Metrics payload, built by task_mqtt
+ *
+ * @return ESP_OK on success, error code otherwise
+ *
+ * @note QoS: 0, Retain: No, Frequency: MQTT_METRICS_INTERVAL_SEC
+ */
+esp_err_t mqtt_manager_publish_metrics(const char *json);
+
+/**
+ * @brief Bytes queued in the MQTT client outbox
+ *
+ * The outbox holds unacknowledged QoS 1 messages in esp-mqtt memory that
+ * heap_account cannot tag, so the metrics report its size instead.
+ *
+ * @return Outbox size in bytes, 0 before the client exists
+ */
+int mqtt_manager_get_outbox_size(void);
+
+/**
+ * @brief Publish a compressed history block to {base}/{device_id}/history
+ *
+ * @param[in] block Block from history_codec_encode()
+ * @param[in] len Block length
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not connected,
+ *         ESP_FAIL if the publish failed
+ *
+ * @note QoS: 0, Retain: No, Frequency: get_history command. Sent
+ *       directly, not through the outbox; the block sequence numbers
+ *       show losses.
+ */
+esp_err_t mqtt_manager_publish_history(const uint8_t *block, size_t len);
+
+/**
+ * @brief Replace the broker list
+ *
+ * @param[in] list Comma separated host[:port] entries, empty restores the Kconfig list
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on a malformed list
+ *
+ * @note Stored in NVS. The probe task reconnects when the active broker was
+ *       removed or a listed broker is faster.
+ */
+esp_err_t mqtt_manager_set_brokers(const char *list);
+
 /**
  * @brief Register callback for incoming commands
  *
@@ -0,0 +1,73 @@
+/**
+ * @file mqtt_tls_session.h
+ *
+ * @brief TLS transport with session resumption for the MQTT client
+ */
+
+#ifndef MQTT_TLS_SESSION_H
+#define MQTT_TLS_SESSION_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "esp_transport.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Handshake timing statistics
+ *
+ * esp_tls does not report whether the broker accepted a ticket, so handshakes
+ * are split by whether a cached session was offered. An offered handshake
+ * that took as long as a full one was not resumed.
+ */
+typedef struct
+{
+    uint32_t full_count;      //!< Handshakes without a cached session
+    uint32_t offered_count;   //!< Handshakes that offered a cached session
+    uint32_t failed_count;    //!< Failed connects (TCP or TLS)
+    uint32_t last_full_ms;    //!< Duration of the last full handshake
+    uint32_t last_offered_ms; //!< Duration of the last offered handshake
+    uint32_t avg_full_ms;     //!< Mean full handshake duration
+    uint32_t avg_offered_ms;  //!< Mean offered handshake duration
+    bool session_cached;      //!< A session is ready for the next connect
+} mqtt_tls_stats_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Create the TLS transport handed to the MQTT client
+ *
+ * @return Transport handle, NULL on allocation failure
+ *
+ * @note Owned by the MQTT client once passed in network.transport
+ */
+esp_transport_handle_t mqtt_tls_session_transport_create(void);
+
+/**
+ * @brief Select TLS or plain TCP for the next connect
+ *
+ * The MQTT client hands every connect to the custom transport whatever the
+ * URI scheme, so this follows the scheme of the active broker entry.
+ *
+ * @param[in] secure true for an mqtts:// broker, false for mqtt://
+ */
+void mqtt_tls_session_set_secure(bool secure);
+
+/**
+ * @brief Drop the cached session, the next connect does a full handshake
+ */
+void mqtt_tls_session_clear(void);
+
+/**
+ * @brief Get handshake timing statistics
+ *
+ * @param[out] stats Destination
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t mqtt_tls_session_get_stats(mqtt_tls_stats_t *stats);
+
+#endif /* MQTT_TLS_SESSION_H */
@@ -0,0 +1,846 @@
+/**
+ * @file mqtt_broker.c
+ *
+ * @brief Ordered broker list with RTT probing and selection
+ *
+ * A probe is a short MQTT 3.1.1 session of its own: CONNECT with a
+ * "-probe" client id (so the device session is not taken over), a few
+ * PINGREQ/PINGRESP round trips, DISCONNECT. The TCP or TLS setup is not
+ * part of the measured time.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "mqtt_broker.h"
+#include "mqtt_config.h"
+#include "heap_account.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_transport.h"
+#include "freertos/FreeRTOS.h"
+#include "nvs.h"
+#include "esp_transport_tcp.h"
+#if CONFIG_MQTT_TRANSPORT_TLS
+#include "esp_transport_ssl.h"
+#include "esp_crt_bundle.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define MQTT_BROKER_NVS_NAMESPACE "mqtt_broker"
+#define MQTT_BROKER_NVS_KEY       "list"
+
+#define MQTT_BROKER_LIST_MAX_LEN  (MQTT_BROKER_MAX * (MQTT_BROKER_HOST_MAX_LEN + 15))
+
+#define MQTT_BROKER_SCHEME_TCP    "mqtt://"
+#define MQTT_BROKER_SCHEME_TLS    "mqtts://"
+#define MQTT_BROKER_PORT_TCP      1883 //!< Default port of mqtt:// entries
+#define MQTT_BROKER_PORT_TLS      8883 //!< Default port of mqtts:// entries
+
+// Transport of entries without a scheme
+#if CONFIG_MQTT_TRANSPORT_TLS
+#define MQTT_BROKER_DEFAULT_TLS   true
+#else
+#define MQTT_BROKER_DEFAULT_TLS   false
+#endif
+
+#define MQTT_BROKER_PROBE_TIMEOUT_MS 5000 //!< Connect, CONNACK and PINGRESP timeout
+#define MQTT_BROKER_PROBE_KEEPALIVE  30   //!< Keep alive announced by the probe session
+#define MQTT_BROKER_PACKET_MAX       256  //!< CONNECT packet buffer
+
+// MQTT 3.1.1 control packets
+#define MQTT_PACKET_CONNECT    0x10
+#define MQTT_PACKET_CONNACK    0x20
+#define MQTT_PACKET_PINGREQ    0xC0
+#define MQTT_PACKET_PINGRESP   0xD0
+#define MQTT_PACKET_DISCONNECT 0xE0
+
+#define MQTT_CONNECT_CLEAN_SESSION 0x02
+#define MQTT_CONNECT_PASSWORD      0x40
+#define MQTT_CONNECT_USERNAME      0x80
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "MQTT_BROKER";
+
+static portMUX_TYPE broker_lock = portMUX_INITIALIZER_UNLOCKED;
+static mqtt_broker_info_t brokers[MQTT_BROKER_MAX];
+static int broker_count = 0;
+static int active_index = -1;
+static uint32_t list_version = 0; //!< Bumped on every list change, stale probes are dropped
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Parse a comma separated [scheme://]host[:port] list
+ *
+ * @param[in] list List string
+ * @param[out] out Parsed entries, statistics cleared
+ *
+ * @return Number of entries, -1 on a malformed entry or more than MQTT_BROKER_MAX
+ */
+static int mqtt_broker_parse(const char *list, mqtt_broker_info_t *out);
+
+/**
+ * @brief Build the broker list from Kconfig
+ *
+ * @param[out] out Parsed entries
+ *
+ * @return Number of entries, -1 on error
+ */
+static int mqtt_broker_parse_kconfig(mqtt_broker_info_t *out);
+
+/**
+ * @brief Read the stored list from NVS
+ *
+ * @param[out] list Destination
+ * @param[in] len Destination size
+ *
+ * @return ESP_OK when a list is stored
+ */
+static esp_err_t mqtt_broker_load(char *list, size_t len);
+
+/**
+ * @brief Store the list in NVS, an empty list erases it
+ *
+ * @param[in] list List string
+ *
+ * @return ESP_OK on success, NVS error otherwise
+ */
+static esp_err_t mqtt_broker_store(const char *list);
+
+/**
+ * @brief Build the probe CONNECT packet
+ *
+ * @param[out] buf Destination
+ * @param[in] size Destination size
+ *
+ * @return Packet length, -1 if the credentials do not fit
+ */
+static int mqtt_broker_build_connect(uint8_t *buf, size_t size);
+
+/**
+ * @brief Read exactly len bytes
+ *
+ * @param[in] t Connected transport
+ * @param[out] buf Destination
+ * @param[in] len Bytes to read
+ *
+ * @return true when all bytes arrived in time
+ */
+static bool mqtt_broker_read_exact(esp_transport_handle_t t, uint8_t *buf, int len);
+
+/**
+ * @brief Run one probe session on a connected transport
+ *
+ * @param[in] t Connected transport
+ * @param[out] rtt_us Lowest PINGREQ round trip
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_RESPONSE on a refused or
+ *         malformed reply, ESP_ERR_TIMEOUT when the broker stops answering
+ */
+static esp_err_t mqtt_broker_probe_session(esp_transport_handle_t t, uint32_t *rtt_us);
+
+/**
+ * @brief Probe one broker
+ *
+ * @param[in] host Broker hostname
+ * @param[in] port Broker port
+ * @param[in] tls Connect over TLS
+ * @param[out] rtt_us Lowest PINGREQ round trip
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t mqtt_broker_probe(const char *host, uint16_t port, bool tls, uint32_t *rtt_us);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Load the broker list from NVS or Kconfig
+ */
+esp_err_t mqtt_broker_init(void)
+{
+    mqtt_broker_info_t parsed[MQTT_BROKER_MAX];
+    char *list = heap_account_malloc(HEAP_ACCOUNT_MQTT, MQTT_BROKER_LIST_MAX_LEN);
+    int count = -1;
+
+    if (list != NULL && mqtt_broker_load(list, MQTT_BROKER_LIST_MAX_LEN) == ESP_OK)
+    {
+        count = mqtt_broker_parse(list, parsed);
+        if (count > 0)
+        {
+            ESP_LOGI(TAG, "Broker list from NVS: %s", list);
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Ignoring stored broker list: %s", list);
+        }
+    }
+    heap_account_free(HEAP_ACCOUNT_MQTT, list);
+
+    if (count <= 0)
+    {
+        count = mqtt_broker_parse_kconfig(parsed);
+    }
+
+    if (count <= 0)
+    {
+        ESP_LOGE(TAG, "No valid broker configured");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&broker_lock);
+    memcpy(brokers, parsed, sizeof(brokers));
+    broker_count = count;
+    active_index = 0;
+    list_version++;
+    portEXIT_CRITICAL(&broker_lock);
+
+    for (int i = 0; i < count; i++)
+    {
+        ESP_LOGI(TAG, "Broker %d: %s%s:%u", i, parsed[i].tls ? MQTT_BROKER_SCHEME_TLS : MQTT_BROKER_SCHEME_TCP,
+                 parsed[i].host, parsed[i].port);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Replace the broker list and store it in NVS
+ */
+esp_err_t mqtt_broker_set_list(const char *list)
+{
+    mqtt_broker_info_t parsed[MQTT_BROKER_MAX];
+    int count;
+
+    if (list == NULL || strlen(list) >= MQTT_BROKER_LIST_MAX_LEN)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    count = (list[0] == '\0') ? mqtt_broker_parse_kconfig(parsed) : mqtt_broker_parse(list, parsed);
+    if (count <= 0)
+    {
+        ESP_LOGW(TAG, "Invalid broker list: %s", list);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = mqtt_broker_store(list);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to store broker list: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    portENTER_CRITICAL(&broker_lock);
+    int next_active = -1;
+    if (active_index >= 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (parsed[i].port == brokers[active_index].port &&
+                parsed[i].tls == brokers[active_index].tls &&
+                strcmp(parsed[i].host, brokers[active_index].host) == 0)
+            {
+                // Keep what is known about the broker we are connected to
+                parsed[i] = brokers[active_index];
+                next_active = i;
+                break;
+            }
+        }
+    }
+    memcpy(brokers, parsed, sizeof(brokers));
+    broker_count = count;
+    active_index = next_active;
+    list_version++;
+    portEXIT_CRITICAL(&broker_lock);
+
+    ESP_LOGI(TAG, "Broker list set (%d entries), active %d", count, next_active);
+    return ESP_OK;
+}
+
+/**
+ * @brief Number of brokers in the list
+ */
+int mqtt_broker_get_count(void)
+{
+    portENTER_CRITICAL(&broker_lock);
+    int count = broker_count;
+    portEXIT_CRITICAL(&broker_lock);
+
+    return count;
+}
+
+/**
+ * @brief Get a broker entry
+ */
+esp_err_t mqtt_broker_get(int index, mqtt_broker_info_t *info)
+{
+    if (info == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&broker_lock);
+    if (index >= 0 && index < broker_count)
+    {
+        *info = brokers[index];
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&broker_lock);
+
+    return ret;
+}
+
+/**
+ * @brief Index of the active broker
+ */
+int mqtt_broker_get_active(void)
+{
+    portENTER_CRITICAL(&broker_lock);
+    int index = active_index;
+    portEXIT_CRITICAL(&broker_lock);
+
+    return index;
+}
+
+/**
+ * @brief Set the active broker
+ */
+void mqtt_broker_set_active(int index)
+{
+    portENTER_CRITICAL(&broker_lock);
+    if (index >= 0 && index < broker_count)
+    {
+        active_index = index;
+        brokers[index].failures = 0;
+    }
+    portEXIT_CRITICAL(&broker_lock);
+}
+
+/**
+ * @brief Copy the active broker hostname
+ */
+void mqtt_broker_get_active_host(char *host, size_t len)
+{
+    if (host == NULL || len == 0)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&broker_lock);
+    const char *src = (active_index >= 0) ? brokers[active_index].host : "";
+    strncpy(host, src, len - 1);
+    host[len - 1] = '\0';
+    portEXIT_CRITICAL(&broker_lock);
+}
+
+/**
+ * @brief Probe every broker and update its RTT and health
+ */
+void mqtt_broker_probe_all(void)
+{
+    int count = mqtt_broker_get_count();
+
+    for (int i = 0; i < count; i++)
+    {
+        mqtt_broker_info_t info;
+        uint32_t version;
+
+        portENTER_CRITICAL(&broker_lock);
+        version = list_version;
+        portEXIT_CRITICAL(&broker_lock);
+
+        if (mqtt_broker_get(i, &info) != ESP_OK)
+        {
+            break;
+        }
+
+        // No lock held while the network is slow
+        uint32_t rtt_us = 0;
+        esp_err_t ret = mqtt_broker_probe(info.host, info.port, info.tls, &rtt_us);
+
+        portENTER_CRITICAL(&broker_lock);
+        if (version == list_version)
+        {
+            mqtt_broker_info_t *b = &brokers[i];
+            if (ret == ESP_OK)
+            {
+                b->srtt_us = (b->srtt_us == 0) ? rtt_us : (3 * b->srtt_us + rtt_us) / 4;
+                b->last_rtt_us = rtt_us;
+                b->probes++;
+                b->failures = 0;
+                b->healthy = true;
+            }
+            else
+            {
+                if (b->failures < UINT16_MAX)
+                {
+                    b->failures++;
+                }
+                b->healthy = false;
+            }
+        }
+        portEXIT_CRITICAL(&broker_lock);
+
+        if (ret == ESP_OK)
+        {
+            ESP_LOGI(TAG, "Probe %s:%u: %lu us", info.host, info.port, (unsigned long)rtt_us);
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Probe %s:%u failed: %s", info.host, info.port, esp_err_to_name(ret));
+        }
+    }
+}
+
+/**
+ * @brief Count a failed connect to a broker and mark it down
+ */
+void mqtt_broker_mark_down(int index)
+{
+    portENTER_CRITICAL(&broker_lock);
+    if (index >= 0 && index < broker_count)
+    {
+        if (brokers[index].failures < UINT16_MAX)
+        {
+            brokers[index].failures++;
+        }
+        brokers[index].healthy = false;
+    }
+    portEXIT_CRITICAL(&broker_lock);
+}
+
+/**
+ * @brief Pick the broker to switch to
+ */
+int mqtt_broker_select(bool failover)
+{
+    int next = -1;
+
+    portENTER_CRITICAL(&broker_lock);
+
+    // Fastest healthy broker, the earlier one on a tie
+    int best = -1;
+    for (int i = 0; i < broker_count; i++)
+    {
+        if (!brokers[i].healthy || brokers[i].srtt_us == 0 || (failover && i == active_index))
+        {
+            continue;
+        }
+        if (best < 0 || brokers[i].srtt_us < brokers[best].srtt_us)
+        {
+            best = i;
+        }
+    }
+
+    if (active_index < 0)
+    {
+        // The list changed under us: fastest known, else the first entry
+        next = (best >= 0) ? best : 0;
+    }
+    else if (failover)
+    {
+        if (best >= 0)
+        {
+            next = best;
+        }
+        else if (broker_count > 1)
+        {
+            // Nothing known to work, walk the list in order
+            next = (active_index + 1) % broker_count;
+        }
+    }
+    else if (best >= 0 && best != active_index)
+    {
+        const mqtt_broker_info_t *active = &brokers[active_index];
+
+        if (!active->healthy)
+        {
+            next = best;
+        }
+        else if (active->srtt_us > 0 &&
+                 (uint64_t)brokers[best].srtt_us * 100 <=
+                     (uint64_t)active->srtt_us * (100 - MQTT_BROKER_SWITCH_MARGIN_PERCENT))
+        {
+            next = best;
+        }
+    }
+
+    portEXIT_CRITICAL(&broker_lock);
+
+    return next;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Parse a comma separated [scheme://]host[:port] list
+ */
+static int mqtt_broker_parse(const char *list, mqtt_broker_info_t *out)
+{
+    int count = 0;
+    const char *p = list;
+
+    memset(out, 0, sizeof(mqtt_broker_info_t) * MQTT_BROKER_MAX);
+
+    while (*p != '\0')
+    {
+        const char *end = strchr(p, ',');
+        size_t len = (end != NULL) ? (size_t)(end - p) : strlen(p);
+
+        // Trim blanks around the entry
+        while (len > 0 && *p == ' ')
+        {
+            p++;
+            len--;
+        }
+        while (len > 0 && p[len - 1] == ' ')
+        {
+            len--;
+        }
+
+        if (len > 0)
+        {
+            if (count == MQTT_BROKER_MAX)
+            {
+                return -1;
+            }
+
+            bool tls = MQTT_BROKER_DEFAULT_TLS;
+            long port = MQTT_BROKER_PORT;
+
+            if (len > strlen(MQTT_BROKER_SCHEME_TLS) &&
+                strncmp(p, MQTT_BROKER_SCHEME_TLS, strlen(MQTT_BROKER_SCHEME_TLS)) == 0)
+            {
+#if !CONFIG_MQTT_TRANSPORT_TLS
+                ESP_LOGW(TAG, "TLS is not built in, cannot use %.*s", (int)len, p);
+                return -1;
+#endif
+                tls = true;
+                port = MQTT_BROKER_PORT_TLS;
+                p += strlen(MQTT_BROKER_SCHEME_TLS);
+                len -= strlen(MQTT_BROKER_SCHEME_TLS);
+            }
+            else if (len > strlen(MQTT_BROKER_SCHEME_TCP) &&
+                     strncmp(p, MQTT_BROKER_SCHEME_TCP, strlen(MQTT_BROKER_SCHEME_TCP)) == 0)
+            {
+                tls = false;
+                port = MQTT_BROKER_PORT_TCP;
+                p += strlen(MQTT_BROKER_SCHEME_TCP);
+                len -= strlen(MQTT_BROKER_SCHEME_TCP);
+            }
+
+            const char *colon = memchr(p, ':', len);
+            size_t host_len = (colon != NULL) ? (size_t)(colon - p) : len;
+
+            if (colon != NULL)
+            {
+                char digits[8];
+                size_t digits_len = len - host_len - 1;
+                char *digits_end;
+
+                if (digits_len == 0 || digits_len >= sizeof(digits))
+                {
+                    return -1;
+                }
+                memcpy(digits, colon + 1, digits_len);
+                digits[digits_len] = '\0';
+                port = strtol(digits, &digits_end, 10);
+                if (*digits_end != '\0')
+                {
+                    return -1;
+                }
+            }
+
+            if (host_len == 0 || host_len >= MQTT_BROKER_HOST_MAX_LEN || port <= 0 || port > 65535)
+            {
+                return -1;
+            }
+
+            memcpy(out[count].host, p, host_len);
+            out[count].host[host_len] = '\0';
+            out[count].port = (uint16_t)port;
+            out[count].tls = tls;
+            out[count].healthy = true; // Until a probe or connect says otherwise
+            count++;
+        }
+
+        if (end == NULL)
+        {
+            break;
+        }
+        p = end + 1;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Build the broker list from Kconfig
+ */
+static int mqtt_broker_parse_kconfig(mqtt_broker_info_t *out)
+{
+    char list[MQTT_BROKER_LIST_MAX_LEN];
+
+    int len = snprintf(list, sizeof(list), "%s,%s", MQTT_BROKER_URI, MQTT_BROKER_FALLBACKS);
+    if (len < 0 || len >= (int)sizeof(list))
+    {
+        return -1;
+    }
+
+    return mqtt_broker_parse(list, out);
+}
+
+/**
+ * @brief Read the stored list from NVS
+ */
+static esp_err_t mqtt_broker_load(char *list, size_t len)
+{
+    nvs_handle_t handle;
+
+    esp_err_t ret = nvs_open(MQTT_BROKER_NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    ret = nvs_get_str(handle, MQTT_BROKER_NVS_KEY, list, &len);
+    nvs_close(handle);
+
+    return ret;
+}
+
+/**
+ * @brief Store the list in NVS
+ */
+static esp_err_t mqtt_broker_store(const char *list)
+{
+    nvs_handle_t handle;
+
+    esp_err_t ret = nvs_open(MQTT_BROKER_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    if (list[0] == '\0')
+    {
+        ret = nvs_erase_key(handle, MQTT_BROKER_NVS_KEY);
+        if (ret == ESP_ERR_NVS_NOT_FOUND)
+        {
+            ret = ESP_OK;
+        }
+    }
+    else
+    {
+        ret = nvs_set_str(handle, MQTT_BROKER_NVS_KEY, list);
+    }
+
+    if (ret == ESP_OK)
+    {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+
+    return ret;
+}
+
+/**
+ * @brief Build the probe CONNECT packet
+ */
+static int mqtt_broker_build_connect(uint8_t *buf, size_t size)
+{
+    const char *client_id = MQTT_DEVICE_ID "-probe";
+    const char *username = MQTT_USERNAME;
+    const char *password = MQTT_PASSWORD;
+    size_t id_len = strlen(client_id);
+    size_t user_len = strlen(username);
+    size_t pass_len = (user_len > 0) ? strlen(password) : 0; // No password without username
+    uint8_t flags = MQTT_CONNECT_CLEAN_SESSION;
+
+    // Protocol name, level, flags, keep alive, then the payload strings
+    size_t remaining = 10 + 2 + id_len;
+    if (user_len > 0)
+    {
+        flags |= MQTT_CONNECT_USERNAME;
+        remaining += 2 + user_len;
+    }
+    if (pass_len > 0)
+    {
+        flags |= MQTT_CONNECT_PASSWORD;
+        remaining += 2 + pass_len;
+    }
+
+    // Two length bytes cover anything that fits the buffer
+    if (remaining + 3 > size || remaining > 16383)
+    {
+        return -1;
+    }
+
+    size_t pos = 0;
+    buf[pos++] = MQTT_PACKET_CONNECT;
+    if (remaining > 127)
+    {
+        buf[pos++] = (uint8_t)((remaining & 0x7F) | 0x80);
+        buf[pos++] = (uint8_t)(remaining >> 7);
+    }
+    else
+    {
+        buf[pos++] = (uint8_t)remaining;
+    }
+
+    const uint8_t header[] = {0x00, 0x04, 'M', 'Q', 'T', 'T', 0x04, flags,
+                              0x00, MQTT_BROKER_PROBE_KEEPALIVE};
+    memcpy(&buf[pos], header, sizeof(header));
+    pos += sizeof(header);
+
+    const char *fields[] = {client_id, username, password};
+    const size_t lengths[] = {id_len, user_len, pass_len};
+    for (int i = 0; i < 3; i++)
+    {
+        if (i > 0 && lengths[i] == 0)
+        {
+            continue;
+        }
+        buf[pos++] = (uint8_t)(lengths[i] >> 8);
+        buf[pos++] = (uint8_t)(lengths[i] & 0xFF);
+        memcpy(&buf[pos], fields[i], lengths[i]);
+        pos += lengths[i];
+    }
+
+    return (int)pos;
+}
+
+/**
+ * @brief Read exactly len bytes
+ */
+static bool mqtt_broker_read_exact(esp_transport_handle_t t, uint8_t *buf, int len)
+{
+    int64_t deadline = esp_timer_get_time() + (int64_t)MQTT_BROKER_PROBE_TIMEOUT_MS * 1000;
+    int got = 0;
+
+    while (got < len)
+    {
+        int wait_ms = (int)((deadline - esp_timer_get_time()) / 1000);
+        if (wait_ms <= 0)
+        {
+            return false;
+        }
+
+        int n = esp_transport_read(t, (char *)&buf[got], len - got, wait_ms);
+        if (n < 0)
+        {
+            return false;
+        }
+        got += n;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Run one probe session on a connected transport
+ */
+static esp_err_t mqtt_broker_probe_session(esp_transport_handle_t t, uint32_t *rtt_us)
+{
+    uint8_t packet[MQTT_BROKER_PACKET_MAX];
+    uint8_t reply[4];
+
+    int len = mqtt_broker_build_connect(packet, sizeof(packet));
+    if (len < 0)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (esp_transport_write(t, (const char *)packet, len, MQTT_BROKER_PROBE_TIMEOUT_MS) != len)
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    // CONNACK: type, length 2, session present, return code
+    if (!mqtt_broker_read_exact(t, reply, 4))
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (reply[0] != MQTT_PACKET_CONNACK || reply[1] != 0x02 || reply[3] != 0x00)
+    {
+        ESP_LOGW(TAG, "Probe CONNACK refused: 0x%02x", reply[3]);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    const uint8_t pingreq[2] = {MQTT_PACKET_PINGREQ, 0x00};
+    uint32_t best = UINT32_MAX;
+
+    for (int i = 0; i < MQTT_BROKER_PROBE_PINGS; i++)
+    {
+        int64_t start = esp_timer_get_time();
+
+        if (esp_transport_write(t, (const char *)pingreq, sizeof(pingreq), MQTT_BROKER_PROBE_TIMEOUT_MS) != sizeof(pingreq) ||
+            !mqtt_broker_read_exact(t, reply, 2))
+        {
+            return ESP_ERR_TIMEOUT;
+        }
+        if (reply[0] != MQTT_PACKET_PINGRESP || reply[1] != 0x00)
+        {
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    const uint8_t disconnect[2] = {MQTT_PACKET_DISCONNECT, 0x00};
+    esp_transport_write(t, (const char *)disconnect, sizeof(disconnect), MQTT_BROKER_PROBE_TIMEOUT_MS);
+
+    // A zero RTT would read as "not probed"
+    *rtt_us = (best > 0) ? best : 1;
+    return ESP_OK;
+}
+
+/**
+ * @brief Probe one broker
+ */
+static esp_err_t mqtt_broker_probe(const char *host, uint16_t port, bool tls, uint32_t *rtt_us)
+{
+    esp_transport_handle_t t;
+
+#if CONFIG_MQTT_TRANSPORT_TLS
+    if (tls)
+    {
+        // No session ticket: every probe is a full handshake
+        t = esp_transport_ssl_init();
+        if (t != NULL)
+        {
+            esp_transport_ssl_crt_bundle_attach(t, esp_crt_bundle_attach);
+        }
+    }
+    else
+#endif
+    {
+        t = esp_transport_tcp_init();
+    }
+
+    if (t == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = ESP_FAIL;
+    if (esp_transport_connect(t, host, port, MQTT_BROKER_PROBE_TIMEOUT_MS) == 0)
+    {
+        ret = mqtt_broker_probe_session(t, rtt_us);
+        esp_transport_close(t);
+    }
+
+    esp_transport_destroy(t);
+    return ret;
+}
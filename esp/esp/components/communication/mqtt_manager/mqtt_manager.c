@@ -7,11 +7,22 @@
 /* Includes ------------------------------------------------------------------*/
 
 #include "mqtt_manager.h"
+#include "mqtt_tls_session.h"
+#include "mqtt_broker.h"
 #include "json_helper.h"
+#include "heap_account.h"
+#include "task_registry.h"
+#include "app_state.h"
 #include "mqtt_client.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#if CONFIG_MQTT_TRANSPORT_TLS
 #include "esp_crt_bundle.h"
+#endif
+#include <stdio.h>
 #include <string.h>
 
 /* Private defines -----------------------------------------------------------*/
@@ -20,10 +31,7 @@
 #define MQTT_TOPIC_MAX_LEN 128
 #define MQTT_CMD_ID_MAX_LEN 128
 #define MQTT_CMD_MAX_LEN 32
-
-/* Exported variables --------------------------------------------------------*/
-
-bool isMQTT = false; //!< Global MQTT connection state indicator
+#define MQTT_URI_MAX_LEN (MQTT_BROKER_HOST_MAX_LEN + 16)
 
 /* Private variables ---------------------------------------------------------*/
 
@@ -31,6 +39,17 @@ static const char *TAG = "MQTT_MANAGER";
 
 static esp_mqtt_client_handle_t mqtt_client = NULL;
 static bool mqtt_connected = false;
+static bool mqtt_started = false; //!< Client started by mqtt_manager_start()
+
+// Serializes start, stop and broker switches
+static SemaphoreHandle_t client_mutex = NULL;
+static StaticSemaphore_t client_mutex_buffer;
+
+// Broker probing and failover
+static TaskHandle_t probe_task_handle = NULL;
+TASK_REGISTRY_STORAGE(probe_task, TASK_STACK_MQTT_PROBE);
+static int connect_failures = 0;                 //!< Disconnects since the last CONNACK, MQTT task only
+static volatile bool failover_requested = false; //!< Set by the MQTT task, read by the probe task
 
 // Event callbacks
 static mqtt_event_callback_t connected_callback = NULL;
@@ -45,6 +64,8 @@ static char topic_state[MQTT_TOPIC_MAX_LEN];    //!< QoS=1, Retain=Yes
 static char topic_info[MQTT_TOPIC_MAX_LEN];     //!< QoS=1, Retain=Yes
 static char topic_command[MQTT_TOPIC_MAX_LEN];  //!< F QoS=1, Retain=No
 static char topic_response[MQTT_TOPIC_MAX_LEN]; //!< QoS=1, Retain=Yes
+static char topic_metrics[MQTT_TOPIC_MAX_LEN];  //!< QoS=0, Retain=No
+static char topic_history[MQTT_TOPIC_MAX_LEN];  //!< QoS=0, Retain=No
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -60,6 +81,34 @@ static void mqtt_manager_build_topics(void);
  */
 static void mqtt_manager_handle_command(const char *json_str);
 
+/**
+ * @brief Point the client at another broker and reconnect
+ *
+ * Reuses the client, so QoS 1 messages still in its outbox are sent to the
+ * new broker once it connects.
+ *
+ * @param[in] index Broker list index
+ *
+ * @return ESP_OK on success, error code otherwise
+ *
+ * @note Must not run on the MQTT task, stopping the client joins it
+ */
+static esp_err_t mqtt_manager_switch_broker(int index);
+
+/**
+ * @brief Probe brokers periodically and switch on failover or a faster broker
+ *
+ * @param[in] arg Not used
+ */
+static void mqtt_manager_probe_task(void *arg);
+
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+/**
+ * @brief Log full vs session offered TLS handshake times
+ */
+static void mqtt_manager_log_tls_stats(void);
+#endif
+
 /**
  * @brief MQTT event handler
  *
@@ -81,21 +130,41 @@ esp_err_t mqtt_manager_init(void)
     ESP_LOGI(TAG, "Initializing MQTT Manager");
 
     ESP_LOGI(TAG, "Device ID: %s", MQTT_DEVICE_ID);
-    ESP_LOGI(TAG, "Broker: %s", MQTT_BROKER_URI);
-    ESP_LOGI(TAG, "Broker Port: %d", MQTT_BROKER_PORT);
+
+    client_mutex = xSemaphoreCreateMutexStatic(&client_mutex_buffer);
+    if (client_mutex == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create client mutex");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = mqtt_broker_init();
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    mqtt_broker_info_t broker;
+    mqtt_broker_get(mqtt_broker_get_active(), &broker);
+
+    ESP_LOGI(TAG, "Broker: %s", broker.host);
+    ESP_LOGI(TAG, "Broker Port: %u (%s)", broker.port, broker.tls ? "TLS" : "TCP");
 
     mqtt_manager_build_topics();
 
     esp_mqtt_client_config_t mqtt_cfg = {
         .broker = {
             .address = {
-                .hostname = MQTT_BROKER_URI,
-                .transport = MQTT_TRANSPORT_OVER_SSL,
-                .port = MQTT_BROKER_PORT,
+                .hostname = broker.host,
+                .transport = broker.tls ? MQTT_TRANSPORT_OVER_SSL : MQTT_TRANSPORT_OVER_TCP,
+                .port = broker.port,
             },
+#if CONFIG_MQTT_TRANSPORT_TLS
             .verification = {
                 .crt_bundle_attach = esp_crt_bundle_attach,
-            }},
+            },
+#endif
+        },
         .credentials = {.client_id = MQTT_DEVICE_ID, .username = MQTT_USERNAME, .authentication = {
                                                                                     .password = MQTT_PASSWORD,
                                                                                 }},
@@ -103,8 +172,22 @@ esp_err_t mqtt_manager_init(void)
             .protocol_ver = MQTT_PROTOCOL_V_3_1_1,
             .keepalive = MQTT_KEEP_ALIVE_SEC,
             .disable_clean_session = 0,
+        },
+        // Core is fixed by CONFIG_MQTT_USE_CORE_0, priority by latency class
+        .task = {
+            .priority = TASK_PRIO_NETWORK,
         }};
 
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+    // Hostname, port and bundle stay in the config for the default transport
+    mqtt_cfg.network.transport = mqtt_tls_session_transport_create();
+    if (mqtt_cfg.network.transport == NULL)
+    {
+        ESP_LOGW(TAG, "Session transport unavailable, using default SSL transport");
+    }
+    mqtt_tls_session_set_secure(broker.tls);
+#endif
+
     mqtt_client = esp_mqtt_client_init(&mqtt_cfg);
 
     if (mqtt_client == NULL)
@@ -116,6 +199,14 @@ esp_err_t mqtt_manager_init(void)
     esp_mqtt_client_register_event(mqtt_client, ESP_EVENT_ANY_ID,
                                    mqtt_manager_event_handler, NULL);
 
+    ret = task_registry_create_static(TASK_ID_MQTT_PROBE, mqtt_manager_probe_task, NULL,
+                                      probe_task_stack, &probe_task_tcb, &probe_task_handle);
+    if (ret != ESP_OK)
+    {
+        // Not fatal: the client stays on the first broker
+        ESP_LOGW(TAG, "Failed to create broker probe task, failover disabled");
+    }
+
     ESP_LOGI(TAG, "MQTT Manager initialized successfully");
     return ESP_OK;
 }
@@ -131,7 +222,17 @@ esp_err_t mqtt_manager_start(void)
         return ESP_FAIL;
     }
 
-    esp_err_t ret = esp_mqtt_client_start(mqtt_client);
+    xSemaphoreTake(client_mutex, portMAX_DELAY);
+
+    esp_err_t ret = ESP_OK;
+    if (!mqtt_started)
+    {
+        ret = esp_mqtt_client_start(mqtt_client);
+        mqtt_started = (ret == ESP_OK);
+    }
+
+    xSemaphoreGive(client_mutex);
+
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "MQTT client start failed: %s", esp_err_to_name(ret));
@@ -152,9 +253,17 @@ esp_err_t mqtt_manager_stop(void)
         return ESP_OK;
     }
 
-    esp_mqtt_client_stop(mqtt_client);
+    xSemaphoreTake(client_mutex, portMAX_DELAY);
+
+    if (mqtt_started)
+    {
+        esp_mqtt_client_stop(mqtt_client);
+        mqtt_started = false;
+    }
     mqtt_connected = false;
-    isMQTT = false; // Update global state
+    app_state_set_mqtt_connected(false);
+
+    xSemaphoreGive(client_mutex);
 
     ESP_LOGI(TAG, "MQTT client stopped");
     return ESP_OK;
@@ -195,7 +304,7 @@ esp_err_t mqtt_manager_publish_data(uint32_t timestamp, float temperature, float
         ESP_LOGE(TAG, "Failed to publish data");
     }
 
-    free(json);
+    cJSON_free(json);
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
@@ -226,7 +335,7 @@ esp_err_t mqtt_manager_publish_state(uint32_t timestamp, int mode, int interval,
         ESP_LOGE(TAG, "Failed to publish state");
     }
 
-    free(json);
+    cJSON_free(json);
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
@@ -258,7 +367,7 @@ esp_err_t mqtt_manager_publish_info(uint32_t timestamp, const char *device_id, c
         ESP_LOGE(TAG, "Failed to publish info");
     }
 
-    free(json);
+    cJSON_free(json);
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
@@ -289,10 +398,89 @@ esp_err_t mqtt_manager_publish_response(const char *cmd_id, const char *status)
         ESP_LOGE(TAG, "Failed to publish response");
     }
 
-    free(json);
+    cJSON_free(json);
+    return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Publish metrics
+ */
+esp_err_t mqtt_manager_publish_metrics(const char *json)
+{
+    if (json == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!mqtt_connected)
+    {
+        ESP_LOGD(TAG, "MQTT not connected, skipping metrics publish");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Publish to metrics topic (QoS=0, no retain)
+    int msg_id = esp_mqtt_client_publish(mqtt_client, topic_metrics, json, 0,
+                                         MQTT_QOS_0, MQTT_RETAIN_OFF);
+
+    if (msg_id < 0)
+    {
+        ESP_LOGE(TAG, "Failed to publish metrics");
+    }
+
     return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
 }
 
+/**
+ * @brief Bytes queued in the MQTT client outbox
+ */
+int mqtt_manager_get_outbox_size(void)
+{
+    // Outbox memory belongs to esp-mqtt and cannot be tagged, report its size
+    return (mqtt_client != NULL) ? esp_mqtt_client_get_outbox_size(mqtt_client) : 0;
+}
+
+/**
+ * @brief Publish a compressed history block
+ */
+esp_err_t mqtt_manager_publish_history(const uint8_t *block, size_t len)
+{
+    if (!mqtt_connected)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Binary payload, QoS 0 keeps the blocks out of the outbox
+    int msg_id = esp_mqtt_client_publish(mqtt_client, topic_history, (const char *)block, (int)len,
+                                         MQTT_QOS_0, MQTT_RETAIN_OFF);
+
+    if (msg_id < 0)
+    {
+        ESP_LOGE(TAG, "Failed to publish history block");
+    }
+
+    return (msg_id >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Replace the broker list
+ */
+esp_err_t mqtt_manager_set_brokers(const char *list)
+{
+    esp_err_t ret = mqtt_broker_set_list(list);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    // Probe the new list and move if the active broker is gone or slower
+    if (probe_task_handle != NULL)
+    {
+        xTaskNotifyGive(probe_task_handle);
+    }
+
+    return ESP_OK;
+}
+
 /**
  * @brief Register command callback
  */
@@ -362,11 +550,25 @@ static void mqtt_manager_build_topics(void)
         ESP_LOGW(TAG, "Response topic truncated");
     }
 
+    ret = snprintf(topic_metrics, sizeof(topic_metrics), MQTT_TOPIC_METRICS_FMT, base, device_id);
+    if (ret >= sizeof(topic_metrics))
+    {
+        ESP_LOGW(TAG, "Metrics topic truncated");
+    }
+
+    ret = snprintf(topic_history, sizeof(topic_history), MQTT_TOPIC_HISTORY_FMT, base, device_id);
+    if (ret >= sizeof(topic_history))
+    {
+        ESP_LOGW(TAG, "History topic truncated");
+    }
+
     ESP_LOGI(TAG, "Data: %s (QoS=0, Retain=No)", topic_data);
     ESP_LOGI(TAG, "State: %s (QoS=1, Retain=Yes)", topic_state);
     ESP_LOGI(TAG, "Info: %s (QoS=1, Retain=Yes)", topic_info);
     ESP_LOGI(TAG, "Command: %s (QoS=1, Retain=No)", topic_command);
     ESP_LOGI(TAG, "Response: %s (QoS=1, Retain=Yes)", topic_response);
+    ESP_LOGI(TAG, "Metrics: %s (QoS=0, Retain=No)", topic_metrics);
+    ESP_LOGI(TAG, "History: %s (QoS=0, Retain=No)", topic_history);
 }
 
 /**
@@ -403,6 +605,26 @@ static void mqtt_manager_handle_command(const char *json_str)
     cJSON_Delete(root);
 }
 
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+/**
+ * @brief Log full vs session offered TLS handshake times
+ */
+static void mqtt_manager_log_tls_stats(void)
+{
+    mqtt_tls_stats_t stats;
+
+    if (mqtt_tls_session_get_stats(&stats) != ESP_OK)
+    {
+        return;
+    }
+
+    ESP_LOGI(TAG, "TLS handshakes: full %lu (avg %lu ms), session offered %lu (avg %lu ms), failed %lu",
+             (unsigned long)stats.full_count, (unsigned long)stats.avg_full_ms,
+             (unsigned long)stats.offered_count, (unsigned long)stats.avg_offered_ms,
+             (unsigned long)stats.failed_count);
+}
+#endif
+
 /**
  * @brief MQTT event handler
  */
@@ -415,9 +637,13 @@ static void mqtt_manager_event_handler(void *handler_args, esp_event_base_t base
     {
     case MQTT_EVENT_CONNECTED:
         ESP_LOGI(TAG, "MQTT Connected to broker");
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+        mqtt_manager_log_tls_stats();
+#endif
 
-        isMQTT = true; // Update global state
         mqtt_connected = true;
+        connect_failures = 0;
+        app_state_set_mqtt_connected(true);
 
         // Subscribe to command topic
         esp_mqtt_client_subscribe(mqtt_client, topic_command, MQTT_QOS_1);
@@ -433,8 +659,18 @@ static void mqtt_manager_event_handler(void *handler_args, esp_event_base_t base
     case MQTT_EVENT_DISCONNECTED:
         ESP_LOGW(TAG, "MQTT Disconnected");
 
-        isMQTT = false; // Update global state
         mqtt_connected = false;
+        app_state_set_mqtt_connected(false);
+
+        // The client retries the same broker; after enough misses hand
+        // over to the probe task, the switch cannot run on this task
+        if (++connect_failures >= MQTT_BROKER_FAILOVER_ATTEMPTS && probe_task_handle != NULL)
+        {
+            connect_failures = 0;
+            mqtt_broker_mark_down(mqtt_broker_get_active());
+            failover_requested = true;
+            xTaskNotifyGive(probe_task_handle);
+        }
 
         // Notify application
         if (disconnected_callback)
@@ -448,11 +684,11 @@ static void mqtt_manager_event_handler(void *handler_args, esp_event_base_t base
         if (event->topic_len == strlen(topic_command) &&
             strncmp(event->topic, topic_command, event->topic_len) == 0)
         {
-            char *json_str = strndup(event->data, event->data_len);
+            char *json_str = heap_account_strndup(HEAP_ACCOUNT_MQTT, event->data, event->data_len);
             if (json_str)
             {
                 mqtt_manager_handle_command(json_str);
-                free(json_str);
+                heap_account_free(HEAP_ACCOUNT_MQTT, json_str);
             }
             else
             {
@@ -465,8 +701,12 @@ static void mqtt_manager_event_handler(void *handler_args, esp_event_base_t base
         ESP_LOGE(TAG, "MQTT Error");
         if (event->error_handle->error_type == MQTT_ERROR_TYPE_TCP_TRANSPORT)
         {
+#if CONFIG_MQTT_TRANSPORT_TLS
             ESP_LOGE(TAG, "TLS error: 0x%x", event->error_handle->esp_tls_last_esp_err);
             ESP_LOGE(TAG, "TLS stack: 0x%x", event->error_handle->esp_tls_stack_err);
+#else
+            ESP_LOGE(TAG, "TCP transport error");
+#endif
             ESP_LOGE(TAG, "Socket errno: %d (%s)", event->error_handle->esp_transport_sock_errno,
                      strerror(event->error_handle->esp_transport_sock_errno));
         }
@@ -479,4 +719,110 @@ static void mqtt_manager_event_handler(void *handler_args, esp_event_base_t base
     default:
         break;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Point the client at another broker and reconnect
+ */
+static esp_err_t mqtt_manager_switch_broker(int index)
+{
+    mqtt_broker_info_t broker;
+    char uri[MQTT_URI_MAX_LEN];
+
+    esp_err_t ret = mqtt_broker_get(index, &broker);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    snprintf(uri, sizeof(uri), "%s://%s:%u", broker.tls ? "mqtts" : "mqtt", broker.host, broker.port);
+
+    xSemaphoreTake(client_mutex, portMAX_DELAY);
+
+    if (!mqtt_started)
+    {
+        // Stopped by the application, take the broker on the next start
+        ret = esp_mqtt_client_set_uri(mqtt_client, uri);
+        if (ret == ESP_OK)
+        {
+            mqtt_broker_set_active(index);
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+            mqtt_tls_session_set_secure(broker.tls);
+            mqtt_tls_session_clear();
+#endif
+        }
+        xSemaphoreGive(client_mutex);
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Switching broker to %s", uri);
+
+    esp_mqtt_client_stop(mqtt_client);
+    mqtt_connected = false;
+    app_state_set_mqtt_connected(false);
+
+    ret = esp_mqtt_client_set_uri(mqtt_client, uri);
+    if (ret == ESP_OK)
+    {
+        mqtt_broker_set_active(index);
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+        // The client keeps the session transport for every scheme, tell it which
+        mqtt_tls_session_set_secure(broker.tls);
+        // A ticket from the old broker would only cost a failed resumption
+        mqtt_tls_session_clear();
+#endif
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Invalid broker URI: %s", uri);
+    }
+
+    // Restart on the old broker if the URI was rejected
+    esp_err_t start_ret = esp_mqtt_client_start(mqtt_client);
+    mqtt_started = (start_ret == ESP_OK);
+
+    xSemaphoreGive(client_mutex);
+
+    if (start_ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "MQTT client restart failed: %s", esp_err_to_name(start_ret));
+        return start_ret;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Probe brokers periodically and switch on failover or a faster broker
+ */
+static void mqtt_manager_probe_task(void *arg)
+{
+    const TickType_t interval = (MQTT_BROKER_PROBE_INTERVAL_SEC > 0)
+                                    ? pdMS_TO_TICKS(MQTT_BROKER_PROBE_INTERVAL_SEC * 1000ULL)
+                                    : portMAX_DELAY;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, interval);
+
+        bool failover = failover_requested;
+        failover_requested = false;
+
+        if (!mqtt_started)
+        {
+            continue;
+        }
+
+        // A single broker has nothing to compare against
+        if (mqtt_broker_get_count() > 1)
+        {
+            mqtt_broker_probe_all();
+        }
+
+        int next = mqtt_broker_select(failover);
+        if (next >= 0)
+        {
+            mqtt_manager_switch_broker(next);
+        }
+    }
+}
@@ -0,0 +1,571 @@
+/**
+ * @file mqtt_tls_session.c
+ *
+ * @brief TLS transport with session resumption for the MQTT client
+ *
+ * esp_transport_ssl does not expose the esp_tls client session, so this is a
+ * thin esp_tls-backed transport: it offers the cached session ticket on every
+ * connect and refreshes it after each successful handshake. A resumed
+ * handshake skips certificate bundle verification and the key exchange.
+ * The MQTT client uses a custom transport for every URI scheme, so an
+ * mqtt:// broker in the list is reached through esp_tls in plain TCP mode.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "mqtt_tls_session.h"
+#include "heap_account.h"
+#include "esp_crt_bundle.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_tls.h"
+#include "freertos/FreeRTOS.h"
+#include "lwip/sockets.h"
+#include "mbedtls/ssl.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_MQTT_TLS_SESSION_RESUMPTION
+
+/* Private defines -----------------------------------------------------------*/
+
+#define MQTT_TLS_DEFAULT_PORT 8883
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Transport context
+ */
+typedef struct
+{
+    esp_tls_t *tls; //!< Active connection, NULL when closed
+} mqtt_tls_ctx_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "MQTT_TLS";
+
+// Session is only used from the MQTT task; other tasks request a discard
+static esp_tls_client_session_t *cached_session = NULL;
+static bool discard_requested = false;
+static bool use_tls = true; //!< Active broker is an mqtts:// entry
+
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static mqtt_tls_stats_t stats;
+static uint64_t total_full_ms = 0;
+static uint64_t total_offered_ms = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Connect and run the TLS handshake, offering the cached session
+ *
+ * @param[in] t Transport handle
+ * @param[in] host Broker hostname
+ * @param[in] port Broker port
+ * @param[in] timeout_ms Connect timeout
+ *
+ * @return 0 on success, -1 on failure
+ */
+static int mqtt_tls_connect(esp_transport_handle_t t, const char *host, int port, int timeout_ms);
+
+/**
+ * @brief Connect over plain TCP, for mqtt:// brokers
+ *
+ * @param[in] ctx Transport context
+ * @param[in] host Broker hostname
+ * @param[in] port Broker port
+ * @param[in] timeout_ms Connect timeout
+ *
+ * @return 0 on success, -1 on failure
+ */
+static int mqtt_tls_connect_plain(mqtt_tls_ctx_t *ctx, const char *host, int port, int timeout_ms);
+
+/**
+ * @brief Check whether a failed connect got as far as the TLS layer
+ *
+ * Only a handshake failure or an alert from the broker can mean the
+ * offered ticket was rejected; socket, DNS and timeout errors cannot.
+ *
+ * @param[in] tls Connection that failed, before it is destroyed
+ *
+ * @return true if the failure was a handshake error or an alert
+ */
+static bool mqtt_tls_handshake_failed(esp_tls_t *tls);
+
+/**
+ * @brief Read decrypted data
+ *
+ * @param[in] t Transport handle
+ * @param[out] buffer Destination
+ * @param[in] len Buffer size
+ * @param[in] timeout_ms Wait for data
+ *
+ * @return Bytes read, 0 on timeout, negative on error or close
+ */
+static int mqtt_tls_read(esp_transport_handle_t t, char *buffer, int len, int timeout_ms);
+
+/**
+ * @brief Write data
+ *
+ * @param[in] t Transport handle
+ * @param[in] buffer Data
+ * @param[in] len Data length
+ * @param[in] timeout_ms Wait for socket space
+ *
+ * @return Bytes written, 0 on timeout, negative on error
+ */
+static int mqtt_tls_write(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms);
+
+/**
+ * @brief Wait until the socket is readable
+ *
+ * @param[in] t Transport handle
+ * @param[in] timeout_ms Timeout
+ *
+ * @return >0 readable, 0 timeout, -1 error
+ */
+static int mqtt_tls_poll_read(esp_transport_handle_t t, int timeout_ms);
+
+/**
+ * @brief Wait until the socket is writable
+ *
+ * @param[in] t Transport handle
+ * @param[in] timeout_ms Timeout
+ *
+ * @return >0 writable, 0 timeout, -1 error
+ */
+static int mqtt_tls_poll_write(esp_transport_handle_t t, int timeout_ms);
+
+/**
+ * @brief Close the connection
+ *
+ * @param[in] t Transport handle
+ *
+ * @return 0
+ */
+static int mqtt_tls_close(esp_transport_handle_t t);
+
+/**
+ * @brief Close and free the context
+ *
+ * @param[in] t Transport handle
+ *
+ * @return 0
+ */
+static int mqtt_tls_destroy(esp_transport_handle_t t);
+
+/**
+ * @brief select() on the connection socket
+ *
+ * @param[in] ctx Transport context
+ * @param[in] write Wait for writable instead of readable
+ * @param[in] timeout_ms Timeout, negative waits forever
+ *
+ * @return >0 ready, 0 timeout, -1 error
+ */
+static int mqtt_tls_poll(mqtt_tls_ctx_t *ctx, bool write, int timeout_ms);
+
+/**
+ * @brief Record a handshake in the statistics
+ *
+ * @param[in] offered A cached session was offered
+ * @param[in] elapsed_ms Handshake duration
+ */
+static void mqtt_tls_record(bool offered, uint32_t elapsed_ms);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Create the TLS transport handed to the MQTT client
+ */
+esp_transport_handle_t mqtt_tls_session_transport_create(void)
+{
+    esp_transport_handle_t t = esp_transport_init();
+    mqtt_tls_ctx_t *ctx = heap_account_calloc(HEAP_ACCOUNT_MQTT, 1, sizeof(mqtt_tls_ctx_t));
+
+    if (t == NULL || ctx == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate transport");
+        heap_account_free(HEAP_ACCOUNT_MQTT, ctx);
+        if (t != NULL)
+        {
+            esp_transport_destroy(t);
+        }
+        return NULL;
+    }
+
+    esp_transport_set_context_data(t, ctx);
+    esp_transport_set_default_port(t, MQTT_TLS_DEFAULT_PORT);
+    esp_transport_set_func(t, mqtt_tls_connect, mqtt_tls_read, mqtt_tls_write, mqtt_tls_close,
+                           mqtt_tls_poll_read, mqtt_tls_poll_write, mqtt_tls_destroy);
+
+    return t;
+}
+
+/**
+ * @brief Select TLS or plain TCP for the next connect
+ */
+void mqtt_tls_session_set_secure(bool secure)
+{
+    portENTER_CRITICAL(&stats_lock);
+    use_tls = secure;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+/**
+ * @brief Drop the cached session
+ */
+void mqtt_tls_session_clear(void)
+{
+    // Freed by the MQTT task on its next connect, never while in use
+    portENTER_CRITICAL(&stats_lock);
+    discard_requested = true;
+    stats.session_cached = false;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+/**
+ * @brief Get handshake timing statistics
+ */
+esp_err_t mqtt_tls_session_get_stats(mqtt_tls_stats_t *out)
+{
+    if (out == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&stats_lock);
+    *out = stats;
+    portEXIT_CRITICAL(&stats_lock);
+
+    return ESP_OK;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Connect and run the TLS handshake, offering the cached session
+ */
+static int mqtt_tls_connect(esp_transport_handle_t t, const char *host, int port, int timeout_ms)
+{
+    mqtt_tls_ctx_t *ctx = esp_transport_get_context_data(t);
+
+    bool discard;
+    bool secure;
+    portENTER_CRITICAL(&stats_lock);
+    discard = discard_requested;
+    discard_requested = false;
+    secure = use_tls;
+    portEXIT_CRITICAL(&stats_lock);
+
+    if (discard && cached_session != NULL)
+    {
+        esp_tls_free_client_session(cached_session);
+        cached_session = NULL;
+    }
+
+    if (!secure)
+    {
+        return mqtt_tls_connect_plain(ctx, host, port, timeout_ms);
+    }
+
+    esp_tls_cfg_t cfg = {
+        .crt_bundle_attach = esp_crt_bundle_attach,
+        .timeout_ms = timeout_ms,
+        .client_session = cached_session,
+    };
+
+    ctx->tls = esp_tls_init();
+    if (ctx->tls == NULL)
+    {
+        return -1;
+    }
+
+    bool offered = (cached_session != NULL);
+    int64_t start = esp_timer_get_time();
+
+    if (esp_tls_conn_new_sync(host, strlen(host), port, &cfg, ctx->tls) != 1)
+    {
+        bool rejected = mqtt_tls_handshake_failed(ctx->tls);
+
+        esp_tls_conn_destroy(ctx->tls);
+        ctx->tls = NULL;
+
+        // A stale ticket must not keep failing: fall back to a full handshake.
+        // A lost link says nothing about the ticket, keep it for the retry.
+        if (rejected && cached_session != NULL)
+        {
+            esp_tls_free_client_session(cached_session);
+            cached_session = NULL;
+        }
+
+        portENTER_CRITICAL(&stats_lock);
+        stats.failed_count++;
+        stats.session_cached = (cached_session != NULL);
+        portEXIT_CRITICAL(&stats_lock);
+        return -1;
+    }
+
+    uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - start) / 1000);
+
+    // The broker may issue a new ticket on every handshake, keep the latest
+    esp_tls_client_session_t *session = esp_tls_get_client_session(ctx->tls);
+    if (session != NULL)
+    {
+        if (cached_session != NULL)
+        {
+            esp_tls_free_client_session(cached_session);
+        }
+        cached_session = session;
+    }
+
+    mqtt_tls_record(offered, elapsed_ms);
+
+    ESP_LOGI(TAG, "%s handshake in %lu ms", offered ? "Session offered," : "Full", (unsigned long)elapsed_ms);
+    return 0;
+}
+
+/**
+ * @brief Connect over plain TCP, for mqtt:// brokers
+ */
+static int mqtt_tls_connect_plain(mqtt_tls_ctx_t *ctx, const char *host, int port, int timeout_ms)
+{
+    esp_tls_cfg_t cfg = {
+        .timeout_ms = timeout_ms,
+        .is_plain_tcp = true,
+    };
+
+    ctx->tls = esp_tls_init();
+    if (ctx->tls == NULL)
+    {
+        return -1;
+    }
+
+    // No handshake, nothing for the statistics
+    if (esp_tls_conn_new_sync(host, strlen(host), port, &cfg, ctx->tls) != 1)
+    {
+        esp_tls_conn_destroy(ctx->tls);
+        ctx->tls = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Check whether a failed connect got as far as the TLS layer
+ */
+static bool mqtt_tls_handshake_failed(esp_tls_t *tls)
+{
+    esp_tls_error_handle_t error = NULL;
+
+    if (esp_tls_get_error_handle(tls, &error) != ESP_OK || error == NULL)
+    {
+        return false;
+    }
+
+    ESP_LOGW(TAG, "Connect failed: %s (mbedtls -0x%x)", esp_err_to_name(error->last_error),
+             error->esp_tls_error_code);
+
+    // esp_tls stores the mbedtls code negated
+    return error->last_error == ESP_ERR_MBEDTLS_SSL_HANDSHAKE_FAILED ||
+           error->esp_tls_error_code == -MBEDTLS_ERR_SSL_FATAL_ALERT_MESSAGE;
+}
+
+/**
+ * @brief Read decrypted data
+ */
+static int mqtt_tls_read(esp_transport_handle_t t, char *buffer, int len, int timeout_ms)
+{
+    mqtt_tls_ctx_t *ctx = esp_transport_get_context_data(t);
+
+    if (ctx->tls == NULL)
+    {
+        return ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+
+    // Records already decrypted by mbedTLS do not show up on the socket
+    if (esp_tls_get_bytes_avail(ctx->tls) <= 0)
+    {
+        int poll = mqtt_tls_poll(ctx, false, timeout_ms);
+        if (poll <= 0)
+        {
+            return poll;
+        }
+    }
+
+    int ret = esp_tls_conn_read(ctx->tls, buffer, len);
+
+    if (ret == ESP_TLS_ERR_SSL_WANT_READ || ret == ESP_TLS_ERR_SSL_TIMEOUT)
+    {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;
+    }
+
+    if (ret == 0)
+    {
+        return ERR_TCP_TRANSPORT_CONNECTION_CLOSED_BY_FIN;
+    }
+
+    return (ret < 0) ? ERR_TCP_TRANSPORT_CONNECTION_FAILED : ret;
+}
+
+/**
+ * @brief Write data
+ */
+static int mqtt_tls_write(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms)
+{
+    mqtt_tls_ctx_t *ctx = esp_transport_get_context_data(t);
+
+    if (ctx->tls == NULL)
+    {
+        return ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+
+    int poll = mqtt_tls_poll(ctx, true, timeout_ms);
+    if (poll <= 0)
+    {
+        return poll;
+    }
+
+    int ret = esp_tls_conn_write(ctx->tls, buffer, len);
+
+    if (ret == ESP_TLS_ERR_SSL_WANT_WRITE || ret == ESP_TLS_ERR_SSL_WANT_READ)
+    {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;
+    }
+
+    return (ret < 0) ? ERR_TCP_TRANSPORT_CONNECTION_FAILED : ret;
+}
+
+/**
+ * @brief Wait until the socket is readable
+ */
+static int mqtt_tls_poll_read(esp_transport_handle_t t, int timeout_ms)
+{
+    mqtt_tls_ctx_t *ctx = esp_transport_get_context_data(t);
+
+    if (ctx->tls != NULL && esp_tls_get_bytes_avail(ctx->tls) > 0)
+    {
+        return 1;
+    }
+
+    return mqtt_tls_poll(ctx, false, timeout_ms);
+}
+
+/**
+ * @brief Wait until the socket is writable
+ */
+static int mqtt_tls_poll_write(esp_transport_handle_t t, int timeout_ms)
+{
+    return mqtt_tls_poll(esp_transport_get_context_data(t), true, timeout_ms);
+}
+
+/**
+ * @brief Close the connection
+ */
+static int mqtt_tls_close(esp_transport_handle_t t)
+{
+    mqtt_tls_ctx_t *ctx = esp_transport_get_context_data(t);
+
+    if (ctx->tls != NULL)
+    {
+        esp_tls_conn_destroy(ctx->tls);
+        ctx->tls = NULL;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Close and free the context
+ */
+static int mqtt_tls_destroy(esp_transport_handle_t t)
+{
+    mqtt_tls_close(t);
+    heap_account_free(HEAP_ACCOUNT_MQTT, esp_transport_get_context_data(t));
+    esp_transport_set_context_data(t, NULL);
+
+    return 0;
+}
+
+/**
+ * @brief select() on the connection socket
+ */
+static int mqtt_tls_poll(mqtt_tls_ctx_t *ctx, bool write, int timeout_ms)
+{
+    int fd;
+
+    if (ctx->tls == NULL || esp_tls_get_conn_sockfd(ctx->tls, &fd) != ESP_OK || fd < 0)
+    {
+        return -1;
+    }
+
+    fd_set ready;
+    fd_set errors;
+    FD_ZERO(&ready);
+    FD_ZERO(&errors);
+    FD_SET(fd, &ready);
+    FD_SET(fd, &errors);
+
+    struct timeval timeout = {
+        .tv_sec = timeout_ms / 1000,
+        .tv_usec = (timeout_ms % 1000) * 1000,
+    };
+
+    int ret = select(fd + 1, write ? NULL : &ready, write ? &ready : NULL, &errors,
+                     (timeout_ms < 0) ? NULL : &timeout);
+
+    if (ret > 0 && FD_ISSET(fd, &errors))
+    {
+        int sock_errno = 0;
+        socklen_t optlen = sizeof(sock_errno);
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, &sock_errno, &optlen);
+        ESP_LOGE(TAG, "Socket error %d", sock_errno);
+        return -1;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Record a handshake in the statistics
+ */
+static void mqtt_tls_record(bool offered, uint32_t elapsed_ms)
+{
+    portENTER_CRITICAL(&stats_lock);
+    if (offered)
+    {
+        stats.offered_count++;
+        stats.last_offered_ms = elapsed_ms;
+        total_offered_ms += elapsed_ms;
+        stats.avg_offered_ms = (uint32_t)(total_offered_ms / stats.offered_count);
+    }
+    else
+    {
+        stats.full_count++;
+        stats.last_full_ms = elapsed_ms;
+        total_full_ms += elapsed_ms;
+        stats.avg_full_ms = (uint32_t)(total_full_ms / stats.full_count);
+    }
+    stats.session_cached = (cached_session != NULL) && !discard_requested;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+#else /* CONFIG_MQTT_TLS_SESSION_RESUMPTION */
+
+esp_transport_handle_t mqtt_tls_session_transport_create(void)
+{
+    return NULL;
+}
+
+void mqtt_tls_session_clear(void)
+{
+}
+
+esp_err_t mqtt_tls_session_get_stats(mqtt_tls_stats_t *stats)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif /* CONFIG_MQTT_TLS_SESSION_RESUMPTION */
@@ -0,0 +1,89 @@
+/**
+ * @file ota_manager.h
+ *
+ * @brief OTA Manager API - streaming, resumable full and delta updates
+ */
+
+#ifndef OTA_MANAGER_H
+#define OTA_MANAGER_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define OTA_MANAGER_URL_MAX_LEN    256 //!< Image URL including query
+#define OTA_MANAGER_CMD_ID_MAX_LEN 64  //!< Command ID echoed in the result
+#define OTA_MANAGER_SIG_MAX_LEN    512 //!< DER signature (RSA-4096 fits)
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Result callback, invoked from the OTA task when an update ends
+ *
+ * @param cmd_id Command ID that started the update
+ * @param result ESP_OK when the new image is set as boot partition
+ */
+typedef void (*ota_manager_result_cb_t)(const char *cmd_id, esp_err_t result);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize OTA manager
+ *
+ * @return ESP_OK on success, error code otherwise
+ *
+ * @note Logs the running partition and any pending download checkpoint
+ */
+esp_err_t ota_manager_init(void);
+
+/**
+ * @brief Start an update in the background
+ *
+ * A full image or a delta against the running image is detected from the
+ * stream. An interrupted download of the same image (same URL and SHA-256)
+ * resumes from the last checkpoint, also after a reboot.
+ *
+ * @param[in] cmd_id Command ID passed back to the result callback
+ * @param[in] url HTTP(S) URL of the image or delta
+ * @param[in] sha256_hex SHA-256 of the resulting image, 64 hex chars
+ * @param[in] signature_hex Signature over that SHA-256 (hex DER), required
+ *
+ * @return
+ *      - ESP_OK if the update task was started
+ *      - ESP_ERR_INVALID_ARG on a malformed argument
+ *      - ESP_ERR_INVALID_STATE if an update is already running
+ *      - ESP_ERR_NOT_FOUND if there is no OTA partition to write
+ *      - ESP_ERR_NOT_SUPPORTED when CONFIG_OTA_MANAGER_VERIFY_SIGNATURE is off
+ */
+esp_err_t ota_manager_start(const char *cmd_id, const char *url,
+                            const char *sha256_hex, const char *signature_hex);
+
+/**
+ * @brief Check if an update is running
+ *
+ * @return true while the OTA task is active
+ */
+bool ota_manager_is_running(void);
+
+/**
+ * @brief Register the result callback
+ *
+ * @param[in] callback Function called when an update ends
+ */
+void ota_manager_register_result_callback(ota_manager_result_cb_t callback);
+
+/**
+ * @brief Confirm the running image after an update
+ *
+ * Cancels the bootloader rollback. Call once the image has proven itself
+ * (the application calls it on the first broker connection).
+ *
+ * @return ESP_OK on success or if nothing was pending
+ */
+esp_err_t ota_manager_mark_valid(void);
+
+#endif /* OTA_MANAGER_H */
@@ -0,0 +1,130 @@
+/**
+ * @file ota_patch.h
+ *
+ * @brief Streaming decoder for full and delta OTA images
+ *
+ * Delta format (little-endian), generated by tools/ota_tool.py:
+ *
+ *     header  "SHD1" | base SHA-256 (32) | target size (u32)
+ *     COPY    0x01 | base offset (u32) | length (u32)
+ *     INSERT  0x02 | length (u32) | data
+ *     END     0x00
+ *
+ * Any stream that does not start with the magic is treated as a full image.
+ */
+
+#ifndef OTA_PATCH_H
+#define OTA_PATCH_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "esp_partition.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define OTA_PATCH_MAGIC       "SHD1"
+#define OTA_PATCH_MAGIC_SIZE  4
+#define OTA_PATCH_HEADER_SIZE 40 //!< Magic + base SHA-256 + target size
+
+#define OTA_PATCH_OP_END    0x00
+#define OTA_PATCH_OP_COPY   0x01
+#define OTA_PATCH_OP_INSERT 0x02
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Decoder phase
+ */
+typedef enum
+{
+    OTA_PATCH_PHASE_DETECT = 0, //!< Collecting the first bytes
+    OTA_PATCH_PHASE_RAW_PENDING,//!< Full image, emitting the detection bytes
+    OTA_PATCH_PHASE_RAW,        //!< Full image pass-through
+    OTA_PATCH_PHASE_HEADER,     //!< Collecting the delta header
+    OTA_PATCH_PHASE_OP,         //!< Collecting an op header
+    OTA_PATCH_PHASE_COPY,       //!< Copying from the running image
+    OTA_PATCH_PHASE_INSERT,     //!< Copying literal data from the stream
+    OTA_PATCH_PHASE_DONE        //!< END op reached
+} ota_patch_phase_t;
+
+/**
+ * @brief Decoder state
+ *
+ * Plain data so it can be stored in a download checkpoint as-is.
+ */
+typedef struct
+{
+    uint8_t phase;                        //!< ota_patch_phase_t
+    uint8_t hdr_len;                      //!< Bytes collected in hdr
+    uint8_t hdr[OTA_PATCH_HEADER_SIZE];   //!< Header / op header bytes
+    uint32_t src_offset;                  //!< COPY: next offset in the base image
+    uint32_t remaining;                   //!< Bytes left in the current op
+    uint32_t target_size;                 //!< Delta: output size, 0 for full images
+} ota_patch_state_t;
+
+/**
+ * @brief Running image used as the delta base
+ */
+typedef struct
+{
+    const esp_partition_t *partition; //!< Running app partition
+    uint8_t sha256[32];               //!< SHA-256 of the running image
+} ota_patch_base_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Reset decoder state for a new stream
+ *
+ * @param[out] state Decoder state
+ */
+void ota_patch_init(ota_patch_state_t *state);
+
+/**
+ * @brief Decode as much as fits into the output buffer
+ *
+ * Stops when the input is consumed, the output buffer is full or the END op
+ * is reached. The state is consistent with consumed/produced on return.
+ *
+ * @param[in,out] state Decoder state
+ * @param[in] base Running image for COPY ops
+ * @param[in] in Input bytes
+ * @param[in] in_len Input length
+ * @param[out] consumed Input bytes consumed
+ * @param[out] out Output buffer
+ * @param[in] out_cap Output buffer capacity
+ * @param[out] produced Output bytes produced
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_VERSION if the delta was built for another base image
+ *      - ESP_ERR_INVALID_RESPONSE on a malformed op
+ *      - Flash read error from a COPY op
+ */
+esp_err_t ota_patch_decode(ota_patch_state_t *state, const ota_patch_base_t *base,
+                           const uint8_t *in, size_t in_len, size_t *consumed,
+                           uint8_t *out, size_t out_cap, size_t *produced);
+
+/**
+ * @brief Check if the END op of a delta has been reached
+ *
+ * @param[in] state Decoder state
+ *
+ * @return true when the delta is complete
+ */
+bool ota_patch_is_done(const ota_patch_state_t *state);
+
+/**
+ * @brief Check if the stream is a delta
+ *
+ * @param[in] state Decoder state
+ *
+ * @return true once the delta header has been detected
+ */
+bool ota_patch_is_delta(const ota_patch_state_t *state);
+
+#endif /* OTA_PATCH_H */
@@ -0,0 +1,853 @@
+/**
+ * @file ota_manager.c
+ *
+ * @brief OTA Manager Implementation
+ *
+ * The image (or delta) is streamed from HTTP(S) through the patch decoder
+ * into a one-sector buffer that is erased and written straight into the
+ * inactive OTA partition; the SHA-256 of the resulting image is updated per
+ * sector. Every few sectors the download position and decoder state are
+ * saved to NVS, so an interrupted download resumes with an HTTP Range request
+ * instead of starting over.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "ota_manager.h"
+#include "ota_patch.h"
+#include "task_registry.h"
+#include "heap_account.h"
+#include "esp_crt_bundle.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "mbedtls/sha256.h"
+#include "nvs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+#include "mbedtls/pk.h"
+#endif
+
+/* Private defines -----------------------------------------------------------*/
+
+#define OTA_MANAGER_SECTOR_SIZE      4096
+#define OTA_MANAGER_CHUNK_SIZE       1024
+#define OTA_MANAGER_CHECKPOINT_SECTORS (CONFIG_OTA_MANAGER_CHECKPOINT_KB * 1024 / OTA_MANAGER_SECTOR_SIZE)
+#define OTA_MANAGER_RETRY_DELAY_MS   2000
+
+#define OTA_MANAGER_NVS_NAMESPACE    "ota_mgr"
+#define OTA_MANAGER_NVS_KEY          "ckpt"
+#define OTA_MANAGER_CHECKPOINT_MAGIC 0x4F544131 //!< "OTA1"
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Download checkpoint, stored in NVS
+ */
+typedef struct
+{
+    uint32_t magic;             //!< OTA_MANAGER_CHECKPOINT_MAGIC
+    uint32_t partition_address; //!< Partition being written
+    uint32_t url_crc;           //!< CRC32 of the URL, a different stream cannot resume
+    uint8_t target_sha256[32];  //!< Image being downloaded
+    uint32_t patch_offset;      //!< Stream bytes consumed
+    uint32_t out_offset;        //!< Image bytes written, sector aligned
+    ota_patch_state_t patch;    //!< Decoder state at patch_offset
+} ota_checkpoint_t;
+
+/**
+ * @brief Update job, allocated for the lifetime of the OTA task
+ */
+typedef struct
+{
+    char cmd_id[OTA_MANAGER_CMD_ID_MAX_LEN];     //!< Echoed in the result
+    char url[OTA_MANAGER_URL_MAX_LEN];           //!< Image or delta URL
+    uint8_t signature[OTA_MANAGER_SIG_MAX_LEN];  //!< DER signature
+    size_t signature_len;                        //!< Signature length
+    const esp_partition_t *update;               //!< Inactive OTA partition
+    ota_patch_base_t base;                       //!< Running image
+    ota_checkpoint_t progress;                   //!< Live progress
+    uint32_t sectors_since_checkpoint;           //!< Flushes since last save
+    mbedtls_sha256_context sha;                  //!< Hash of the written image
+    size_t sector_fill;                          //!< Bytes in sector
+    uint8_t sector[OTA_MANAGER_SECTOR_SIZE];     //!< Pending output sector
+    uint8_t chunk[OTA_MANAGER_CHUNK_SIZE];       //!< HTTP read buffer
+} ota_job_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "OTA_MANAGER";
+
+static portMUX_TYPE ota_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool ota_running = false;
+
+static ota_manager_result_cb_t result_callback = NULL;
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+extern const uint8_t signing_key_pem_start[] asm("_binary_ota_signing_key_pem_start");
+extern const uint8_t signing_key_pem_end[] asm("_binary_ota_signing_key_pem_end");
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief OTA task entry
+ *
+ * @param[in] arg Update job, freed by the task
+ */
+static void ota_manager_task(void *arg);
+
+/**
+ * @brief Run an update: resume or start, download with retries, verify
+ *
+ * @param[in,out] job Update job
+ *
+ * @return ESP_OK when the new image is set as boot partition
+ */
+static esp_err_t ota_manager_run(ota_job_t *job);
+
+/**
+ * @brief Download from the current position until the stream ends
+ *
+ * @param[in,out] job Update job
+ *
+ * @return ESP_OK at the end of the stream, ESP_ERR_TIMEOUT on a retryable
+ *         network error, other codes are fatal
+ */
+static esp_err_t ota_manager_download(ota_job_t *job);
+
+/**
+ * @brief Decode a received chunk into the partition
+ *
+ * @param[in,out] job Update job
+ * @param[in] data Received bytes
+ * @param[in] len Received length
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t ota_manager_feed(ota_job_t *job, const uint8_t *data, size_t len);
+
+/**
+ * @brief Erase, write and hash the pending sector
+ *
+ * @param[in,out] job Update job
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t ota_manager_flush(ota_job_t *job);
+
+/**
+ * @brief Check hash and signature, then switch the boot partition
+ *
+ * @param[in,out] job Update job
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t ota_manager_finish(ota_job_t *job);
+
+/**
+ * @brief Restart progress and hash from the beginning of the stream
+ *
+ * @param[in,out] job Update job
+ */
+static void ota_manager_reset_progress(ota_job_t *job);
+
+/**
+ * @brief Re-hash the part of the image written before a checkpoint
+ *
+ * @param[in,out] job Update job
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t ota_manager_rehash(ota_job_t *job);
+
+/**
+ * @brief Load a checkpoint matching the job
+ *
+ * @param[in,out] job Update job, progress is filled on success
+ *
+ * @return true if the download resumes
+ */
+static bool ota_manager_load_checkpoint(ota_job_t *job);
+
+/**
+ * @brief Save the current progress
+ *
+ * @param[in] job Update job
+ */
+static void ota_manager_save_checkpoint(ota_job_t *job);
+
+/**
+ * @brief Erase the stored checkpoint
+ */
+static void ota_manager_clear_checkpoint(void);
+
+/**
+ * @brief Decode a hex string
+ *
+ * @param[in] hex Hex string
+ * @param[out] out Output buffer
+ * @param[in] max Output buffer size
+ * @param[out] out_len Decoded length
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad input
+ */
+static esp_err_t ota_manager_hex_decode(const char *hex, uint8_t *out, size_t max, size_t *out_len);
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+/**
+ * @brief Verify the signature over the image hash with the embedded key
+ *
+ * @param[in] job Update job
+ * @param[in] digest SHA-256 of the written image
+ *
+ * @return ESP_OK if the signature is valid
+ */
+static esp_err_t ota_manager_verify_signature(const ota_job_t *job, const uint8_t *digest);
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize OTA manager
+ */
+esp_err_t ota_manager_init(void)
+{
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    const esp_partition_t *update = esp_ota_get_next_update_partition(NULL);
+
+    ESP_LOGI(TAG, "Running partition: %s (0x%lx)", running->label, (unsigned long)running->address);
+
+#if !CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+    ESP_LOGW(TAG, "Signature verification off, update commands are refused");
+#endif
+
+    if (update == NULL)
+    {
+        ESP_LOGW(TAG, "No OTA partition, updates disabled");
+        return ESP_OK;
+    }
+
+    nvs_handle_t handle;
+    ota_checkpoint_t checkpoint;
+    size_t size = sizeof(checkpoint);
+
+    if (nvs_open(OTA_MANAGER_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK)
+    {
+        if (nvs_get_blob(handle, OTA_MANAGER_NVS_KEY, &checkpoint, &size) == ESP_OK &&
+            size == sizeof(checkpoint) && checkpoint.magic == OTA_MANAGER_CHECKPOINT_MAGIC)
+        {
+            ESP_LOGI(TAG, "Interrupted download at %lu KB, resent command resumes it",
+                     (unsigned long)(checkpoint.out_offset / 1024));
+        }
+        nvs_close(handle);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Start an update in the background
+ */
+esp_err_t ota_manager_start(const char *cmd_id, const char *url,
+                            const char *sha256_hex, const char *signature_hex)
+{
+    if (cmd_id == NULL || url == NULL || sha256_hex == NULL ||
+        strlen(url) == 0 || strlen(url) >= OTA_MANAGER_URL_MAX_LEN)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if !CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+    // Anyone who can publish a command could flash any image
+    ESP_LOGE(TAG, "Unsigned updates refused, enable CONFIG_OTA_MANAGER_VERIFY_SIGNATURE");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+
+    const esp_partition_t *update = esp_ota_get_next_update_partition(NULL);
+    if (update == NULL)
+    {
+        ESP_LOGE(TAG, "No OTA partition to write");
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    ota_job_t *job = heap_account_calloc(HEAP_ACCOUNT_OTA, 1, sizeof(ota_job_t));
+    if (job == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    size_t sha_len = 0;
+    esp_err_t ret = ota_manager_hex_decode(sha256_hex, job->progress.target_sha256,
+                                           sizeof(job->progress.target_sha256), &sha_len);
+    if (ret == ESP_OK && sha_len != sizeof(job->progress.target_sha256))
+    {
+        ret = ESP_ERR_INVALID_ARG;
+    }
+
+    if (ret == ESP_OK && signature_hex != NULL && strlen(signature_hex) > 0)
+    {
+        ret = ota_manager_hex_decode(signature_hex, job->signature, sizeof(job->signature),
+                                     &job->signature_len);
+    }
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+    if (ret == ESP_OK && job->signature_len == 0)
+    {
+        ESP_LOGE(TAG, "Signature required");
+        ret = ESP_ERR_INVALID_ARG;
+    }
+#endif
+
+    if (ret != ESP_OK)
+    {
+        heap_account_free(HEAP_ACCOUNT_OTA, job);
+        return ret;
+    }
+
+    strncpy(job->cmd_id, cmd_id, sizeof(job->cmd_id) - 1);
+    strncpy(job->url, url, sizeof(job->url) - 1);
+    job->update = update;
+
+    portENTER_CRITICAL(&ota_lock);
+    bool busy = ota_running;
+    ota_running = true;
+    portEXIT_CRITICAL(&ota_lock);
+
+    if (busy)
+    {
+        heap_account_free(HEAP_ACCOUNT_OTA, job);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Transient background task: heap stack, released when the update ends
+    TaskHandle_t task = NULL;
+    ret = task_registry_create(TASK_ID_OTA, ota_manager_task, job, &task);
+    if (ret != ESP_OK)
+    {
+        heap_account_free(HEAP_ACCOUNT_OTA, job);
+        portENTER_CRITICAL(&ota_lock);
+        ota_running = false;
+        portEXIT_CRITICAL(&ota_lock);
+        return ret;
+    }
+
+    // Registered now, the task may run and remove itself
+    xTaskNotifyGive(task);
+
+    ESP_LOGI(TAG, "Update started: %s -> %s", url, update->label);
+    return ESP_OK;
+}
+
+/**
+ * @brief Check if an update is running
+ */
+bool ota_manager_is_running(void)
+{
+    return ota_running;
+}
+
+/**
+ * @brief Register the result callback
+ */
+void ota_manager_register_result_callback(ota_manager_result_cb_t callback)
+{
+    result_callback = callback;
+}
+
+/**
+ * @brief Confirm the running image after an update
+ */
+esp_err_t ota_manager_mark_valid(void)
+{
+    esp_ota_img_states_t state;
+    const esp_partition_t *running = esp_ota_get_running_partition();
+
+    if (esp_ota_get_state_partition(running, &state) != ESP_OK ||
+        state != ESP_OTA_IMG_PENDING_VERIFY)
+    {
+        return ESP_OK;
+    }
+
+    ESP_LOGI(TAG, "New image confirmed, rollback cancelled");
+    return esp_ota_mark_app_valid_cancel_rollback();
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief OTA task entry
+ */
+static void ota_manager_task(void *arg)
+{
+    ota_job_t *job = arg;
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    esp_err_t ret = ota_manager_run(job);
+
+    if (ret == ESP_OK)
+    {
+        ESP_LOGI(TAG, "Update ready in %s, restart to boot it", job->update->label);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Update failed: %s", esp_err_to_name(ret));
+    }
+
+    if (result_callback)
+    {
+        result_callback(job->cmd_id, ret);
+    }
+
+    heap_account_free(HEAP_ACCOUNT_OTA, job);
+
+    portENTER_CRITICAL(&ota_lock);
+    ota_running = false;
+    portEXIT_CRITICAL(&ota_lock);
+
+    task_registry_remove(TASK_ID_OTA);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Run an update: resume or start, download with retries, verify
+ */
+static esp_err_t ota_manager_run(ota_job_t *job)
+{
+    job->base.partition = esp_ota_get_running_partition();
+
+    esp_err_t ret = esp_partition_get_sha256(job->base.partition, job->base.sha256);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    mbedtls_sha256_init(&job->sha);
+
+    if (ota_manager_load_checkpoint(job))
+    {
+        ESP_LOGI(TAG, "Resuming at %lu KB (stream offset %lu)",
+                 (unsigned long)(job->progress.out_offset / 1024),
+                 (unsigned long)job->progress.patch_offset);
+        ret = ota_manager_rehash(job);
+    }
+    else
+    {
+        ota_manager_reset_progress(job);
+    }
+
+    for (int attempt = 0; ret == ESP_OK || ret == ESP_ERR_TIMEOUT; attempt++)
+    {
+        if (attempt > CONFIG_OTA_MANAGER_MAX_RETRIES)
+        {
+            // Checkpoint stays: resending the command resumes from here
+            mbedtls_sha256_free(&job->sha);
+            return ret;
+        }
+
+        // A retry in the same boot keeps the sector buffer, so it continues
+        // from the exact stream offset rather than the last checkpoint
+        if (attempt > 0)
+        {
+            ESP_LOGW(TAG, "Download interrupted, retry %d in %d ms", attempt,
+                     OTA_MANAGER_RETRY_DELAY_MS * attempt);
+            vTaskDelay(pdMS_TO_TICKS(OTA_MANAGER_RETRY_DELAY_MS * attempt));
+        }
+
+        ret = ota_manager_download(job);
+        if (ret == ESP_OK)
+        {
+            ret = ota_manager_finish(job);
+            break;
+        }
+    }
+
+    // Finished or failed for good: never resume this stream
+    ota_manager_clear_checkpoint();
+    mbedtls_sha256_free(&job->sha);
+
+    return ret;
+}
+
+/**
+ * @brief Download from the current position until the stream ends
+ */
+static esp_err_t ota_manager_download(ota_job_t *job)
+{
+    esp_http_client_config_t config = {
+        .url = job->url,
+        .timeout_ms = CONFIG_OTA_MANAGER_HTTP_TIMEOUT_MS,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+    };
+
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (job->progress.patch_offset > 0)
+    {
+        char range[32];
+        snprintf(range, sizeof(range), "bytes=%lu-", (unsigned long)job->progress.patch_offset);
+        esp_http_client_set_header(client, "Range", range);
+    }
+
+    esp_err_t ret = esp_http_client_open(client, 0);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Connect failed: %s", esp_err_to_name(ret));
+        esp_http_client_cleanup(client);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    esp_http_client_fetch_headers(client);
+    int status = esp_http_client_get_status_code(client);
+
+    if (status == 200 && job->progress.patch_offset > 0)
+    {
+        ESP_LOGW(TAG, "Server ignored Range, restarting download");
+        ota_manager_reset_progress(job);
+    }
+    else if (status != 200 && status != 206)
+    {
+        ESP_LOGE(TAG, "HTTP status %d", status);
+        esp_http_client_cleanup(client);
+        return (status >= 500) ? ESP_ERR_TIMEOUT : ESP_ERR_NOT_FOUND;
+    }
+
+    while (true)
+    {
+        int n = esp_http_client_read(client, (char *)job->chunk, sizeof(job->chunk));
+
+        if (n < 0)
+        {
+            ret = ESP_ERR_TIMEOUT;
+            break;
+        }
+
+        if (n == 0)
+        {
+            ret = esp_http_client_is_complete_data_received(client) ? ESP_OK : ESP_ERR_TIMEOUT;
+            break;
+        }
+
+        ret = ota_manager_feed(job, job->chunk, n);
+        if (ret != ESP_OK || ota_patch_is_done(&job->progress.patch))
+        {
+            break;
+        }
+    }
+
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+    return ret;
+}
+
+/**
+ * @brief Decode a received chunk into the partition
+ */
+static esp_err_t ota_manager_feed(ota_job_t *job, const uint8_t *data, size_t len)
+{
+    size_t pos = 0;
+
+    while (true)
+    {
+        size_t consumed;
+        size_t produced;
+
+        esp_err_t ret = ota_patch_decode(&job->progress.patch, &job->base, data + pos, len - pos,
+                                         &consumed, job->sector + job->sector_fill,
+                                         OTA_MANAGER_SECTOR_SIZE - job->sector_fill, &produced);
+
+        pos += consumed;
+        job->progress.patch_offset += consumed;
+        job->sector_fill += produced;
+
+        if (ret != ESP_OK)
+        {
+            return ret;
+        }
+
+        // Flushing only full sectors keeps every checkpoint sector aligned
+        if (job->sector_fill == OTA_MANAGER_SECTOR_SIZE)
+        {
+            ret = ota_manager_flush(job);
+            if (ret != ESP_OK)
+            {
+                return ret;
+            }
+        }
+        else if (consumed == 0 && produced == 0)
+        {
+            return ESP_OK;
+        }
+    }
+}
+
+/**
+ * @brief Erase, write and hash the pending sector
+ */
+static esp_err_t ota_manager_flush(ota_job_t *job)
+{
+    uint32_t offset = job->progress.out_offset;
+
+    if (offset + job->sector_fill > job->update->size)
+    {
+        ESP_LOGE(TAG, "Image larger than partition %s", job->update->label);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    esp_err_t ret = esp_partition_erase_range(job->update, offset, OTA_MANAGER_SECTOR_SIZE);
+    if (ret == ESP_OK)
+    {
+        ret = esp_partition_write(job->update, offset, job->sector, job->sector_fill);
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Flash write at 0x%lx failed: %s", (unsigned long)offset, esp_err_to_name(ret));
+        return ret;
+    }
+
+    mbedtls_sha256_update(&job->sha, job->sector, job->sector_fill);
+    job->progress.out_offset += job->sector_fill;
+    job->sector_fill = 0;
+
+    if (++job->sectors_since_checkpoint >= OTA_MANAGER_CHECKPOINT_SECTORS)
+    {
+        ota_manager_save_checkpoint(job);
+        ESP_LOGI(TAG, "Written %lu KB", (unsigned long)(job->progress.out_offset / 1024));
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Check hash and signature, then switch the boot partition
+ */
+static esp_err_t ota_manager_finish(ota_job_t *job)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (job->sector_fill > 0)
+    {
+        ret = ota_manager_flush(job);
+        if (ret != ESP_OK)
+        {
+            return ret;
+        }
+    }
+
+    if (ota_patch_is_delta(&job->progress.patch) &&
+        (!ota_patch_is_done(&job->progress.patch) ||
+         job->progress.out_offset != job->progress.patch.target_size))
+    {
+        ESP_LOGE(TAG, "Delta incomplete (%lu of %lu bytes)", (unsigned long)job->progress.out_offset,
+                 (unsigned long)job->progress.patch.target_size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&job->sha, digest);
+
+    if (memcmp(digest, job->progress.target_sha256, sizeof(digest)) != 0)
+    {
+        ESP_LOGE(TAG, "SHA-256 mismatch over %lu bytes", (unsigned long)job->progress.out_offset);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+    ret = ota_manager_verify_signature(job, digest);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+#endif
+
+    // Also validates the image header and segments
+    ret = esp_ota_set_boot_partition(job->update);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Image rejected: %s", esp_err_to_name(ret));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Restart progress and hash from the beginning of the stream
+ */
+static void ota_manager_reset_progress(ota_job_t *job)
+{
+    job->progress.magic = OTA_MANAGER_CHECKPOINT_MAGIC;
+    job->progress.partition_address = job->update->address;
+    job->progress.url_crc = esp_rom_crc32_le(0, (const uint8_t *)job->url, strlen(job->url));
+    job->progress.patch_offset = 0;
+    job->progress.out_offset = 0;
+    ota_patch_init(&job->progress.patch);
+
+    job->sector_fill = 0;
+    job->sectors_since_checkpoint = 0;
+
+    mbedtls_sha256_free(&job->sha);
+    mbedtls_sha256_init(&job->sha);
+    mbedtls_sha256_starts(&job->sha, 0);
+}
+
+/**
+ * @brief Re-hash the part of the image written before a checkpoint
+ */
+static esp_err_t ota_manager_rehash(ota_job_t *job)
+{
+    mbedtls_sha256_starts(&job->sha, 0);
+
+    for (uint32_t offset = 0; offset < job->progress.out_offset; offset += OTA_MANAGER_SECTOR_SIZE)
+    {
+        esp_err_t ret = esp_partition_read(job->update, offset, job->sector, OTA_MANAGER_SECTOR_SIZE);
+        if (ret != ESP_OK)
+        {
+            return ret;
+        }
+        mbedtls_sha256_update(&job->sha, job->sector, OTA_MANAGER_SECTOR_SIZE);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Load a checkpoint matching the job
+ */
+static bool ota_manager_load_checkpoint(ota_job_t *job)
+{
+    nvs_handle_t handle;
+    ota_checkpoint_t checkpoint;
+    size_t size = sizeof(checkpoint);
+
+    if (nvs_open(OTA_MANAGER_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK)
+    {
+        return false;
+    }
+
+    esp_err_t ret = nvs_get_blob(handle, OTA_MANAGER_NVS_KEY, &checkpoint, &size);
+    nvs_close(handle);
+
+    uint32_t url_crc = esp_rom_crc32_le(0, (const uint8_t *)job->url, strlen(job->url));
+
+    if (ret != ESP_OK || size != sizeof(checkpoint) ||
+        checkpoint.magic != OTA_MANAGER_CHECKPOINT_MAGIC ||
+        checkpoint.partition_address != job->update->address ||
+        checkpoint.url_crc != url_crc ||
+        memcmp(checkpoint.target_sha256, job->progress.target_sha256, sizeof(checkpoint.target_sha256)) != 0 ||
+        checkpoint.out_offset % OTA_MANAGER_SECTOR_SIZE != 0)
+    {
+        return false;
+    }
+
+    job->progress = checkpoint;
+    job->sector_fill = 0;
+    job->sectors_since_checkpoint = 0;
+    return true;
+}
+
+/**
+ * @brief Save the current progress
+ *
+ * Only called right after a sector flush, so out_offset is sector aligned
+ * and patch_offset matches it exactly.
+ */
+static void ota_manager_save_checkpoint(ota_job_t *job)
+{
+    nvs_handle_t handle;
+
+    if (nvs_open(OTA_MANAGER_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK)
+    {
+        return;
+    }
+
+    if (nvs_set_blob(handle, OTA_MANAGER_NVS_KEY, &job->progress, sizeof(job->progress)) == ESP_OK)
+    {
+        nvs_commit(handle);
+        job->sectors_since_checkpoint = 0;
+    }
+
+    nvs_close(handle);
+}
+
+/**
+ * @brief Erase the stored checkpoint
+ */
+static void ota_manager_clear_checkpoint(void)
+{
+    nvs_handle_t handle;
+
+    if (nvs_open(OTA_MANAGER_NVS_NAMESPACE, NVS_READWRITE, &handle) == ESP_OK)
+    {
+        nvs_erase_key(handle, OTA_MANAGER_NVS_KEY);
+        nvs_commit(handle);
+        nvs_close(handle);
+    }
+}
+
+/**
+ * @brief Decode a hex string
+ */
+static esp_err_t ota_manager_hex_decode(const char *hex, uint8_t *out, size_t max, size_t *out_len)
+{
+    size_t len = strlen(hex);
+
+    if (len % 2 != 0 || len / 2 > max)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < len / 2; i++)
+    {
+        unsigned int byte;
+        if (sscanf(hex + 2 * i, "%2x", &byte) != 1)
+        {
+            return ESP_ERR_INVALID_ARG;
+        }
+        out[i] = (uint8_t)byte;
+    }
+
+    *out_len = len / 2;
+    return ESP_OK;
+}
+
+#if CONFIG_OTA_MANAGER_VERIFY_SIGNATURE
+/**
+ * @brief Verify the signature over the image hash with the embedded key
+ */
+static esp_err_t ota_manager_verify_signature(const ota_job_t *job, const uint8_t *digest)
+{
+    mbedtls_pk_context pk;
+    mbedtls_pk_init(&pk);
+
+    int rc = mbedtls_pk_parse_public_key(&pk, signing_key_pem_start,
+                                         signing_key_pem_end - signing_key_pem_start);
+    if (rc == 0)
+    {
+        rc = mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, digest, 32, job->signature, job->signature_len);
+    }
+
+    mbedtls_pk_free(&pk);
+
+    if (rc != 0)
+    {
+        ESP_LOGE(TAG, "Signature check failed (-0x%04x)", (unsigned)-rc);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    ESP_LOGI(TAG, "Signature valid");
+    return ESP_OK;
+}
+#endif
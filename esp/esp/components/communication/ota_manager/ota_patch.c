@@ -0,0 +1,289 @@
+/**
+ * @file ota_patch.c
+ *
+ * @brief Streaming decoder for full and delta OTA images
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "ota_patch.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "OTA_PATCH";
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Read a little-endian u32
+ *
+ * @param[in] p Source bytes
+ *
+ * @return Decoded value
+ */
+static uint32_t ota_patch_get_u32(const uint8_t *p);
+
+/**
+ * @brief Collect header bytes until hdr holds need bytes
+ *
+ * @param[in,out] state Decoder state
+ * @param[in] need Bytes required in hdr
+ * @param[in] in Input bytes
+ * @param[in] in_len Input length
+ * @param[in,out] in_pos Input position
+ *
+ * @return true when hdr holds need bytes
+ */
+static bool ota_patch_collect(ota_patch_state_t *state, size_t need,
+                              const uint8_t *in, size_t in_len, size_t *in_pos);
+
+/**
+ * @brief Parse a complete op header
+ *
+ * @param[in,out] state Decoder state
+ * @param[in] base Running image
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_RESPONSE on a malformed op
+ */
+static esp_err_t ota_patch_start_op(ota_patch_state_t *state, const ota_patch_base_t *base);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Reset decoder state for a new stream
+ */
+void ota_patch_init(ota_patch_state_t *state)
+{
+    memset(state, 0, sizeof(*state));
+    state->phase = OTA_PATCH_PHASE_DETECT;
+}
+
+/**
+ * @brief Decode as much as fits into the output buffer
+ */
+esp_err_t ota_patch_decode(ota_patch_state_t *state, const ota_patch_base_t *base,
+                           const uint8_t *in, size_t in_len, size_t *consumed,
+                           uint8_t *out, size_t out_cap, size_t *produced)
+{
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+    esp_err_t ret = ESP_OK;
+    bool progress = true;
+
+    while (progress && ret == ESP_OK)
+    {
+        size_t n;
+        progress = false;
+
+        switch (state->phase)
+        {
+        case OTA_PATCH_PHASE_DETECT:
+            if (!ota_patch_collect(state, OTA_PATCH_MAGIC_SIZE, in, in_len, &in_pos))
+            {
+                break;
+            }
+
+            if (memcmp(state->hdr, OTA_PATCH_MAGIC, OTA_PATCH_MAGIC_SIZE) == 0)
+            {
+                state->phase = OTA_PATCH_PHASE_HEADER;
+            }
+            else
+            {
+                // Full image: the detection bytes are image data
+                state->phase = OTA_PATCH_PHASE_RAW_PENDING;
+                state->remaining = state->hdr_len;
+            }
+            progress = true;
+            break;
+
+        case OTA_PATCH_PHASE_RAW_PENDING:
+            n = (state->remaining < out_cap - out_pos) ? state->remaining : out_cap - out_pos;
+            memcpy(out + out_pos, state->hdr + (state->hdr_len - state->remaining), n);
+            out_pos += n;
+            state->remaining -= n;
+            if (state->remaining == 0)
+            {
+                state->phase = OTA_PATCH_PHASE_RAW;
+            }
+            progress = (n > 0);
+            break;
+
+        case OTA_PATCH_PHASE_RAW:
+            n = (in_len - in_pos < out_cap - out_pos) ? in_len - in_pos : out_cap - out_pos;
+            memcpy(out + out_pos, in + in_pos, n);
+            in_pos += n;
+            out_pos += n;
+            progress = (n > 0);
+            break;
+
+        case OTA_PATCH_PHASE_HEADER:
+            if (!ota_patch_collect(state, OTA_PATCH_HEADER_SIZE, in, in_len, &in_pos))
+            {
+                break;
+            }
+
+            if (memcmp(state->hdr + OTA_PATCH_MAGIC_SIZE, base->sha256, sizeof(base->sha256)) != 0)
+            {
+                ESP_LOGE(TAG, "Delta was built for a different base image");
+                ret = ESP_ERR_INVALID_VERSION;
+                break;
+            }
+
+            state->target_size = ota_patch_get_u32(state->hdr + OTA_PATCH_MAGIC_SIZE + 32);
+            state->hdr_len = 0;
+            state->phase = OTA_PATCH_PHASE_OP;
+            progress = true;
+            break;
+
+        case OTA_PATCH_PHASE_OP:
+        {
+            if (!ota_patch_collect(state, 1, in, in_len, &in_pos))
+            {
+                break;
+            }
+
+            size_t need = (state->hdr[0] == OTA_PATCH_OP_COPY)     ? 9
+                          : (state->hdr[0] == OTA_PATCH_OP_INSERT) ? 5
+                                                                   : 1;
+            if (!ota_patch_collect(state, need, in, in_len, &in_pos))
+            {
+                break;
+            }
+
+            ret = ota_patch_start_op(state, base);
+            progress = true;
+            break;
+        }
+
+        case OTA_PATCH_PHASE_COPY:
+            n = (state->remaining < out_cap - out_pos) ? state->remaining : out_cap - out_pos;
+            if (n == 0)
+            {
+                break;
+            }
+
+            ret = esp_partition_read(base->partition, state->src_offset, out + out_pos, n);
+            if (ret != ESP_OK)
+            {
+                break;
+            }
+
+            out_pos += n;
+            state->src_offset += n;
+            state->remaining -= n;
+            if (state->remaining == 0)
+            {
+                state->phase = OTA_PATCH_PHASE_OP;
+            }
+            progress = true;
+            break;
+
+        case OTA_PATCH_PHASE_INSERT:
+            n = (state->remaining < in_len - in_pos) ? state->remaining : in_len - in_pos;
+            n = (n < out_cap - out_pos) ? n : out_cap - out_pos;
+            memcpy(out + out_pos, in + in_pos, n);
+            in_pos += n;
+            out_pos += n;
+            state->remaining -= n;
+            if (state->remaining == 0)
+            {
+                state->phase = OTA_PATCH_PHASE_OP;
+                progress = true;
+            }
+            else
+            {
+                progress = (n > 0);
+            }
+            break;
+
+        case OTA_PATCH_PHASE_DONE:
+        default:
+            break;
+        }
+    }
+
+    *consumed = in_pos;
+    *produced = out_pos;
+    return ret;
+}
+
+/**
+ * @brief Check if the END op of a delta has been reached
+ */
+bool ota_patch_is_done(const ota_patch_state_t *state)
+{
+    return state->phase == OTA_PATCH_PHASE_DONE;
+}
+
+/**
+ * @brief Check if the stream is a delta
+ */
+bool ota_patch_is_delta(const ota_patch_state_t *state)
+{
+    return state->phase >= OTA_PATCH_PHASE_HEADER;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Read a little-endian u32
+ */
+static uint32_t ota_patch_get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Collect header bytes until hdr holds need bytes
+ */
+static bool ota_patch_collect(ota_patch_state_t *state, size_t need,
+                              const uint8_t *in, size_t in_len, size_t *in_pos)
+{
+    while (state->hdr_len < need && *in_pos < in_len)
+    {
+        state->hdr[state->hdr_len++] = in[(*in_pos)++];
+    }
+
+    return state->hdr_len >= need;
+}
+
+/**
+ * @brief Parse a complete op header
+ */
+static esp_err_t ota_patch_start_op(ota_patch_state_t *state, const ota_patch_base_t *base)
+{
+    uint8_t op = state->hdr[0];
+    state->hdr_len = 0;
+
+    switch (op)
+    {
+    case OTA_PATCH_OP_END:
+        state->phase = OTA_PATCH_PHASE_DONE;
+        return ESP_OK;
+
+    case OTA_PATCH_OP_COPY:
+        state->src_offset = ota_patch_get_u32(state->hdr + 1);
+        state->remaining = ota_patch_get_u32(state->hdr + 5);
+
+        if ((uint64_t)state->src_offset + state->remaining > base->partition->size)
+        {
+            ESP_LOGE(TAG, "COPY outside base image (0x%lx+%lu)",
+                     (unsigned long)state->src_offset, (unsigned long)state->remaining);
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+
+        state->phase = (state->remaining > 0) ? OTA_PATCH_PHASE_COPY : OTA_PATCH_PHASE_OP;
+        return ESP_OK;
+
+    case OTA_PATCH_OP_INSERT:
+        state->remaining = ota_patch_get_u32(state->hdr + 1);
+        state->phase = (state->remaining > 0) ? OTA_PATCH_PHASE_INSERT : OTA_PATCH_PHASE_OP;
+        return ESP_OK;
+
+    default:
+        ESP_LOGE(TAG, "Unknown op 0x%02x", op);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+}
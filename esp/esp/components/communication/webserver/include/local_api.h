@@ -0,0 +1,113 @@
+/**
+ * @file local_api.h
+ *
+ * @brief Local LAN REST API
+ *
+ * Authenticated HTTP API on the station interface. State and sensor data
+ * responses are served from buffers the application refreshes on change;
+ * control requests are handed to the same command dispatcher MQTT uses.
+ * Recorded history is read through a registered reader.
+ */
+
+#ifndef LOCAL_API_H
+#define LOCAL_API_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "cJSON.h"
+#include "history_codec.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define LOCAL_API_PORT          CONFIG_LOCAL_API_PORT
+#define LOCAL_API_TOKEN         CONFIG_LOCAL_API_TOKEN
+#define LOCAL_API_BUFFER_SIZE   256 //!< Max size of a precomputed JSON response
+#define LOCAL_API_HISTORY_LIMIT 720 //!< Max samples per /api/history response
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Command callback, same dispatch as the MQTT command callback
+ *
+ * The handler's reply is returned instead of being published to the broker.
+ *
+ * @param[in] cmd_id Generated command id ("local-<n>")
+ * @param[in] command Command name (set_device, set_devices, set_mode)
+ * @param[in] params Request body as JSON object
+ *
+ * @return Reply status ("success", "error"), NULL if the handler did not reply
+ */
+typedef const char *(*local_api_command_callback_t)(const char *cmd_id, const char *command, cJSON *params);
+
+/**
+ * @brief History reader, same contract as sensor_history_read()
+ *
+ * @param[in,out] cursor Timestamp to continue from, 0 to start at from
+ * @param[in] from First timestamp
+ * @param[in] to Last timestamp
+ * @param[out] out Destination
+ * @param[in] max Destination capacity
+ * @param[out] more Set when a further sample in the range follows
+ *
+ * @return Number of samples copied
+ */
+typedef size_t (*local_api_history_reader_t)(uint32_t *cursor, uint32_t from, uint32_t to,
+                                             history_sample_t *out, size_t max, bool *more);
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Start the local API server
+ *
+ * @return ESP_OK on success (or already running), ESP_ERR_NOT_SUPPORTED if
+ *         disabled or no token is configured, error code otherwise
+ */
+esp_err_t local_api_start(void);
+
+/**
+ * @brief Stop the local API server
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t local_api_stop(void);
+
+/**
+ * @brief Register the command dispatcher
+ *
+ * @param[in] callback Command callback
+ */
+void local_api_register_command_callback(local_api_command_callback_t callback);
+
+/**
+ * @brief Register the reader serving /api/history
+ *
+ * @param[in] reader History reader
+ */
+void local_api_register_history_reader(local_api_history_reader_t reader);
+
+/**
+ * @brief Replace the precomputed /api/state response
+ *
+ * @param[in] json State JSON
+ * @param[in] len JSON length in bytes
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_SIZE if it does not fit
+ */
+esp_err_t local_api_set_state(const char *json, size_t len);
+
+/**
+ * @brief Replace the precomputed /api/data response
+ *
+ * @param[in] json Sensor data JSON
+ * @param[in] len JSON length in bytes
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_SIZE if it does not fit
+ */
+esp_err_t local_api_set_data(const char *json, size_t len);
+
+#endif /* LOCAL_API_H */
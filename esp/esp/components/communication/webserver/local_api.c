@@ -0,0 +1,1254 @@
+/**
+ * @file local_api.c
+ *
+ * @brief Local LAN REST API Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "local_api.h"
+#include "esp_http_server.h"
+#include "esp_log.h"
+#include "json_helper.h"
+#include "task_registry.h"
+#include "wifi_manager.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if CONFIG_LOCAL_API_ENABLE
+
+/* Private defines -----------------------------------------------------------*/
+
+#define LOCAL_API_BODY_SIZE     128   //!< Max accepted request body
+#define LOCAL_API_CTRL_PORT     32769 //!< Differs from the provisioning server
+#define LOCAL_API_AUTH_PREFIX   "Bearer "
+#define LOCAL_API_AUTH_SIZE     96    //!< Max Authorization header length
+#define LOCAL_API_QUERY_SIZE    96    //!< Max /api/history query string
+#define LOCAL_API_HISTORY_BATCH 32    //!< Samples read and sent per chunk
+#define LOCAL_API_HISTORY_CHUNK (LOCAL_API_HISTORY_BATCH * 40) //!< "[ts,temp,hum,light]," per sample
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+#define LOCAL_API_WS_MAX_CLIENTS CONFIG_LOCAL_API_WS_MAX_CLIENTS
+#define LOCAL_API_WS_FRAME_SIZE  (LOCAL_API_BUFFER_SIZE + 32) //!< Buffer plus topic envelope
+#define LOCAL_API_WS_WIRE_SIZE   (LOCAL_API_WS_FRAME_SIZE + 4)  //!< Plus WebSocket header
+#define LOCAL_API_WS_QUEUE_LEN   CONFIG_LOCAL_API_WS_QUEUE_LEN
+#define LOCAL_API_WS_RETRY_US    (20 * 1000)          //!< Drain retry while a client is behind
+#define LOCAL_API_WS_STALL_US    (10 * 1000 * 1000)   //!< No byte accepted for this long closes the client
+#define LOCAL_API_WS_STOP_POLL_MS 10                  //!< Poll while a queued fan-out is pending at stop
+#endif
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Topics with a precomputed response
+ */
+typedef enum
+{
+    LOCAL_API_TOPIC_STATE = 0, //!< /api/state, MQTT /state
+    LOCAL_API_TOPIC_DATA,      //!< /api/data, MQTT /data
+    LOCAL_API_TOPIC_MAX
+} local_api_topic_t;
+
+/**
+ * @brief Precomputed response buffer
+ */
+typedef struct
+{
+    char json[LOCAL_API_BUFFER_SIZE]; //!< Response body
+    size_t len;                       //!< Body length, 0 until first update
+    uint32_t seq;                     //!< Bumped on every change
+} local_api_buffer_t;
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+/**
+ * @brief Encoded WebSocket frame, header included
+ */
+typedef struct
+{
+    uint16_t len;                         //!< Bytes on the wire
+    uint8_t data[LOCAL_API_WS_WIRE_SIZE]; //!< Header and payload
+} local_api_ws_frame_t;
+
+/**
+ * @brief WebSocket client slot
+ *
+ * Frames wait in a bounded ring and go out with non-blocking sends, so a
+ * client that stops reading never holds up the server task or the other
+ * clients. When the ring is full the oldest unsent frame is dropped.
+ */
+typedef struct
+{
+    int fd;                                             //!< Socket, -1 when the slot is free
+    uint32_t sent_seq[LOCAL_API_TOPIC_MAX];             //!< Last sequence queued per topic
+    local_api_ws_frame_t queue[LOCAL_API_WS_QUEUE_LEN]; //!< Pending frames
+    uint8_t head;                                       //!< Oldest pending frame
+    uint8_t count;                                      //!< Pending frames
+    uint16_t offset;                                    //!< Bytes of the head frame already sent
+    int64_t progress_us;                                //!< Last time the socket accepted data
+    uint32_t dropped;                                   //!< Frames dropped on a full ring
+} local_api_ws_client_t;
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "LOCAL_API";
+
+static httpd_handle_t g_api_server = NULL;
+static local_api_command_callback_t command_callback = NULL;
+static local_api_history_reader_t history_reader = NULL;
+static uint32_t command_counter = 0;
+
+// Only touched from the HTTP server task
+static history_sample_t history_samples[LOCAL_API_HISTORY_BATCH];
+static char history_chunk[LOCAL_API_HISTORY_CHUNK];
+
+static portMUX_TYPE buffer_lock = portMUX_INITIALIZER_UNLOCKED;
+static local_api_buffer_t buffers[LOCAL_API_TOPIC_MAX];
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+static const char *topic_names[LOCAL_API_TOPIC_MAX] = {"state", "data"};
+
+// Only touched from the HTTP server task (handlers, close_fn, queued work)
+static local_api_ws_client_t ws_clients[LOCAL_API_WS_MAX_CLIENTS];
+static esp_timer_handle_t ws_retry_timer = NULL;
+
+// Set from any task under buffer_lock, cleared when the queued work starts
+static bool ws_fanout_queued = false;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief HTTP GET handler for /api/state
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t api_state_handler(httpd_req_t *req);
+
+/**
+ * @brief HTTP GET handler for /api/data
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t api_data_handler(httpd_req_t *req);
+
+/**
+ * @brief HTTP POST handler for /api/devices
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t api_devices_handler(httpd_req_t *req);
+
+/**
+ * @brief HTTP POST handler for /api/mode
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t api_mode_handler(httpd_req_t *req);
+
+/**
+ * @brief HTTP GET handler for /api/history
+ *
+ * Query: from, to (Unix seconds), optional cursor and limit. Samples are
+ * streamed in chunks; a response cut at limit has "more" set and the
+ * cursor to pass with the next request.
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t api_history_handler(httpd_req_t *req);
+
+/**
+ * @brief Read an unsigned query parameter
+ *
+ * @param[in] query Query string
+ * @param[in] key Parameter name
+ * @param[in] fallback Value when the parameter is absent
+ *
+ * @return Parameter value
+ */
+static uint32_t local_api_query_u32(const char *query, const char *key, uint32_t fallback);
+
+/**
+ * @brief Check bearer token and that the request arrived on the STA interface
+ *
+ * Sends the error response itself when the request is rejected.
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return true if the request may proceed
+ */
+static bool local_api_authorize(httpd_req_t *req);
+
+/**
+ * @brief Check that the request arrived on the station interface
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return true if the local socket address is the STA IP
+ */
+static bool local_api_on_sta(httpd_req_t *req);
+
+/**
+ * @brief Compare a candidate token with the configured one in constant time
+ *
+ * @param[in] candidate Token sent by the client
+ *
+ * @return true if the token matches
+ */
+static bool local_api_token_valid(const char *candidate);
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+/**
+ * @brief WebSocket handler for /api/ws
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return ESP_OK on success, ESP_FAIL closes the connection
+ */
+static esp_err_t api_ws_handler(httpd_req_t *req);
+
+/**
+ * @brief Send changed topics to every WebSocket client (HTTP server task)
+ *
+ * @param[in] arg Server handle the work was queued on
+ */
+static void local_api_ws_fanout(void *arg);
+
+/**
+ * @brief Schedule a fan-out on the HTTP server task
+ */
+static void local_api_ws_schedule(void);
+
+/**
+ * @brief Retry timer callback, schedules a fan-out to drain pending frames
+ *
+ * @param[in] arg Unused
+ */
+static void local_api_ws_retry(void *arg);
+
+/**
+ * @brief Encode a text frame and append it to a client's ring
+ *
+ * @param[in,out] client Client slot
+ * @param[in] payload Frame payload
+ * @param[in] len Payload length, at most LOCAL_API_WS_FRAME_SIZE
+ */
+static void local_api_ws_enqueue(local_api_ws_client_t *client, const char *payload, size_t len);
+
+/**
+ * @brief Send pending frames of a client without blocking
+ *
+ * Closes the client on a socket error or when it has not accepted a byte
+ * for LOCAL_API_WS_STALL_US.
+ *
+ * @param[in] server Server handle
+ * @param[in,out] client Client slot
+ *
+ * @return true if frames are still pending
+ */
+static bool local_api_ws_drain(httpd_handle_t server, local_api_ws_client_t *client);
+
+/**
+ * @brief Session close hook, frees the WebSocket slot of the socket
+ *
+ * @param[in] hd Server handle
+ * @param[in] sockfd Socket being closed
+ */
+static void local_api_close_fn(httpd_handle_t hd, int sockfd);
+#endif
+
+/**
+ * @brief Send a precomputed buffer as JSON response
+ *
+ * @param[in] req Pointer to HTTP request
+ * @param[in] buffer Buffer to send
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t local_api_send_buffer(httpd_req_t *req, local_api_buffer_t *buffer);
+
+/**
+ * @brief Receive and parse a JSON request body
+ *
+ * @param[in] req Pointer to HTTP request
+ *
+ * @return Parsed JSON object, NULL on error (response already sent)
+ */
+static cJSON *local_api_recv_json(httpd_req_t *req);
+
+/**
+ * @brief Hand a validated command to the dispatcher and reply with state
+ *
+ * @param[in] req Pointer to HTTP request
+ * @param[in] command Command name
+ * @param[in] params Command parameters
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t local_api_dispatch(httpd_req_t *req, const char *command, cJSON *params);
+
+/**
+ * @brief Copy JSON into a precomputed buffer
+ *
+ * Unchanged content is ignored so WebSocket clients only receive deltas.
+ *
+ * @param[in] topic Destination topic
+ * @param[in] json JSON text
+ * @param[in] len JSON length
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t local_api_store(local_api_topic_t topic, const char *json, size_t len);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Start the local API server
+ */
+esp_err_t local_api_start(void)
+{
+    if (g_api_server != NULL)
+    {
+        return ESP_OK;
+    }
+
+    if (strlen(LOCAL_API_TOKEN) == 0)
+    {
+        ESP_LOGW(TAG, "No API token configured, local API disabled");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = LOCAL_API_PORT;
+    config.ctrl_port = LOCAL_API_CTRL_PORT;
+    config.max_uri_handlers = 5;
+    config.stack_size = 4096;
+    config.task_priority = TASK_PRIO_NETWORK;
+    config.core_id = TASK_CORE_NETWORK;
+    config.lru_purge_enable = true;
+#if CONFIG_LOCAL_API_WS_ENABLE
+    config.max_uri_handlers = 6;
+    config.send_wait_timeout = 1; // REST replies to a stalled client give up quickly
+    config.close_fn = local_api_close_fn;
+
+    for (int i = 0; i < LOCAL_API_WS_MAX_CLIENTS; i++)
+    {
+        ws_clients[i].fd = -1;
+    }
+    ws_fanout_queued = false;
+
+    if (ws_retry_timer == NULL)
+    {
+        const esp_timer_create_args_t timer_args = {
+            .callback = local_api_ws_retry,
+            .name = "local_api_ws",
+        };
+        esp_err_t timer_ret = esp_timer_create(&timer_args, &ws_retry_timer);
+        if (timer_ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Failed to create WebSocket retry timer: %s", esp_err_to_name(timer_ret));
+            return timer_ret;
+        }
+    }
+#endif
+
+    httpd_handle_t server = NULL;
+    esp_err_t ret = httpd_start(&server, &config);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to start local API server: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    const httpd_uri_t uris[] = {
+        {.uri = "/api/state", .method = HTTP_GET, .handler = api_state_handler},
+        {.uri = "/api/data", .method = HTTP_GET, .handler = api_data_handler},
+        {.uri = "/api/devices", .method = HTTP_POST, .handler = api_devices_handler},
+        {.uri = "/api/mode", .method = HTTP_POST, .handler = api_mode_handler},
+        {.uri = "/api/history", .method = HTTP_GET, .handler = api_history_handler},
+    };
+
+    for (size_t i = 0; i < sizeof(uris) / sizeof(uris[0]); i++)
+    {
+        httpd_register_uri_handler(server, &uris[i]);
+    }
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+    const httpd_uri_t ws_uri = {
+        .uri = "/api/ws",
+        .method = HTTP_GET,
+        .handler = api_ws_handler,
+        .is_websocket = true,
+    };
+    httpd_register_uri_handler(server, &ws_uri);
+#endif
+
+    // Published only once the handlers are in place
+    portENTER_CRITICAL(&buffer_lock);
+    g_api_server = server;
+    portEXIT_CRITICAL(&buffer_lock);
+
+    ESP_LOGI(TAG, "Local API started on port %d", LOCAL_API_PORT);
+    return ESP_OK;
+}
+
+/**
+ * @brief Stop the local API server
+ */
+esp_err_t local_api_stop(void)
+{
+    // Cleared under the lock so no publisher queues work on a freed server
+    httpd_handle_t server;
+
+    portENTER_CRITICAL(&buffer_lock);
+    server = g_api_server;
+    g_api_server = NULL;
+    portEXIT_CRITICAL(&buffer_lock);
+
+    if (server == NULL)
+    {
+        return ESP_OK;
+    }
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+    esp_timer_stop(ws_retry_timer);
+
+    // A fan-out already handed to httpd_queue_work runs before the server
+    // shuts down; wait until it has started so it is never dropped half queued
+    bool pending = true;
+    while (pending)
+    {
+        portENTER_CRITICAL(&buffer_lock);
+        pending = ws_fanout_queued;
+        portEXIT_CRITICAL(&buffer_lock);
+
+        if (pending)
+        {
+            vTaskDelay(pdMS_TO_TICKS(LOCAL_API_WS_STOP_POLL_MS));
+        }
+    }
+#endif
+
+    esp_err_t ret = httpd_stop(server);
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+    // Never left set across a restart, or telemetry would stay silent
+    portENTER_CRITICAL(&buffer_lock);
+    ws_fanout_queued = false;
+    portEXIT_CRITICAL(&buffer_lock);
+#endif
+
+    ESP_LOGI(TAG, "Local API stopped");
+    return ret;
+}
+
+/**
+ * @brief Register the command dispatcher
+ */
+void local_api_register_command_callback(local_api_command_callback_t callback)
+{
+    command_callback = callback;
+}
+
+/**
+ * @brief Register the reader serving /api/history
+ */
+void local_api_register_history_reader(local_api_history_reader_t reader)
+{
+    history_reader = reader;
+}
+
+/**
+ * @brief Replace the precomputed /api/state response
+ */
+esp_err_t local_api_set_state(const char *json, size_t len)
+{
+    return local_api_store(LOCAL_API_TOPIC_STATE, json, len);
+}
+
+/**
+ * @brief Replace the precomputed /api/data response
+ */
+esp_err_t local_api_set_data(const char *json, size_t len)
+{
+    return local_api_store(LOCAL_API_TOPIC_DATA, json, len);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief HTTP GET handler for /api/state
+ */
+static esp_err_t api_state_handler(httpd_req_t *req)
+{
+    if (!local_api_authorize(req))
+    {
+        return ESP_OK;
+    }
+
+    return local_api_send_buffer(req, &buffers[LOCAL_API_TOPIC_STATE]);
+}
+
+/**
+ * @brief HTTP GET handler for /api/data
+ */
+static esp_err_t api_data_handler(httpd_req_t *req)
+{
+    if (!local_api_authorize(req))
+    {
+        return ESP_OK;
+    }
+
+    return local_api_send_buffer(req, &buffers[LOCAL_API_TOPIC_DATA]);
+}
+
+/**
+ * @brief HTTP POST handler for /api/devices
+ *
+ * Body is either {"device":"fan","state":1} or any subset of
+ * {"fan":1,"light":0,"ac":1}.
+ */
+static esp_err_t api_devices_handler(httpd_req_t *req)
+{
+    static const char *devices[] = {"fan", "light", "ac"};
+
+    if (!local_api_authorize(req))
+    {
+        return ESP_OK;
+    }
+
+    cJSON *root = local_api_recv_json(req);
+    if (root == NULL)
+    {
+        return ESP_OK;
+    }
+
+    const char *command = NULL;
+    const char *device = json_helper_get_string(root, "device", NULL);
+
+    if (device != NULL)
+    {
+        int state = json_helper_get_int(root, "state", -1);
+        bool known = false;
+
+        for (size_t i = 0; i < sizeof(devices) / sizeof(devices[0]); i++)
+        {
+            known |= (strcmp(device, devices[i]) == 0);
+        }
+
+        if (known && (state == 0 || state == 1))
+        {
+            command = "set_device";
+        }
+    }
+    else
+    {
+        int present = 0;
+        bool valid = true;
+
+        for (size_t i = 0; i < sizeof(devices) / sizeof(devices[0]); i++)
+        {
+            int state = json_helper_get_int(root, devices[i], -1);
+            if (state != -1)
+            {
+                present++;
+                valid &= (state == 0 || state == 1);
+            }
+        }
+
+        if (present > 0 && valid)
+        {
+            command = "set_devices";
+        }
+    }
+
+    if (command == NULL)
+    {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid device request");
+        return ESP_OK;
+    }
+
+    esp_err_t ret = local_api_dispatch(req, command, root);
+    cJSON_Delete(root);
+    return ret;
+}
+
+/**
+ * @brief HTTP POST handler for /api/mode
+ */
+static esp_err_t api_mode_handler(httpd_req_t *req)
+{
+    if (!local_api_authorize(req))
+    {
+        return ESP_OK;
+    }
+
+    cJSON *root = local_api_recv_json(req);
+    if (root == NULL)
+    {
+        return ESP_OK;
+    }
+
+    int mode = json_helper_get_int(root, "mode", -1);
+    if (mode != 0 && mode != 1)
+    {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid mode");
+        return ESP_OK;
+    }
+
+    esp_err_t ret = local_api_dispatch(req, "set_mode", root);
+    cJSON_Delete(root);
+    return ret;
+}
+
+/**
+ * @brief HTTP GET handler for /api/history
+ */
+static esp_err_t api_history_handler(httpd_req_t *req)
+{
+    if (!local_api_authorize(req))
+    {
+        return ESP_OK;
+    }
+
+    local_api_history_reader_t reader = history_reader;
+    if (reader == NULL)
+    {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
+    }
+
+    char query[LOCAL_API_QUERY_SIZE] = "";
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+
+    uint32_t from = local_api_query_u32(query, "from", 0);
+    uint32_t to = local_api_query_u32(query, "to", UINT32_MAX);
+    uint32_t cursor = local_api_query_u32(query, "cursor", 0);
+    uint32_t limit = local_api_query_u32(query, "limit", LOCAL_API_HISTORY_LIMIT);
+    if (limit == 0 || limit > LOCAL_API_HISTORY_LIMIT)
+    {
+        limit = LOCAL_API_HISTORY_LIMIT;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    // [timestamp, temperature, humidity, light] per sample keeps a week
+    // of history pageable without building it in RAM
+    esp_err_t ret = httpd_resp_send_chunk(req, "{\"samples\":[", HTTPD_RESP_USE_STRLEN);
+    uint32_t sent = 0;
+    bool more = true;
+
+    while (ret == ESP_OK && more && sent < limit)
+    {
+        size_t want = limit - sent;
+        if (want > LOCAL_API_HISTORY_BATCH)
+        {
+            want = LOCAL_API_HISTORY_BATCH;
+        }
+
+        size_t n = reader(&cursor, from, to, history_samples, want, &more);
+        if (n == 0)
+        {
+            break;
+        }
+
+        int len = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const history_sample_t *s = &history_samples[i];
+            len += snprintf(&history_chunk[len], sizeof(history_chunk) - len, "%s[%lu,%.2f,%.2f,%u]",
+                            (sent + i > 0) ? "," : "", (unsigned long)s->timestamp,
+                            s->temperature / 100.0f, s->humidity / 100.0f, s->light);
+        }
+
+        sent += n;
+        ret = httpd_resp_send_chunk(req, history_chunk, len);
+    }
+
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    int len = snprintf(history_chunk, sizeof(history_chunk), "],\"more\":%s,\"cursor\":%lu}",
+                       more ? "true" : "false", (unsigned long)cursor);
+    ret = httpd_resp_send_chunk(req, history_chunk, len);
+    if (ret == ESP_OK)
+    {
+        ret = httpd_resp_send_chunk(req, NULL, 0);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Check bearer token and that the request arrived on the STA interface
+ */
+static bool local_api_authorize(httpd_req_t *req)
+{
+    // Only the station interface: never expose control on the provisioning AP
+    if (!local_api_on_sta(req))
+    {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found");
+        return false;
+    }
+
+    char auth[LOCAL_API_AUTH_SIZE];
+    size_t prefix_len = strlen(LOCAL_API_AUTH_PREFIX);
+    bool ok = false;
+
+    if (httpd_req_get_hdr_value_str(req, "Authorization", auth, sizeof(auth)) == ESP_OK &&
+        strncmp(auth, LOCAL_API_AUTH_PREFIX, prefix_len) == 0)
+    {
+        ok = local_api_token_valid(auth + prefix_len);
+    }
+
+    if (!ok)
+    {
+        httpd_resp_set_hdr(req, "WWW-Authenticate", "Bearer");
+        httpd_resp_send_err(req, HTTPD_401_UNAUTHORIZED, "Unauthorized");
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Check that the request arrived on the station interface
+ */
+static bool local_api_on_sta(httpd_req_t *req)
+{
+    struct sockaddr_storage local_addr;
+    socklen_t addr_len = sizeof(local_addr);
+    uint32_t local_ip = 0;
+
+    if (getsockname(httpd_req_to_sockfd(req), (struct sockaddr *)&local_addr, &addr_len) == 0)
+    {
+        if (local_addr.ss_family == AF_INET)
+        {
+            local_ip = ((struct sockaddr_in *)&local_addr)->sin_addr.s_addr;
+        }
+        else if (local_addr.ss_family == AF_INET6)
+        {
+            // IPv4-mapped IPv6 address, IPv4 part in the last 4 bytes
+            memcpy(&local_ip, &((struct sockaddr_in6 *)&local_addr)->sin6_addr.s6_addr[12], 4);
+        }
+    }
+
+    esp_netif_ip_info_t ip_info;
+    return (wifi_manager_get_ip_info(&ip_info) == ESP_OK) && (ip_info.ip.addr == local_ip);
+}
+
+/**
+ * @brief Read an unsigned query parameter
+ */
+static uint32_t local_api_query_u32(const char *query, const char *key, uint32_t fallback)
+{
+    char value[12];
+
+    if (httpd_query_key_value(query, key, value, sizeof(value)) != ESP_OK)
+    {
+        return fallback;
+    }
+
+    return (uint32_t)strtoul(value, NULL, 10);
+}
+
+/**
+ * @brief Compare a candidate token with the configured one in constant time
+ */
+static bool local_api_token_valid(const char *candidate)
+{
+    const char *token = LOCAL_API_TOKEN;
+    size_t token_len = strlen(token);
+
+    if (strlen(candidate) != token_len)
+    {
+        return false;
+    }
+
+    // Constant-time compare so response timing does not leak the token
+    uint8_t diff = 0;
+    for (size_t i = 0; i < token_len; i++)
+    {
+        diff |= (uint8_t)(candidate[i] ^ token[i]);
+    }
+
+    return diff == 0;
+}
+
+/**
+ * @brief Send a precomputed buffer as JSON response
+ */
+static esp_err_t local_api_send_buffer(httpd_req_t *req, local_api_buffer_t *buffer)
+{
+    // Copy out under the lock, the socket write may block
+    char body[LOCAL_API_BUFFER_SIZE];
+    size_t len;
+
+    portENTER_CRITICAL(&buffer_lock);
+    len = buffer->len;
+    memcpy(body, buffer->json, len);
+    portEXIT_CRITICAL(&buffer_lock);
+
+    if (len == 0)
+    {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, body, len);
+}
+
+/**
+ * @brief Receive and parse a JSON request body
+ */
+static cJSON *local_api_recv_json(httpd_req_t *req)
+{
+    char content[LOCAL_API_BODY_SIZE];
+
+    if (req->content_len == 0 || req->content_len >= sizeof(content))
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid body size");
+        return NULL;
+    }
+
+    int received = 0;
+    while (received < (int)req->content_len)
+    {
+        int ret = httpd_req_recv(req, content + received, req->content_len - received);
+        if (ret <= 0)
+        {
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT)
+            {
+                continue;
+            }
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid request");
+            return NULL;
+        }
+        received += ret;
+    }
+    content[received] = '\0';
+
+    cJSON *root = cJSON_Parse(content);
+    if (root == NULL || !cJSON_IsObject(root))
+    {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+        return NULL;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Hand a validated command to the dispatcher and reply with state
+ */
+static esp_err_t local_api_dispatch(httpd_req_t *req, const char *command, cJSON *params)
+{
+    local_api_command_callback_t callback = command_callback;
+
+    if (callback == NULL)
+    {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "No command handler");
+        return ESP_OK;
+    }
+
+    char cmd_id[24];
+    snprintf(cmd_id, sizeof(cmd_id), "local-%lu", (unsigned long)++command_counter);
+
+    ESP_LOGI(TAG, "[%s] %s", cmd_id, command);
+
+    // Handlers run synchronously and refresh the state buffer before returning
+    const char *status = callback(cmd_id, command, params);
+
+    if (status == NULL || strcmp(status, "error") == 0)
+    {
+        ESP_LOGW(TAG, "[%s] %s failed", cmd_id, command);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Command failed");
+        return ESP_OK;
+    }
+
+    return local_api_send_buffer(req, &buffers[LOCAL_API_TOPIC_STATE]);
+}
+
+/**
+ * @brief Copy JSON into a precomputed buffer
+ */
+static esp_err_t local_api_store(local_api_topic_t topic, const char *json, size_t len)
+{
+    if (json == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (len >= LOCAL_API_BUFFER_SIZE)
+    {
+        ESP_LOGW(TAG, "Response too large (%u bytes)", (unsigned)len);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    local_api_buffer_t *buffer = &buffers[topic];
+    bool changed = false;
+
+    portENTER_CRITICAL(&buffer_lock);
+    if (buffer->len != len || memcmp(buffer->json, json, len) != 0)
+    {
+        memcpy(buffer->json, json, len);
+        buffer->len = len;
+        buffer->seq++;
+        changed = true;
+    }
+    portEXIT_CRITICAL(&buffer_lock);
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+    if (changed)
+    {
+        local_api_ws_schedule();
+    }
+#else
+    (void)changed;
+#endif
+
+    return ESP_OK;
+}
+
+#if CONFIG_LOCAL_API_WS_ENABLE
+
+/**
+ * @brief WebSocket handler for /api/ws
+ */
+static esp_err_t api_ws_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_GET)
+    {
+        // Handshake is done; browsers cannot set headers, so the token comes
+        // as ?token=. Returning ESP_FAIL closes the connection.
+        char query[LOCAL_API_AUTH_SIZE];
+        char token[LOCAL_API_AUTH_SIZE];
+
+        if (!local_api_on_sta(req) ||
+            httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+            httpd_query_key_value(query, "token", token, sizeof(token)) != ESP_OK ||
+            !local_api_token_valid(token))
+        {
+            ESP_LOGW(TAG, "WebSocket client rejected");
+            return ESP_FAIL;
+        }
+
+        int fd = httpd_req_to_sockfd(req);
+        for (int i = 0; i < LOCAL_API_WS_MAX_CLIENTS; i++)
+        {
+            if (ws_clients[i].fd < 0)
+            {
+                // Sequence 0 is never current, the next fan-out sends a snapshot
+                memset(&ws_clients[i], 0, sizeof(ws_clients[i]));
+                ws_clients[i].fd = fd;
+                ws_clients[i].progress_us = esp_timer_get_time();
+                ESP_LOGI(TAG, "WebSocket client %d connected", fd);
+                local_api_ws_schedule();
+                return ESP_OK;
+            }
+        }
+
+        ESP_LOGW(TAG, "WebSocket client limit reached");
+        return ESP_FAIL;
+    }
+
+    // Push-only stream: read and discard whatever the client sends
+    uint8_t payload[LOCAL_API_BODY_SIZE];
+    httpd_ws_frame_t frame = {0};
+
+    esp_err_t ret = httpd_ws_recv_frame(req, &frame, 0);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    if (frame.len >= sizeof(payload))
+    {
+        return ESP_FAIL;
+    }
+
+    if (frame.len > 0)
+    {
+        frame.payload = payload;
+        ret = httpd_ws_recv_frame(req, &frame, frame.len);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Send changed topics to every WebSocket client (HTTP server task)
+ */
+static void local_api_ws_fanout(void *arg)
+{
+    httpd_handle_t server = arg;
+
+    // Single encoded frame per topic, copied into the ring of each client
+    static char frame_buf[LOCAL_API_WS_FRAME_SIZE];
+    bool pending = false;
+
+    portENTER_CRITICAL(&buffer_lock);
+    ws_fanout_queued = false;
+    portEXIT_CRITICAL(&buffer_lock);
+
+    for (int topic = 0; topic < LOCAL_API_TOPIC_MAX; topic++)
+    {
+        int header_len = snprintf(frame_buf, sizeof(frame_buf),
+                                  "{\"topic\":\"%s\",\"payload\":", topic_names[topic]);
+        size_t len;
+        uint32_t seq;
+
+        portENTER_CRITICAL(&buffer_lock);
+        len = buffers[topic].len;
+        seq = buffers[topic].seq;
+        memcpy(frame_buf + header_len, buffers[topic].json, len);
+        portEXIT_CRITICAL(&buffer_lock);
+
+        if (len == 0)
+        {
+            continue;
+        }
+
+        len += header_len;
+        frame_buf[len++] = '}';
+
+        for (int i = 0; i < LOCAL_API_WS_MAX_CLIENTS; i++)
+        {
+            local_api_ws_client_t *client = &ws_clients[i];
+
+            if (client->fd < 0 || client->sent_seq[topic] == seq)
+            {
+                continue;
+            }
+
+            local_api_ws_enqueue(client, frame_buf, len);
+            client->sent_seq[topic] = seq;
+        }
+    }
+
+    for (int i = 0; i < LOCAL_API_WS_MAX_CLIENTS; i++)
+    {
+        if (ws_clients[i].fd >= 0 && local_api_ws_drain(server, &ws_clients[i]))
+        {
+            pending = true;
+        }
+    }
+
+    // Fails harmlessly when the timer is already armed
+    if (pending)
+    {
+        esp_timer_start_once(ws_retry_timer, LOCAL_API_WS_RETRY_US);
+    }
+}
+
+/**
+ * @brief Retry timer callback, schedules a fan-out to drain pending frames
+ */
+static void local_api_ws_retry(void *arg)
+{
+    local_api_ws_schedule();
+}
+
+/**
+ * @brief Encode a text frame and append it to a client's ring
+ */
+static void local_api_ws_enqueue(local_api_ws_client_t *client, const char *payload, size_t len)
+{
+    if (client->count == LOCAL_API_WS_QUEUE_LEN)
+    {
+        // A partly sent head frame must be completed, drop the one after it
+        int victim = (client->offset > 0) ? (client->head + 1) % LOCAL_API_WS_QUEUE_LEN : client->head;
+
+        if (victim == client->head)
+        {
+            client->head = (client->head + 1) % LOCAL_API_WS_QUEUE_LEN;
+        }
+        else
+        {
+            // Close the gap so the ring stays contiguous
+            for (int n = 1; n < client->count - 1; n++)
+            {
+                int to = (client->head + n) % LOCAL_API_WS_QUEUE_LEN;
+                int from = (to + 1) % LOCAL_API_WS_QUEUE_LEN;
+                client->queue[to] = client->queue[from];
+            }
+        }
+        client->count--;
+
+        if (client->dropped++ == 0)
+        {
+            ESP_LOGW(TAG, "WebSocket client %d behind, dropping oldest frames", client->fd);
+        }
+    }
+
+    local_api_ws_frame_t *frame = &client->queue[(client->head + client->count) % LOCAL_API_WS_QUEUE_LEN];
+    size_t header_len;
+
+    // Server frames are unmasked: FIN + text opcode, then the payload length
+    frame->data[0] = 0x81;
+    if (len < 126)
+    {
+        frame->data[1] = (uint8_t)len;
+        header_len = 2;
+    }
+    else
+    {
+        frame->data[1] = 126;
+        frame->data[2] = (uint8_t)(len >> 8);
+        frame->data[3] = (uint8_t)len;
+        header_len = 4;
+    }
+
+    memcpy(frame->data + header_len, payload, len);
+    frame->len = (uint16_t)(header_len + len);
+    client->count++;
+}
+
+/**
+ * @brief Send pending frames of a client without blocking
+ */
+static bool local_api_ws_drain(httpd_handle_t server, local_api_ws_client_t *client)
+{
+    int64_t now = esp_timer_get_time();
+
+    while (client->count > 0)
+    {
+        local_api_ws_frame_t *frame = &client->queue[client->head];
+        ssize_t sent = send(client->fd, frame->data + client->offset, frame->len - client->offset, MSG_DONTWAIT);
+
+        if (sent < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                ESP_LOGW(TAG, "WebSocket client %d send failed (errno %d), closing", client->fd, errno);
+                break;
+            }
+
+            if (now - client->progress_us < LOCAL_API_WS_STALL_US)
+            {
+                return true;
+            }
+
+            ESP_LOGW(TAG, "WebSocket client %d stalled, closing", client->fd);
+            break;
+        }
+
+        client->progress_us = now;
+        client->offset += (uint16_t)sent;
+        if (client->offset == frame->len)
+        {
+            client->head = (client->head + 1) % LOCAL_API_WS_QUEUE_LEN;
+            client->count--;
+            client->offset = 0;
+        }
+    }
+
+    if (client->count > 0)
+    {
+        httpd_sess_trigger_close(server, client->fd);
+        client->fd = -1;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Schedule a fan-out on the HTTP server task
+ */
+static void local_api_ws_schedule(void)
+{
+    httpd_handle_t server = NULL;
+
+    portENTER_CRITICAL(&buffer_lock);
+    if (g_api_server != NULL && !ws_fanout_queued)
+    {
+        ws_fanout_queued = true;
+        server = g_api_server;
+    }
+    portEXIT_CRITICAL(&buffer_lock);
+
+    // Updates arriving before the work runs are merged into one fan-out
+    if (server != NULL && httpd_queue_work(server, local_api_ws_fanout, server) != ESP_OK)
+    {
+        portENTER_CRITICAL(&buffer_lock);
+        ws_fanout_queued = false;
+        portEXIT_CRITICAL(&buffer_lock);
+    }
+}
+
+/**
+ * @brief Session close hook, frees the WebSocket slot of the socket
+ */
+static void local_api_close_fn(httpd_handle_t hd, int sockfd)
+{
+    for (int i = 0; i < LOCAL_API_WS_MAX_CLIENTS; i++)
+    {
+        if (ws_clients[i].fd == sockfd)
+        {
+            ws_clients[i].fd = -1;
+            ESP_LOGI(TAG, "WebSocket client %d disconnected", sockfd);
+        }
+    }
+
+    close(sockfd);
+}
+
+#endif /* CONFIG_LOCAL_API_WS_ENABLE */
+
+#else /* CONFIG_LOCAL_API_ENABLE */
+
+esp_err_t local_api_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t local_api_stop(void)
+{
+    return ESP_OK;
+}
+
+void local_api_register_command_callback(local_api_command_callback_t callback)
+{
+}
+
+void local_api_register_history_reader(local_api_history_reader_t reader)
+{
+}
+
+esp_err_t local_api_set_state(const char *json, size_t len)
+{
+    return ESP_OK;
+}
+
+esp_err_t local_api_set_data(const char *json, size_t len)
+{
+    return ESP_OK;
+}
+
+#endif /* CONFIG_LOCAL_API_ENABLE */
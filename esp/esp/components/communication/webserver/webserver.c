@@ -10,6 +10,7 @@
 #include "esp_log.h"
 #include "esp_system.h"
 #include "json_helper.h"
+#include "task_registry.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "wifi_manager.h"
@@ -116,6 +117,8 @@ esp_err_t webserver_start(void)
     config.server_port = HTTP_SERVER_PORT;
     config.max_uri_handlers = 8;
     config.stack_size = 8192;
+    config.task_priority = TASK_PRIO_NETWORK;
+    config.core_id = TASK_CORE_NETWORK;
 
     esp_err_t ret = httpd_start(&g_server, &config);
     if (ret != ESP_OK)
@@ -251,7 +254,7 @@ static esp_err_t scan_handler(httpd_req_t *req)
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json_str, strlen(json_str));
 
-    free(json_str);
+    cJSON_free(json_str);
 
     return ESP_OK;
 }
@@ -304,7 +307,7 @@ static esp_err_t connect_handler(httpd_req_t *req)
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json_str, strlen(json_str));
-    free(json_str);
+    cJSON_free(json_str);
 
     ESP_LOGI(TAG, "Received credentials, restarting to connect");
 
@@ -344,7 +347,7 @@ static esp_err_t status_handler(httpd_req_t *req)
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json_str, strlen(json_str));
-    free(json_str);
+    cJSON_free(json_str);
 
     return ESP_OK;
 }
@@ -365,7 +368,7 @@ static esp_err_t reset_handler(httpd_req_t *req)
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json_str, strlen(json_str));
-    free(json_str);
+    cJSON_free(json_str);
 
     vTaskDelay(pdMS_TO_TICKS(1000));
     esp_restart();
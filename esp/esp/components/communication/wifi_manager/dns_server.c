@@ -11,6 +11,7 @@
 #include "freertos/task.h"
 #include "lwip/sockets.h"
 #include "wifi_config.h"
+#include "task_registry.h"
 #include <string.h>
 
 /* Private defines -----------------------------------------------------------*/
@@ -22,6 +23,7 @@
 static const char *TAG = "DNS_SERVER";
 static TaskHandle_t g_dns_task = NULL;
 static int g_dns_socket = -1;
+TASK_REGISTRY_STORAGE(dns_task, TASK_STACK_DNS_SERVER);
 
 /* Private types ------------------------------------------------------------*/
 
@@ -58,8 +60,9 @@ esp_err_t dns_server_start(void)
         return ESP_OK;
     }
 
-    BaseType_t ret = xTaskCreate(dns_server_task, "dns_server", 4096, NULL, 5, &g_dns_task);
-    if (ret != pdPASS)
+    esp_err_t ret = task_registry_create_static(TASK_ID_DNS_SERVER, dns_server_task, NULL,
+                                                dns_task_stack, &dns_task_tcb, &g_dns_task);
+    if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to create DNS server task");
         return ESP_FAIL;
@@ -86,12 +89,14 @@ esp_err_t dns_server_stop(void)
         g_dns_socket = -1;
     }
 
-    // Wait for task to self-cleanup
+    // Wait for task to self-cleanup; the idle task must release the static
+    // TCB before dns_server_start() can reuse it
     vTaskDelay(pdMS_TO_TICKS(100));
 
     // If still running, force delete
     if (g_dns_task != NULL)
     {
+        task_registry_remove(TASK_ID_DNS_SERVER);
         vTaskDelete(g_dns_task);
         g_dns_task = NULL;
     }
@@ -120,6 +125,7 @@ static void dns_server_task(void *pvParameters)
     if (g_dns_socket < 0)
     {
         ESP_LOGE(TAG, "Failed to create socket");
+        task_registry_remove(TASK_ID_DNS_SERVER);
         g_dns_task = NULL; // Clear task handle before exit
         vTaskDelete(NULL);
         return;
@@ -135,6 +141,7 @@ static void dns_server_task(void *pvParameters)
         ESP_LOGE(TAG, "Failed to bind socket");
         close(g_dns_socket);
         g_dns_socket = -1;
+        task_registry_remove(TASK_ID_DNS_SERVER);
         g_dns_task = NULL; // Clear task handle before exit
         vTaskDelete(NULL);
         return;
@@ -207,6 +214,7 @@ static void dns_server_task(void *pvParameters)
         close(g_dns_socket);
         g_dns_socket = -1;
     }
+    task_registry_remove(TASK_ID_DNS_SERVER);
     g_dns_task = NULL;
     ESP_LOGI(TAG, "DNS server task exiting");
     vTaskDelete(NULL);
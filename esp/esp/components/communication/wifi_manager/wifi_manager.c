@@ -17,6 +17,7 @@
 #include "freertos/semphr.h"
 #include "wifi_manager.h"
 #include "webserver.h"
+#include "app_state.h"
 #include <string.h>
 
 /* Private defines -----------------------------------------------------------*/
@@ -48,6 +49,8 @@ typedef struct
     esp_netif_t *ap_netif;          //!< Access point network interface
     EventGroupHandle_t event_group; //!< Event group for WiFi events
     SemaphoreHandle_t mutex;        //!< Mutex for thread-safe access
+    StaticEventGroup_t event_group_buffer; //!< Static storage for event_group
+    StaticSemaphore_t mutex_buffer;        //!< Static storage for mutex
     wifi_event_callback_t callback; //!< Event callback
     uint8_t retry_count;            //!< Retry count for connection attempts
     char ssid[32];                  //!< WiFi SSID
@@ -56,14 +59,6 @@ typedef struct
     bool initialized;               //!< Initialization status
 } wifi_manager_context_t;
 
-/* Exported variables --------------------------------------------------------*/
-
-bool isWiFi = false; //!< Global WiFi connection state indicator
-
-/* External variables --------------------------------------------------------*/
-
-extern bool isWiFiConnecting;
-
 /* Private variables ---------------------------------------------------------*/
 
 static const char *TAG = "WIFI_MANAGER";
@@ -110,13 +105,13 @@ esp_err_t wifi_manager_init(void)
         return ESP_OK;
     }
 
-    g_wifi_ctx.mutex = xSemaphoreCreateMutex();
+    g_wifi_ctx.mutex = xSemaphoreCreateMutexStatic(&g_wifi_ctx.mutex_buffer);
     if (g_wifi_ctx.mutex == NULL)
     {
         return ESP_ERR_NO_MEM;
     }
 
-    g_wifi_ctx.event_group = xEventGroupCreate();
+    g_wifi_ctx.event_group = xEventGroupCreateStatic(&g_wifi_ctx.event_group_buffer);
     if (g_wifi_ctx.event_group == NULL)
     {
         vSemaphoreDelete(g_wifi_ctx.mutex);
@@ -517,7 +512,7 @@ esp_err_t wifi_manager_clear_credentials(void)
 
         ESP_LOGI(TAG, "Credentials cleared");
 
-        isWiFi = false;
+        app_state_set_wifi_connected(false);
     }
 
     return ret;
@@ -584,7 +579,7 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t e
         }
 
         g_wifi_ctx.state = WIFI_STATE_DISCONNECTED;
-        isWiFi = false; // Update global state
+        app_state_set_wifi_connected(false);
 
         // Check retry count and increment atomically
         bool should_retry = (g_wifi_ctx.retry_count < WIFI_RECONNECT_MAX);
@@ -609,11 +604,11 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t e
             retry_count += 1;
             ESP_LOGI(TAG, "Retry connecting (%d/%d)", current_retry, WIFI_RECONNECT_MAX);
 
-            isWiFiConnecting = true;
+            app_state_set_wifi_connecting(true);
 
             if (retry_count > WIFI_RECONNECT_MAX - 1)
             {
-                isWiFiConnecting = false;
+                app_state_set_wifi_connecting(false);
                 retry_count = 0;
             }
             esp_wifi_connect();
@@ -646,7 +641,7 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t e
         g_wifi_ctx.retry_count = 0;
         g_wifi_ctx.state = WIFI_STATE_CONNECTED;
 
-        isWiFi = true; // Update global state
+        app_state_set_wifi_connected(true);
 
         xEventGroupSetBits(g_wifi_ctx.event_group, WIFI_CONNECTED_BIT);
         wifi_event_callback_t callback = g_wifi_ctx.callback;
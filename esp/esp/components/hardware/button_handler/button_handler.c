@@ -8,9 +8,7 @@
 
 #include "button_handler.h"
 #include "esp_log.h"
-#include "esp_task_wdt.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
+#include "esp_attr.h"
 
 /* Private defines -----------------------------------------------------------*/
 static const char *TAG = "BUTTON_HANDLER";
@@ -41,16 +39,19 @@ static button_t buttons[BUTTON_MAX] = {
 };
 
 static volatile bool initialized = false;
-static TaskHandle_t poll_task_handle = NULL;
+
+// Wakeup notification, armed while no scan is in progress
+static button_wakeup_callback_t wakeup_callback = NULL;
+static volatile bool wakeup_armed = false;
 
 /* Private function prototypes ------------------------------------------------*/
 
 /**
- * @brief Button polling task
+ * @brief GPIO edge interrupt handler shared by all buttons
  *
- * @param[in] arg Task argument (unused)
+ * @param[in] arg Button index (unused)
  */
-static void button_poll_task(void *arg);
+static void button_isr_handler(void *arg);
 
 /* Exported functions ---------------------------------------------------------*/
 
@@ -69,17 +70,27 @@ esp_err_t button_handler_init(void)
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_ENABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
     };
 
+    // Shared GPIO ISR service may already be installed by another driver
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE)
+    {
+        ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
     for (int i = 0; i < BUTTON_MAX; i++)
     {
         io_conf.pin_bit_mask = (1ULL << buttons[i].pin);
-        if (gpio_config(&io_conf) != ESP_OK)
+        if (gpio_config(&io_conf) != ESP_OK ||
+            gpio_isr_handler_add(buttons[i].pin, button_isr_handler, (void *)(intptr_t)i) != ESP_OK)
         {
             // Cleanup already configured GPIOs
-            for (int j = 0; j < i; j++)
+            for (int j = 0; j <= i; j++)
             {
+                gpio_isr_handler_remove(buttons[j].pin);
                 gpio_reset_pin(buttons[j].pin);
             }
             return ESP_FAIL;
@@ -87,20 +98,101 @@ esp_err_t button_handler_init(void)
         ESP_LOGI(TAG, "%s button on GPIO%d initialized", buttons[i].name, buttons[i].pin);
     }
 
+    wakeup_armed = true;
     initialized = true;
 
-    // Create polling task after setting initialized flag
-    if (xTaskCreate(button_poll_task, "button_poll", 2048, NULL, 5, &poll_task_handle) != pdPASS)
+    return ESP_OK;
+}
+
+/**
+ * @brief Set callback invoked from ISR when a button starts moving
+ */
+esp_err_t button_handler_set_wakeup_callback(button_wakeup_callback_t callback)
+{
+    if (!initialized)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    wakeup_callback = callback;
+    return ESP_OK;
+}
+
+/**
+ * @brief Run one debounce scan over all buttons
+ */
+bool button_handler_poll(void)
+{
+    const uint8_t debounce_threshold = DEBOUNCE_TIME_MS / BUTTON_POLL_INTERVAL_MS;
+    bool busy = false;
+
+    if (!initialized)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < BUTTON_MAX; i++)
     {
-        initialized = false;
+        bool current = (gpio_get_level(buttons[i].pin) == 0); // Active low
+
+        if (current)
+        {
+            // Button is pressed
+            if (buttons[i].debounce_count < debounce_threshold)
+            {
+                buttons[i].debounce_count++;
+            }
+
+            // Stable pressed state reached
+            if (buttons[i].debounce_count >= debounce_threshold && !buttons[i].pressed)
+            {
+                buttons[i].pressed = true;
+                ESP_LOGI(TAG, "%s button pressed", buttons[i].name);
+
+                if (buttons[i].callback)
+                {
+                    buttons[i].callback(i);
+                }
+            }
+        }
+        else
+        {
+            // Button is released
+            if (buttons[i].debounce_count > 0)
+            {
+                buttons[i].debounce_count--;
+            }
+
+            // Stable released state reached
+            if (buttons[i].debounce_count == 0 && buttons[i].pressed)
+            {
+                buttons[i].pressed = false;
+                ESP_LOGD(TAG, "%s button released", buttons[i].name);
+            }
+        }
+
+        if (buttons[i].pressed || buttons[i].debounce_count > 0)
+        {
+            busy = true;
+        }
+    }
+
+    if (!busy)
+    {
+        // Re-arm first, then re-check so an edge between scan and re-arm is not lost
+        wakeup_armed = true;
         for (int i = 0; i < BUTTON_MAX; i++)
         {
-            gpio_reset_pin(buttons[i].pin);
+            if (gpio_get_level(buttons[i].pin) == 0)
+            {
+                wakeup_armed = false;
+                busy = true;
+                break;
+            }
         }
-        return ESP_FAIL;
     }
 
-    return ESP_OK;
+    return busy;
 }
 
 /**
@@ -140,26 +232,14 @@ esp_err_t button_handler_deinit(void)
         return ESP_OK;
     }
 
-    // Set flag first to stop task loop
+    // Set flag first so a running scan becomes a no-op
     initialized = false;
-
-    // Give task time to exit gracefully
-    if (poll_task_handle)
-    {
-        // Wait max 100ms for task to finish
-        for (int i = 0; i < 10; i++)
-        {
-            if (eTaskGetState(poll_task_handle) == eDeleted)
-            {
-                break;
-            }
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-        poll_task_handle = NULL;
-    }
+    wakeup_armed = false;
+    wakeup_callback = NULL;
 
     for (int i = 0; i < BUTTON_MAX; i++)
     {
+        gpio_isr_handler_remove(buttons[i].pin);
         gpio_reset_pin(buttons[i].pin);
         buttons[i].pressed = false;
         buttons[i].debounce_count = 0;
@@ -171,67 +251,22 @@ esp_err_t button_handler_deinit(void)
 /* Private functions ---------------------------------------------------------*/
 
 /**
- * @brief Button polling task
+ * @brief GPIO edge interrupt handler shared by all buttons
  */
-static void button_poll_task(void *arg)
+static void IRAM_ATTR button_isr_handler(void *arg)
 {
-    const uint8_t debounce_threshold = DEBOUNCE_TIME_MS / BUTTON_POLL_INTERVAL_MS;
-
-    // Subscribe to task watchdog
-    esp_task_wdt_add(NULL);
-
-    ESP_LOGI(TAG, "Button poll task subscribed to watchdog");
+    button_wakeup_callback_t callback = wakeup_callback;
 
-    while (initialized)
+    // Contact bounce fires many edges, only the first one starts a scan
+    if (!wakeup_armed || callback == NULL)
     {
-        // Reset watchdog at start of each iteration
-        esp_task_wdt_reset();
-
-        for (int i = 0; i < BUTTON_MAX; i++)
-        {
-            bool current = (gpio_get_level(buttons[i].pin) == 0); // Active low
-
-            if (current)
-            {
-                // Button is pressed
-                if (buttons[i].debounce_count < debounce_threshold)
-                {
-                    buttons[i].debounce_count++;
-                }
-
-                // Stable pressed state reached
-                if (buttons[i].debounce_count >= debounce_threshold && !buttons[i].pressed)
-                {
-                    buttons[i].pressed = true;
-                    ESP_LOGI(TAG, "%s button pressed", buttons[i].name);
-
-                    if (buttons[i].callback)
-                    {
-                        buttons[i].callback(i);
-                    }
-                }
-            }
-            else
-            {
-                // Button is released
-                if (buttons[i].debounce_count > 0)
-                {
-                    buttons[i].debounce_count--;
-                }
-
-                // Stable released state reached
-                if (buttons[i].debounce_count == 0 && buttons[i].pressed)
-                {
-                    buttons[i].pressed = false;
-                    ESP_LOGD(TAG, "%s button released", buttons[i].name);
-                }
-            }
-        }
-
-        vTaskDelay(pdMS_TO_TICKS(BUTTON_POLL_INTERVAL_MS));
+        return;
     }
 
-    // Unsubscribe from watchdog before deleting task
-    esp_task_wdt_delete(NULL);
-    vTaskDelete(NULL);
-}
\ No newline at end of file
+    // Stay armed if the scan could not be scheduled, or no later edge would start one
+    wakeup_armed = false;
+    if (!callback())
+    {
+        wakeup_armed = true;
+    }
+}
@@ -20,6 +20,16 @@
  */
 typedef void (*button_callback_t)(button_type_t button);
 
+/**
+ * @brief Button wakeup callback type
+ *
+ * Invoked from ISR context on the first falling edge while no scan is in
+ * progress. Must be ISR-safe and only schedule button_handler_poll().
+ *
+ * @return true if the scan was scheduled, false to stay armed for the next edge
+ */
+typedef bool (*button_wakeup_callback_t)(void);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -39,6 +49,26 @@ esp_err_t button_handler_init(void);
  */
 esp_err_t button_handler_set_callback(button_type_t button, button_callback_t callback);
 
+/**
+ * @brief Set callback invoked from ISR when a button starts moving
+ *
+ * @param[in] callback ISR-safe wakeup callback
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t button_handler_set_wakeup_callback(button_wakeup_callback_t callback);
+
+/**
+ * @brief Run one debounce scan over all buttons
+ *
+ * Must be called every BUTTON_POLL_INTERVAL_MS after a wakeup until it
+ * returns false. Press callbacks run in the caller's context.
+ *
+ * @return true while a button is pressed or still debouncing, false when idle
+ *         (the wakeup interrupt is re-armed)
+ */
+bool button_handler_poll(void);
+
 /**
  * @brief Get button state
  *
@@ -36,6 +36,8 @@ static device_t devices[DEVICE_MAX] = {
 };
 static bool initialized = false;
 static SemaphoreHandle_t mutex = NULL;
+static StaticSemaphore_t mutex_buffer;
+static device_change_callback_t change_callback = NULL;
 
 /* Private functions prototypes ----------------------------------------------*/
 
@@ -70,7 +72,7 @@ esp_err_t device_control_init(void)
         return ESP_OK;
     }
 
-    mutex = xSemaphoreCreateMutex();
+    mutex = xSemaphoreCreateMutexStatic(&mutex_buffer);
     if (!mutex)
     {
         return ESP_FAIL;
@@ -147,6 +149,25 @@ esp_err_t device_control_toggle(device_type_t device)
     devices[device].state = new_state;
     xSemaphoreGive(mutex);
 
+    if (change_callback)
+    {
+        change_callback(device, new_state);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Set callback invoked when a device changes state
+ */
+esp_err_t device_control_set_change_callback(device_change_callback_t callback)
+{
+    if (!initialized)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    change_callback = callback;
     return ESP_OK;
 }
 
@@ -197,9 +218,16 @@ static esp_err_t device_control_set(device_type_t device, device_state_t state)
     }
 
     xSemaphoreTake(mutex, portMAX_DELAY);
+    bool changed = (devices[device].state != state);
     gpio_set_level(devices[device].pin, get_gpio_level(state));
     devices[device].state = state;
     xSemaphoreGive(mutex);
 
+    // Called outside the mutex so the callback may query device states
+    if (changed && change_callback)
+    {
+        change_callback(device, state);
+    }
+
     return ESP_OK;
 }
\ No newline at end of file
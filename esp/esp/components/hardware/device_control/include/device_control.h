@@ -24,6 +24,17 @@ typedef enum
     DEVICE_ON = 1   //!< Device is ON
 } device_state_t;
 
+/**
+ * @brief Device state change callback type
+ *
+ * Runs in the context of the task that changed the state, after the
+ * output was switched.
+ *
+ * @param device Device that changed
+ * @param state New state
+ */
+typedef void (*device_change_callback_t)(device_type_t device, device_state_t state);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -62,6 +73,15 @@ esp_err_t device_control_get_state(device_type_t device, device_state_t *state);
  */
 esp_err_t device_control_toggle(device_type_t device);
 
+/**
+ * @brief Set callback invoked when a device changes state
+ *
+ * @param[in] callback Change callback, NULL to remove
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not initialized
+ */
+esp_err_t device_control_set_change_callback(device_change_callback_t callback);
+
 /**
  * @brief Deinitialize device control system
  *
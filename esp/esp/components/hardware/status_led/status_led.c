@@ -35,6 +35,7 @@ static led_t leds[LED_MAX] = {
     {LED_MQTT_PIN, "MQTT", LED_OFF}};    //!< MQTT LED
 static bool initialized = false;
 static SemaphoreHandle_t led_mutex = NULL;
+static StaticSemaphore_t led_mutex_buffer;
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -60,7 +61,7 @@ esp_err_t status_led_init(void)
     }
 
     // Create mutex for thread safety
-    led_mutex = xSemaphoreCreateMutex();
+    led_mutex = xSemaphoreCreateMutexStatic(&led_mutex_buffer);
     if (!led_mutex)
     {
         ESP_LOGE(TAG, "Failed to create mutex");
@@ -57,6 +57,7 @@
 #define OPCODE_MT_LO 0x60      //!< Measurement time low byte
 
 #define I2C_FREQ_HZ I2C_MASTER_FREQ_HZ //!< I2C bus frequency in Hz
+#define BH1750_MAX_SCL_HZ 400000       //!< Fast-mode, datasheet limit
 
 /* Private variables --------------------------------------------------------- */
 
@@ -103,6 +104,17 @@ static esp_err_t bh1750_power_on(bh1750_t *dev);
  */
 static esp_err_t bh1750_read(bh1750_t *dev, uint16_t *level);
 
+/**
+ * @brief Speed probe check: read one measurement
+ *
+ * @param[in] arg Pointer to device descriptor (bh1750_t)
+ *
+ * @return ESP_OK if the device acknowledged the read
+ *
+ * @note BH1750 has no readable register or CRC, so only NACKs are caught
+ */
+static esp_err_t bh1750_verify(void *arg);
+
 /* External functions -------------------------------------------------------- */
 
 /**
@@ -125,6 +137,7 @@ esp_err_t bh1750_init_desc(bh1750_t *dev, uint8_t addr, i2c_port_t port, gpio_nu
     dev->i2c_dev.sda_io_num = sda_gpio;
     dev->i2c_dev.scl_io_num = scl_gpio;
     dev->i2c_dev.clk_speed = I2C_FREQ_HZ;
+    dev->i2c_dev.max_clk_speed = BH1750_MAX_SCL_HZ;
 
     esp_err_t res = i2c_dev_create_mutex(&dev->i2c_dev);
     if (res == ESP_OK)
@@ -157,6 +170,16 @@ esp_err_t bh1750_free_desc(bh1750_t *dev)
     return ret;
 }
 
+/**
+ * @brief Select the highest reliable SCL clock
+ */
+esp_err_t bh1750_probe_speed(bh1750_t *dev)
+{
+    CHECK_ARG(dev);
+
+    return i2c_dev_probe_speed(&dev->i2c_dev, bh1750_verify, dev);
+}
+
 /**
  * @brief Power on BH1750 device
  */
@@ -234,7 +257,7 @@ esp_err_t bh1750_read_light(bh1750_t *dev, uint16_t *lux)
     }
 
     // Wait for measurement to complete (typical 120ms for high resolution)
-    vTaskDelay(pdMS_TO_TICKS(180));
+    vTaskDelay(pdMS_TO_TICKS(BH1750_CONVERSION_MS));
 
     // Read the result
     ret = bh1750_read(dev, lux);
@@ -284,7 +307,7 @@ esp_err_t bh1750_read_light_basic(bh1750_t *dev, uint16_t *lux)
     }
 
     // Wait for measurement to complete (typical 120ms for high resolution)
-    vTaskDelay(pdMS_TO_TICKS(180));
+    vTaskDelay(pdMS_TO_TICKS(BH1750_CONVERSION_MS));
 
     // inline bh1750_read
     uint8_t buf[2];
@@ -300,6 +323,43 @@ esp_err_t bh1750_read_light_basic(bh1750_t *dev, uint16_t *lux)
     return ESP_OK;
 }
 
+/**
+ * @brief Start a one-shot high resolution measurement
+ */
+esp_err_t bh1750_start_measurement(bh1750_t *dev)
+{
+    CHECK_ARG(dev);
+
+    CHECK(send_command(dev, OPCODE_POWER_ON));
+    CHECK(send_command(dev, OPCODE_OT | OPCODE_HIGH));
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Read the raw result of the last measurement
+ */
+esp_err_t bh1750_get_raw_data(bh1750_t *dev, uint16_t *raw)
+{
+    CHECK_ARG(dev && raw);
+
+    uint8_t buf[2];
+
+    CHECK(i2c_dev_read(&dev->i2c_dev, buf, 2));
+
+    *raw = (uint16_t)((buf[0] << 8) | buf[1]);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Convert a raw result to lux
+ */
+uint16_t bh1750_compute_lux(uint16_t raw)
+{
+    return (uint16_t)((raw * 10) / 12);
+}
+
 /* Private fuctions --------------------------------------------------------- */
 
 /**
@@ -353,4 +413,15 @@ static esp_err_t bh1750_read(bh1750_t *dev, uint16_t *level)
     ESP_LOGI(TAG, "Light level: %d lx (raw: %d)", *level, raw_value);
 
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Speed probe check: read one measurement
+ */
+static esp_err_t bh1750_verify(void *arg)
+{
+    bh1750_t *dev = (bh1750_t *)arg;
+    uint8_t buf[2];
+
+    return i2c_dev_read(&dev->i2c_dev, buf, sizeof(buf));
+}
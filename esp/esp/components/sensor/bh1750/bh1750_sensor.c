@@ -0,0 +1,154 @@
+/**
+ * @file bh1750_sensor.c
+ *
+ * @brief BH1750 Sensor Driver Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bh1750_sensor.h"
+#include "bh1750.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "BH1750_SENSOR";
+
+static bh1750_t bh1750_dev;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Add the sensor to the bus and verify it with a mode setup
+ *
+ * @param[in] port I2C port
+ * @param[in] sda SDA pin
+ * @param[in] scl SCL pin
+ *
+ * @return ESP_OK if the sensor answered
+ */
+static esp_err_t bh1750_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl);
+
+/**
+ * @brief Free the device descriptor
+ */
+static void bh1750_sensor_deinit(void);
+
+/**
+ * @brief Start a one-shot measurement
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t bh1750_sensor_start(void);
+
+/**
+ * @brief Read the raw measurement
+ *
+ * @param[out] raw Raw count in host byte order
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t bh1750_sensor_fetch(uint8_t *raw);
+
+/**
+ * @brief Convert the measurement to lux
+ *
+ * @param[in] raw Result of bh1750_sensor_fetch()
+ * @param[in,out] data Readings
+ *
+ * @return ESP_OK
+ */
+static esp_err_t bh1750_sensor_decode(const uint8_t *raw, sensor_data_t *data);
+
+/* Exported variables --------------------------------------------------------*/
+
+const sensor_driver_t bh1750_sensor_driver = {
+    .name = "bh1750",
+    .channels = SENSOR_CHANNEL_LIGHT,
+    .conversion_ms = BH1750_CONVERSION_MS,
+    .init = bh1750_sensor_init,
+    .deinit = bh1750_sensor_deinit,
+    .start = bh1750_sensor_start,
+    .fetch = bh1750_sensor_fetch,
+    .decode = bh1750_sensor_decode,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Add the sensor to the bus and verify it with a mode setup
+ */
+static esp_err_t bh1750_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl)
+{
+    esp_err_t ret = bh1750_init_desc(&bh1750_dev, BH1750_ADDR_LO, port, sda, scl);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    ret = i2c_dev_init(&bh1750_dev.i2c_dev);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Device add failed: %s", esp_err_to_name(ret));
+        bh1750_free_desc(&bh1750_dev);
+        return ret;
+    }
+
+    ret = bh1750_setup(&bh1750_dev, BH1750_MODE_CONTINUOUS, BH1750_RES_HIGH);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Hardware verification failed: %s", esp_err_to_name(ret));
+        bh1750_free_desc(&bh1750_dev);
+        return ret;
+    }
+
+    bh1750_probe_speed(&bh1750_dev);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Free the device descriptor
+ */
+static void bh1750_sensor_deinit(void)
+{
+    bh1750_free_desc(&bh1750_dev);
+}
+
+/**
+ * @brief Start a one-shot measurement
+ */
+static esp_err_t bh1750_sensor_start(void)
+{
+    return bh1750_start_measurement(&bh1750_dev);
+}
+
+/**
+ * @brief Read the raw measurement
+ */
+static esp_err_t bh1750_sensor_fetch(uint8_t *raw)
+{
+    uint16_t value;
+
+    esp_err_t ret = bh1750_get_raw_data(&bh1750_dev, &value);
+    if (ret == ESP_OK)
+    {
+        memcpy(raw, &value, sizeof(value));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Convert the measurement to lux
+ */
+static esp_err_t bh1750_sensor_decode(const uint8_t *raw, sensor_data_t *data)
+{
+    uint16_t value;
+
+    memcpy(&value, raw, sizeof(value));
+    data->light = bh1750_compute_lux(value);
+
+    return ESP_OK;
+}
@@ -18,6 +18,8 @@
 #define BH1750_ADDR_LO 0x23 //!< I2C address when ADDR pin floating/low
 #define BH1750_ADDR_HI 0x5c //!< I2C address when ADDR pin high
 
+#define BH1750_CONVERSION_MS 180 //!< One-shot high resolution, datasheet max with margin
+
 /* Exported types ------------------------------------------------------------*/
 
 /**
@@ -73,6 +75,17 @@ esp_err_t bh1750_init_desc(bh1750_t *dev, uint8_t addr, i2c_port_t port, gpio_nu
  */
 esp_err_t bh1750_free_desc(bh1750_t *dev);
 
+/**
+ * @brief Select the highest reliable SCL clock
+ *
+ * Probes up to 400 kHz. Call after bh1750_setup() so reads return data.
+ *
+ * @param[in] dev Pointer to device descriptor, added to the bus
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t bh1750_probe_speed(bh1750_t *dev);
+
 /**
  * @brief Setup device measurement parameters
  *
@@ -106,4 +119,35 @@ esp_err_t bh1750_read_light(bh1750_t *dev, uint16_t *lux);
  */
 esp_err_t bh1750_read_light_basic(bh1750_t *dev, uint16_t *lux);
 
+/**
+ * @brief Start a one-shot high resolution measurement
+ *
+ * Powers the device on and starts the conversion. Read the result with
+ * bh1750_get_raw_data() once BH1750_CONVERSION_MS has passed.
+ *
+ * @param[in] dev Pointer to device descriptor
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t bh1750_start_measurement(bh1750_t *dev);
+
+/**
+ * @brief Read the raw result of the last measurement
+ *
+ * @param[in] dev Pointer to device descriptor
+ * @param[out] raw Raw sensor count
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t bh1750_get_raw_data(bh1750_t *dev, uint16_t *raw);
+
+/**
+ * @brief Convert a raw result to lux
+ *
+ * @param[in] raw Raw sensor count
+ *
+ * @return Light level in lux
+ */
+uint16_t bh1750_compute_lux(uint16_t raw);
+
 #endif /* BH1750_H */
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ * @file bh1750_sensor.h
+ *
+ * @brief BH1750 Sensor Driver
+ */
+
+#ifndef BH1750_SENSOR_H
+#define BH1750_SENSOR_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sensor_driver.h"
+
+/* Exported variables --------------------------------------------------------*/
+
+/**
+ * @brief BH1750 light, one-shot at high resolution
+ */
+extern const sensor_driver_t bh1750_sensor_driver;
+
+#endif /* BH1750_SENSOR_H */
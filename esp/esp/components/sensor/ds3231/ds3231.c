@@ -70,6 +70,7 @@
 
 // I2C configuration
 #define I2C_FREQ_HZ I2C_MASTER_FREQ_HZ
+#define DS3231_MAX_SCL_HZ 400000 ///< Fast-mode, datasheet limit
 
 /* Private types ------------------------------------------------------------- */
 
@@ -142,6 +143,15 @@ static esp_err_t ds3231_get_flag(ds3231_t *dev, uint8_t addr, uint8_t mask, uint
  */
 static esp_err_t ds3231_set_flag(ds3231_t *dev, uint8_t addr, uint8_t bits, uint8_t mode);
 
+/**
+ * @brief Speed probe check: read the time registers and range-check them
+ *
+ * @param[in] arg Device descriptor (ds3231_t)
+ *
+ * @return ESP_OK if every field is valid BCD in range
+ */
+static esp_err_t ds3231_verify(void *arg);
+
 /* Exported functions ---------------------------------------------------------*/
 
 /**
@@ -158,6 +168,7 @@ esp_err_t ds3231_init_desc(ds3231_t *dev, i2c_port_t port, gpio_num_t sda_gpio,
     dev->i2c_dev.sda_io_num = sda_gpio;
     dev->i2c_dev.scl_io_num = scl_gpio;
     dev->i2c_dev.clk_speed = I2C_FREQ_HZ;
+    dev->i2c_dev.max_clk_speed = DS3231_MAX_SCL_HZ;
 
     esp_err_t res = i2c_dev_create_mutex(&dev->i2c_dev);
     if (res == ESP_OK)
@@ -183,6 +194,16 @@ esp_err_t ds3231_free_desc(ds3231_t *dev)
     return i2c_dev_delete_mutex(&dev->i2c_dev);
 }
 
+/**
+ * @brief Select the highest reliable SCL clock
+ */
+esp_err_t ds3231_probe_speed(ds3231_t *dev)
+{
+    CHECK_ARG(dev);
+
+    return i2c_dev_probe_speed(&dev->i2c_dev, ds3231_verify, dev);
+}
+
 /**
  * @brief Set the time on the RTC
  */
@@ -491,7 +512,7 @@ esp_err_t ds3231_set_timestamp(ds3231_t *dev, uint32_t timestamp)
 
     // Log the converted time
     ESP_LOGD(TAG, "Setting timestamp: %lu (%04d-%02d-%02d %02d:%02d:%02d)",
-             timestamp, timeinfo.tm_year + 1900, timeinfo.tm_mon + 1,
+             (unsigned long)timestamp, timeinfo.tm_year + 1900, timeinfo.tm_mon + 1,
              timeinfo.tm_mday, timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
 
     esp_err_t res = ds3231_set_time(dev, &timeinfo);
@@ -529,7 +550,7 @@ esp_err_t ds3231_get_timestamp(ds3231_t *dev, uint32_t *timestamp)
 
     *timestamp = (uint32_t)ts;
     ESP_LOGD(TAG, "Timestamp: %lu (%04d-%02d-%02d %02d:%02d:%02d)",
-             *timestamp, time.tm_year + 1900, time.tm_mon + 1, time.tm_mday,
+             (unsigned long)*timestamp, time.tm_year + 1900, time.tm_mon + 1, time.tm_mday,
              time.tm_hour, time.tm_min, time.tm_sec);
 
     return ESP_OK;
@@ -633,4 +654,39 @@ static esp_err_t ds3231_set_flag(ds3231_t *dev, uint8_t addr, uint8_t bits, uint
     }
 
     return res;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Speed probe check: read the time registers and range-check them
+ */
+static esp_err_t ds3231_verify(void *arg)
+{
+    ds3231_t *dev = (ds3231_t *)arg;
+    uint8_t data[7];
+
+    esp_err_t res = i2c_dev_read_reg(&dev->i2c_dev, DS3231_ADDR_TIME, data, sizeof(data));
+    if (res != ESP_OK)
+    {
+        return res;
+    }
+
+    // A bit error on the wire shows up as an invalid BCD digit or field
+    for (int i = 0; i < 7; i++)
+    {
+        if ((data[i] & 0x0f) > 9)
+        {
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+    }
+
+    uint8_t month = bcd2dec(data[5] & DS3231_MONTH_MASK);
+    if (bcd2dec(data[0]) > 59 || bcd2dec(data[1]) > 59 ||
+        data[3] < 1 || data[3] > 7 ||
+        data[4] < 1 || bcd2dec(data[4]) > 31 ||
+        month < 1 || month > 12)
+    {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file ds3231_sensor.c
+ *
+ * @brief DS3231 Sensor Driver Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "ds3231_sensor.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "DS3231_SENSOR";
+
+static ds3231_t ds3231_dev;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Add the RTC to the bus and verify it by reading the time
+ *
+ * @param[in] port I2C port
+ * @param[in] sda SDA pin
+ * @param[in] scl SCL pin
+ *
+ * @return ESP_OK if the RTC answered
+ */
+static esp_err_t ds3231_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl);
+
+/**
+ * @brief Free the device descriptor
+ */
+static void ds3231_sensor_deinit(void);
+
+/**
+ * @brief Read the current time as a Unix timestamp
+ *
+ * @param[out] raw Timestamp in host byte order
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t ds3231_sensor_fetch(uint8_t *raw);
+
+/**
+ * @brief Copy the timestamp into the readings
+ *
+ * @param[in] raw Result of ds3231_sensor_fetch()
+ * @param[in,out] data Readings
+ *
+ * @return ESP_OK
+ */
+static esp_err_t ds3231_sensor_decode(const uint8_t *raw, sensor_data_t *data);
+
+/* Exported variables --------------------------------------------------------*/
+
+const sensor_driver_t ds3231_sensor_driver = {
+    .name = "ds3231",
+    .channels = SENSOR_CHANNEL_TIMESTAMP,
+    .conversion_ms = 0,
+    .init = ds3231_sensor_init,
+    .deinit = ds3231_sensor_deinit,
+    .start = NULL,
+    .fetch = ds3231_sensor_fetch,
+    .decode = ds3231_sensor_decode,
+};
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Get the device descriptor used by the driver
+ */
+ds3231_t *ds3231_sensor_get_device(void)
+{
+    return &ds3231_dev;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Add the RTC to the bus and verify it by reading the time
+ */
+static esp_err_t ds3231_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl)
+{
+    esp_err_t ret = ds3231_init_desc(&ds3231_dev, port, sda, scl);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    ret = i2c_dev_init(&ds3231_dev.i2c_dev);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Device add failed: %s", esp_err_to_name(ret));
+        ds3231_free_desc(&ds3231_dev);
+        return ret;
+    }
+
+    struct tm time;
+    ret = ds3231_get_time(&ds3231_dev, &time);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Hardware verification failed: %s", esp_err_to_name(ret));
+        ds3231_free_desc(&ds3231_dev);
+        return ret;
+    }
+
+    ds3231_probe_speed(&ds3231_dev);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Free the device descriptor
+ */
+static void ds3231_sensor_deinit(void)
+{
+    ds3231_free_desc(&ds3231_dev);
+}
+
+/**
+ * @brief Read the current time as a Unix timestamp
+ */
+static esp_err_t ds3231_sensor_fetch(uint8_t *raw)
+{
+    uint32_t timestamp;
+
+    esp_err_t ret = ds3231_get_timestamp(&ds3231_dev, &timestamp);
+    if (ret == ESP_OK)
+    {
+        memcpy(raw, &timestamp, sizeof(timestamp));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Copy the timestamp into the readings
+ */
+static esp_err_t ds3231_sensor_decode(const uint8_t *raw, sensor_data_t *data)
+{
+    memcpy(&data->timestamp, raw, sizeof(data->timestamp));
+
+    return ESP_OK;
+}
@@ -98,6 +98,17 @@ esp_err_t ds3231_init_desc(ds3231_t *dev, i2c_port_t port, gpio_num_t sda_gpio,
  */
 esp_err_t ds3231_free_desc(ds3231_t *dev);
 
+/**
+ * @brief Select the highest reliable SCL clock
+ *
+ * Probes up to 400 kHz, checking the time registers for valid values.
+ *
+ * @param[in] dev I2C device descriptor, added to the bus
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t ds3231_probe_speed(ds3231_t *dev);
+
 /**
  * @brief Set the time on the RTC
  *
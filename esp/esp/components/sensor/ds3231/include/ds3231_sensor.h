@@ -0,0 +1,33 @@
+/**
+ * @file ds3231_sensor.h
+ *
+ * @brief DS3231 Sensor Driver
+ */
+
+#ifndef DS3231_SENSOR_H
+#define DS3231_SENSOR_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "ds3231.h"
+#include "sensor_driver.h"
+
+/* Exported variables --------------------------------------------------------*/
+
+/**
+ * @brief DS3231 timestamp source, no conversion time
+ */
+extern const sensor_driver_t ds3231_sensor_driver;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Get the device descriptor used by the driver
+ *
+ * For RTC access beyond sampling (setting the clock).
+ *
+ * @return Device descriptor, valid after a successful init()
+ */
+ds3231_t *ds3231_sensor_get_device(void);
+
+#endif /* DS3231_SENSOR_H */
@@ -9,15 +9,102 @@
 #include "i2cdev.h"
 #include "esp_log.h"
 #include "driver/i2c_master.h"
+#include "esp_timer.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <string.h>
 
 /* Private defines -----------------------------------------------------------*/
 
+// SCL clock overhead per transfer: address byte plus START/STOP, in bit times
+#define I2C_DEV_FRAME_BITS 11
+
+// Clock bits per payload byte (8 data + ACK)
+#define I2C_DEV_BYTE_BITS 9
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Bus report entry
+ */
+typedef struct
+{
+    i2c_dev_t *dev;            //!< Device added with i2c_dev_init()
+    uint32_t last_transactions; //!< Transactions at the previous report
+    uint32_t last_bytes;       //!< Bytes at the previous report
+    uint64_t last_busy_us;     //!< Busy time at the previous report
+} i2c_bus_entry_t;
+
+/* Private variables ---------------------------------------------------------*/
+
 static const char *TAG = "I2CDEV";
 static i2c_master_bus_handle_t i2c_bus_handle = NULL;
 
+// SCL clock steps, highest first
+static const uint32_t speed_steps[] = {1000000, 800000, 400000, 200000, 100000};
+
+static i2c_bus_entry_t bus_devices[I2C_DEV_MAX_DEVICES];
+static int bus_device_count = 0;
+static int64_t report_last_us = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Re-add a device to the bus with a new clock
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] clk_speed SCL clock in Hz
+ *
+ * @return ESP_OK on success, otherwise error code
+ *
+ * @note Caller holds the device mutex
+ */
+static esp_err_t i2c_dev_apply_speed_locked(i2c_dev_t *dev, uint32_t clk_speed);
+
+/**
+ * @brief Drop the clock to the next lower step
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] reason Error that triggered the step
+ *
+ * @note Caller holds the device mutex
+ */
+static void i2c_dev_step_down_locked(i2c_dev_t *dev, esp_err_t reason);
+
+/**
+ * @brief Count a transfer and feed its result into error tracking
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] bytes Bytes moved
+ * @param[in] start_us Transfer start time
+ * @param[in] ret Transfer result
+ *
+ * @note Caller holds the device mutex
+ */
+static void i2c_dev_account_locked(i2c_dev_t *dev, size_t bytes, int64_t start_us, esp_err_t ret);
+
+#ifdef CONFIG_I2CDEV_SPEED_PROBE
+/**
+ * @brief Highest clock step a device may use
+ *
+ * @param[in] dev Device descriptor
+ *
+ * @return Clock in Hz
+ */
+static uint32_t i2c_dev_speed_limit(const i2c_dev_t *dev);
+#endif
+
+/**
+ * @brief Time a traffic volume takes at a given clock
+ *
+ * @param[in] transactions Number of transfers
+ * @param[in] bytes Payload bytes
+ * @param[in] clk_speed SCL clock in Hz
+ *
+ * @return Time in microseconds
+ */
+static uint64_t i2c_dev_wire_time_us(uint32_t transactions, uint32_t bytes, uint32_t clk_speed);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -93,6 +180,16 @@ esp_err_t i2c_dev_init(i2c_dev_t *dev)
         return ret;
     }
 
+    memset(&dev->stats, 0, sizeof(dev->stats));
+    dev->error_streak = 0;
+    dev->probing = false;
+
+    if (bus_device_count < I2C_DEV_MAX_DEVICES)
+    {
+        bus_devices[bus_device_count].dev = dev;
+        bus_device_count++;
+    }
+
     ESP_LOGI(TAG, "Device 0x%02x added successfully (speed: %lu Hz)", dev->addr, dev->clk_speed);
     return ESP_OK;
 }
@@ -110,7 +207,7 @@ esp_err_t i2c_dev_create_mutex(i2c_dev_t *dev)
 
     if (!dev->mutex)
     {
-        dev->mutex = xSemaphoreCreateMutex();
+        dev->mutex = xSemaphoreCreateMutexStatic(&dev->mutex_buffer);
         if (!dev->mutex)
         {
             ESP_LOGE(TAG, "Failed to create mutex");
@@ -166,7 +263,9 @@ esp_err_t i2c_dev_read_reg(i2c_dev_t *dev, uint8_t reg, void *data, size_t len)
     i2c_master_dev_handle_t dev_handle = (i2c_master_dev_handle_t)dev->dev_handle;
 
     // Write register address then read data
+    int64_t start_us = esp_timer_get_time();
     esp_err_t ret = i2c_master_transmit_receive(dev_handle, &reg, 1, (uint8_t *)data, len, I2C_TIMEOUT_MS);
+    i2c_dev_account_locked(dev, 1 + len, start_us, ret);
 
     if (ret != ESP_OK)
     {
@@ -206,20 +305,16 @@ esp_err_t i2c_dev_write_reg(i2c_dev_t *dev, uint8_t reg, const void *data, size_
     // Use existing device handle
     i2c_master_dev_handle_t dev_handle = (i2c_master_dev_handle_t)dev->dev_handle;
 
-    // Prepare buffer: register address + data
-    uint8_t *write_buf = malloc(len + 1);
-    if (!write_buf)
-    {
-        I2C_DEV_GIVE_MUTEX(dev);
-        return ESP_ERR_NO_MEM;
-    }
-
-    write_buf[0] = reg;
-    memcpy(write_buf + 1, data, len);
-
-    esp_err_t ret = i2c_master_transmit(dev_handle, write_buf, len + 1, I2C_TIMEOUT_MS);
+    // Register address and data go out as one transaction without copying
+    // them into a temporary heap buffer
+    i2c_master_transmit_multi_buffer_info_t write_bufs[2] = {
+        {.write_buffer = &reg, .buffer_size = 1},
+        {.write_buffer = (uint8_t *)data, .buffer_size = len},
+    };
 
-    free(write_buf);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = i2c_master_multi_buffer_transmit(dev_handle, write_bufs, 2, I2C_TIMEOUT_MS);
+    i2c_dev_account_locked(dev, 1 + len, start_us, ret);
 
     if (ret != ESP_OK)
     {
@@ -259,7 +354,9 @@ esp_err_t i2c_dev_read(i2c_dev_t *dev, void *data, size_t len)
     // Use existing device handle
     i2c_master_dev_handle_t dev_handle = (i2c_master_dev_handle_t)dev->dev_handle;
 
+    int64_t start_us = esp_timer_get_time();
     esp_err_t ret = i2c_master_receive(dev_handle, (uint8_t *)data, len, I2C_TIMEOUT_MS);
+    i2c_dev_account_locked(dev, len, start_us, ret);
 
     if (ret != ESP_OK)
     {
@@ -292,7 +389,9 @@ esp_err_t i2c_dev_write(i2c_dev_t *dev, const void *data, size_t len)
     // Use existing device handle
     i2c_master_dev_handle_t dev_handle = (i2c_master_dev_handle_t)dev->dev_handle;
 
+    int64_t start_us = esp_timer_get_time();
     esp_err_t ret = i2c_master_transmit(dev_handle, (const uint8_t *)data, len, I2C_TIMEOUT_MS);
+    i2c_dev_account_locked(dev, len, start_us, ret);
 
     if (ret != ESP_OK)
     {
@@ -302,3 +401,310 @@ esp_err_t i2c_dev_write(i2c_dev_t *dev, const void *data, size_t len)
     I2C_DEV_GIVE_MUTEX(dev);
     return ret;
 }
+
+/**
+ * @brief Change the SCL clock of a device
+ */
+esp_err_t i2c_dev_set_speed(i2c_dev_t *dev, uint32_t clk_speed)
+{
+    if (!dev || clk_speed == 0)
+    {
+        ESP_LOGE(TAG, "Invalid arguments");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (dev->dev_handle == NULL)
+    {
+        ESP_LOGE(TAG, "Device 0x%02x not initialized", dev->addr);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    I2C_DEV_TAKE_MUTEX(dev);
+    esp_err_t ret = i2c_dev_apply_speed_locked(dev, clk_speed);
+    I2C_DEV_GIVE_MUTEX(dev);
+
+    return ret;
+}
+
+/**
+ * @brief Find the highest reliable SCL clock of a device
+ */
+esp_err_t i2c_dev_probe_speed(i2c_dev_t *dev, i2c_dev_verify_cb_t verify, void *arg)
+{
+    if (!dev || !verify)
+    {
+        ESP_LOGE(TAG, "Invalid arguments");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#ifndef CONFIG_I2CDEV_SPEED_PROBE
+    (void)arg;
+    return ESP_OK;
+#else
+    if (dev->dev_handle == NULL)
+    {
+        ESP_LOGE(TAG, "Device 0x%02x not initialized", dev->addr);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t original = dev->clk_speed;
+    uint32_t limit = i2c_dev_speed_limit(dev);
+    esp_err_t result = ESP_ERR_NOT_FOUND;
+
+    dev->probing = true;
+
+    for (size_t step = 0; step < sizeof(speed_steps) / sizeof(speed_steps[0]); step++)
+    {
+        if (speed_steps[step] > limit)
+        {
+            continue;
+        }
+
+        if (i2c_dev_set_speed(dev, speed_steps[step]) != ESP_OK)
+        {
+            continue;
+        }
+
+        int round = 0;
+        for (; round < I2C_DEV_PROBE_ROUNDS; round++)
+        {
+            if (verify(arg) != ESP_OK)
+            {
+                break;
+            }
+        }
+
+        if (round == I2C_DEV_PROBE_ROUNDS)
+        {
+            result = ESP_OK;
+            break;
+        }
+
+        ESP_LOGD(TAG, "Device 0x%02x failed at %lu Hz (round %d)", dev->addr, speed_steps[step], round);
+    }
+
+    if (result != ESP_OK)
+    {
+        i2c_dev_set_speed(dev, original);
+        ESP_LOGW(TAG, "Device 0x%02x: no clock step passed, staying at %lu Hz", dev->addr, original);
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Device 0x%02x: %lu Hz -> %lu Hz (limit %lu Hz)",
+                 dev->addr, original, dev->clk_speed, limit);
+    }
+
+    // Probe traffic and failures are not part of the runtime picture
+    I2C_DEV_TAKE_MUTEX(dev);
+    memset(&dev->stats, 0, sizeof(dev->stats));
+    dev->error_streak = 0;
+    dev->probing = false;
+    I2C_DEV_GIVE_MUTEX(dev);
+
+    for (int i = 0; i < bus_device_count; i++)
+    {
+        if (bus_devices[i].dev == dev)
+        {
+            bus_devices[i].last_transactions = 0;
+            bus_devices[i].last_bytes = 0;
+            bus_devices[i].last_busy_us = 0;
+        }
+    }
+
+    return result;
+#endif
+}
+
+/**
+ * @brief Report an error detected above the bus layer
+ */
+void i2c_dev_report_error(i2c_dev_t *dev, esp_err_t err)
+{
+    if (!dev || err == ESP_OK)
+    {
+        return;
+    }
+
+    I2C_DEV_TAKE_MUTEX(dev);
+
+    dev->stats.errors++;
+
+    if (err == ESP_ERR_INVALID_CRC)
+    {
+        // Corrupted data with good ACKs points at the clock, not the device
+        dev->stats.crc_errors++;
+        i2c_dev_step_down_locked(dev, err);
+    }
+    else if (++dev->error_streak >= I2C_DEV_ERROR_STEP_DOWN)
+    {
+        i2c_dev_step_down_locked(dev, err);
+    }
+
+    I2C_DEV_GIVE_MUTEX(dev);
+}
+
+/**
+ * @brief Log per-device clock and bus utilization since the last report
+ */
+void i2c_bus_report(void)
+{
+    int64_t now = esp_timer_get_time();
+    int64_t window_us = now - report_last_us;
+    report_last_us = now;
+
+    if (window_us <= 0 || bus_device_count == 0)
+    {
+        return;
+    }
+
+    uint64_t total_busy_us = 0;
+    uint64_t total_base_us = 0;
+
+    for (int i = 0; i < bus_device_count; i++)
+    {
+        i2c_bus_entry_t *entry = &bus_devices[i];
+        const i2c_dev_stats_t *stats = &entry->dev->stats;
+
+        uint32_t transactions = stats->transactions - entry->last_transactions;
+        uint32_t bytes = stats->bytes - entry->last_bytes;
+        uint64_t busy_us = stats->busy_us - entry->last_busy_us;
+        uint64_t base_us = i2c_dev_wire_time_us(transactions, bytes, I2C_MASTER_FREQ_HZ);
+
+        entry->last_transactions = stats->transactions;
+        entry->last_bytes = stats->bytes;
+        entry->last_busy_us = stats->busy_us;
+
+        total_busy_us += busy_us;
+        total_base_us += base_us;
+
+        ESP_LOGI(TAG, "0x%02x @ %lu Hz: %lu xfers, %lu bytes, busy %llu us (%llu us at %d Hz), errors=%lu crc=%lu steps=%lu",
+                 entry->dev->addr, entry->dev->clk_speed,
+                 (unsigned long)transactions, (unsigned long)bytes,
+                 (unsigned long long)busy_us, (unsigned long long)base_us, I2C_MASTER_FREQ_HZ,
+                 (unsigned long)stats->errors, (unsigned long)stats->crc_errors,
+                 (unsigned long)stats->step_downs);
+    }
+
+    ESP_LOGI(TAG, "Bus utilization %.2f%% (%.2f%% at %d Hz)",
+             100.0 * (double)total_busy_us / (double)window_us,
+             100.0 * (double)total_base_us / (double)window_us,
+             I2C_MASTER_FREQ_HZ);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Re-add a device to the bus with a new clock
+ */
+static esp_err_t i2c_dev_apply_speed_locked(i2c_dev_t *dev, uint32_t clk_speed)
+{
+    if (dev->clk_speed == clk_speed)
+    {
+        return ESP_OK;
+    }
+
+    // The master driver fixes scl_speed_hz when the device is added
+    esp_err_t ret = i2c_master_bus_rm_device((i2c_master_dev_handle_t)dev->dev_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to remove device 0x%02x: %s", dev->addr, esp_err_to_name(ret));
+        return ret;
+    }
+    dev->dev_handle = NULL;
+
+    i2c_device_config_t dev_cfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = dev->addr,
+        .scl_speed_hz = clk_speed,
+    };
+
+    ret = i2c_master_bus_add_device(i2c_bus_handle, &dev_cfg, (i2c_master_dev_handle_t *)&dev->dev_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to re-add device 0x%02x at %lu Hz: %s", dev->addr, clk_speed, esp_err_to_name(ret));
+
+        // Keep the device usable at its previous clock
+        dev_cfg.scl_speed_hz = dev->clk_speed;
+        if (i2c_master_bus_add_device(i2c_bus_handle, &dev_cfg, (i2c_master_dev_handle_t *)&dev->dev_handle) != ESP_OK)
+        {
+            dev->dev_handle = NULL;
+        }
+        return ret;
+    }
+
+    dev->clk_speed = clk_speed;
+    return ESP_OK;
+}
+
+/**
+ * @brief Drop the clock to the next lower step
+ */
+static void i2c_dev_step_down_locked(i2c_dev_t *dev, esp_err_t reason)
+{
+    dev->error_streak = 0;
+
+    if (dev->probing)
+    {
+        return;
+    }
+
+    for (size_t step = 0; step < sizeof(speed_steps) / sizeof(speed_steps[0]); step++)
+    {
+        if (speed_steps[step] < dev->clk_speed)
+        {
+            uint32_t previous = dev->clk_speed;
+            if (i2c_dev_apply_speed_locked(dev, speed_steps[step]) == ESP_OK)
+            {
+                dev->stats.step_downs++;
+                ESP_LOGW(TAG, "Device 0x%02x: %s, clock %lu Hz -> %lu Hz",
+                         dev->addr, esp_err_to_name(reason), previous, dev->clk_speed);
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Count a transfer and feed its result into error tracking
+ */
+static void i2c_dev_account_locked(i2c_dev_t *dev, size_t bytes, int64_t start_us, esp_err_t ret)
+{
+    dev->stats.transactions++;
+    dev->stats.bytes += bytes;
+    dev->stats.busy_us += esp_timer_get_time() - start_us;
+
+    if (ret == ESP_OK)
+    {
+        dev->error_streak = 0;
+        return;
+    }
+
+    dev->stats.errors++;
+
+    if (++dev->error_streak >= I2C_DEV_ERROR_STEP_DOWN)
+    {
+        i2c_dev_step_down_locked(dev, ret);
+    }
+}
+
+#ifdef CONFIG_I2CDEV_SPEED_PROBE
+/**
+ * @brief Highest clock step a device may use
+ */
+static uint32_t i2c_dev_speed_limit(const i2c_dev_t *dev)
+{
+    uint32_t limit = dev->max_clk_speed ? dev->max_clk_speed : dev->clk_speed;
+
+    return limit < I2C_DEV_SPEED_CEILING_HZ ? limit : I2C_DEV_SPEED_CEILING_HZ;
+}
+#endif
+
+/**
+ * @brief Time a traffic volume takes at a given clock
+ */
+static uint64_t i2c_dev_wire_time_us(uint32_t transactions, uint32_t bytes, uint32_t clk_speed)
+{
+    uint64_t bits = (uint64_t)transactions * I2C_DEV_FRAME_BITS + (uint64_t)bytes * I2C_DEV_BYTE_BITS;
+
+    return bits * 1000000ULL / clk_speed;
+}
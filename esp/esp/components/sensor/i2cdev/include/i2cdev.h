@@ -52,8 +52,25 @@
         }                            \
     } while (0)
 
+/* Exported defines ----------------------------------------------------------*/
+
+#define I2C_DEV_MAX_DEVICES 8 //!< Devices tracked for the bus report
+
 /* Exported types ------------------------------------------------------------*/
 
+/**
+ * @brief Per-device bus statistics
+ */
+typedef struct
+{
+    uint32_t transactions; //!< Completed or failed transfers
+    uint32_t bytes;        //!< Payload bytes, register address included
+    uint64_t busy_us;      //!< Time spent in transfers
+    uint32_t errors;       //!< NACKs, timeouts and reported errors
+    uint32_t crc_errors;   //!< CRC errors reported by the driver
+    uint32_t step_downs;   //!< Clock reductions after errors
+} i2c_dev_stats_t;
+
 /**
  * @brief I2C device descriptor
  */
@@ -63,11 +80,29 @@ typedef struct
     uint8_t addr;            //!< I2C device address
     gpio_num_t sda_io_num;   //!< GPIO number for SDA
     gpio_num_t scl_io_num;   //!< GPIO number for SCL
-    uint32_t clk_speed;      //!< I2C clock speed in Hz
+    uint32_t clk_speed;      //!< Current SCL clock in Hz
+    uint32_t max_clk_speed;  //!< Datasheet SCL ceiling in Hz (0 = clk_speed)
     SemaphoreHandle_t mutex; //!< Mutex for thread-safe access
+    StaticSemaphore_t mutex_buffer; //!< Static storage for mutex
     void *dev_handle;        //!< I2C device handle (i2c_master_dev_handle_t)
+    i2c_dev_stats_t stats;   //!< Bus statistics
+    uint8_t error_streak;    //!< Consecutive failed transfers
+    bool probing;            //!< Speed probe running, no step-down
 } i2c_dev_t;
 
+/**
+ * @brief Driver check used by the speed probe
+ *
+ * Must exercise the device with real transfers and fail on any sign of
+ * corruption (CRC, out-of-range values, readback mismatch), not only on
+ * NACK.
+ *
+ * @param arg Driver descriptor given to i2c_dev_probe_speed()
+ *
+ * @return ESP_OK if the device answered correctly
+ */
+typedef esp_err_t (*i2c_dev_verify_cb_t)(void *arg);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -155,4 +190,52 @@ esp_err_t i2c_dev_read(i2c_dev_t *dev, void *data, size_t len);
  */
 esp_err_t i2c_dev_write(i2c_dev_t *dev, const void *data, size_t len);
 
+/**
+ * @brief Change the SCL clock of a device
+ *
+ * Re-adds the device to the bus with the new per-device speed.
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] clk_speed SCL clock in Hz
+ *
+ * @return ESP_OK on success, otherwise error code
+ */
+esp_err_t i2c_dev_set_speed(i2c_dev_t *dev, uint32_t clk_speed);
+
+/**
+ * @brief Find the highest reliable SCL clock of a device
+ *
+ * Walks the clock steps from min(max_clk_speed, I2C_DEV_SPEED_CEILING_HZ)
+ * down and keeps the first one at which verify passes
+ * I2C_DEV_PROBE_ROUNDS times in a row. Statistics are cleared afterwards.
+ *
+ * @param[in] dev Device descriptor, already added to the bus
+ * @param[in] verify Driver check
+ * @param[in] arg Argument for verify
+ *
+ * @return
+ *      - ESP_OK when a step passed, or probing is disabled
+ *      - ESP_ERR_NOT_FOUND if no step passed (original clock restored)
+ */
+esp_err_t i2c_dev_probe_speed(i2c_dev_t *dev, i2c_dev_verify_cb_t verify, void *arg);
+
+/**
+ * @brief Report an error detected above the bus layer
+ *
+ * Drivers call this for data that arrived with a good ACK but failed
+ * validation. ESP_ERR_INVALID_CRC steps the clock down immediately.
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] err Error detected by the driver
+ */
+void i2c_dev_report_error(i2c_dev_t *dev, esp_err_t err);
+
+/**
+ * @brief Log per-device clock and bus utilization since the last report
+ *
+ * Next to the measured busy time, prints what the same traffic would take
+ * at I2C_MASTER_FREQ_HZ.
+ */
+void i2c_bus_report(void);
+
 #endif /* I2CDEV_H */
@@ -25,6 +25,19 @@
 /* I2C Master Frequency */
 #define I2C_MASTER_FREQ_HZ  CONFIG_I2C_MASTER_FREQ_HZ
 
+/* Per-device clock selection */
+#ifdef CONFIG_I2CDEV_SPEED_PROBE
+#define I2C_DEV_PROBE_ROUNDS     CONFIG_I2CDEV_PROBE_ROUNDS
+#endif
+#define I2C_DEV_ERROR_STEP_DOWN  CONFIG_I2CDEV_ERROR_STEP_DOWN
+
+/* Highest clock step any device may use */
+#ifdef CONFIG_I2CDEV_FAST_MODE_PLUS
+#define I2C_DEV_SPEED_CEILING_HZ 1000000
+#else
+#define I2C_DEV_SPEED_CEILING_HZ 400000
+#endif
+
 /* I2C Debugging */
 #define I2CDEV_DEBUG        CONFIG_I2CDEV_DEBUG
 
@@ -0,0 +1,103 @@
+/**
+ * @file sensor_driver.h
+ *
+ * @brief Sensor Driver Interface
+ *
+ * Every I2C sensor is described by one constant sensor_driver_t. The
+ * sensor manager keeps the registry of drivers, initializes them in order
+ * and runs the sampler: it starts the conversion of every ready driver,
+ * then fetches and decodes each one once its declared conversion time has
+ * passed, so slow conversions overlap instead of adding up.
+ */
+
+#ifndef SENSOR_DRIVER_H
+#define SENSOR_DRIVER_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "i2cdev_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define SENSOR_DRIVER_RAW_MAX 8 //!< Raw result buffer size passed to fetch()
+
+/**
+ * @brief Channels a driver fills in sensor_data_t
+ */
+#define SENSOR_CHANNEL_TIMESTAMP   (1U << 0) //!< timestamp
+#define SENSOR_CHANNEL_TEMPERATURE (1U << 1) //!< temperature
+#define SENSOR_CHANNEL_HUMIDITY    (1U << 2) //!< humidity
+#define SENSOR_CHANNEL_LIGHT       (1U << 3) //!< light
+#define SENSOR_CHANNEL_ALL         0x0FU     //!< Every channel of sensor_data_t
+#define SENSOR_CHANNEL_READINGS    (SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY | SENSOR_CHANNEL_LIGHT) //!< Measured values
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Structure containing all sensor readings
+ */
+typedef struct
+{
+    float temperature;  //!< Temperature in degrees Celsius from SHT3x
+    float humidity;     //!< Relative humidity in percent from SHT3x
+    uint16_t light;     //!< Light intensity in lux from BH1750
+    uint32_t timestamp; //!< Unix timestamp from DS3231 RTC
+    uint32_t channels;  //!< SENSOR_CHANNEL_* bits holding a decoded value, others are 0
+    bool valid;         //!< True if all sensors read successfully
+} sensor_data_t;
+
+/**
+ * @brief Sensor driver
+ *
+ * Drivers own their device descriptor. Only the sensor manager calls into
+ * a driver, from one task at a time.
+ */
+typedef struct
+{
+    const char *name;       //!< Short name for logs and statistics
+    uint32_t channels;      //!< SENSOR_CHANNEL_* bits filled by decode()
+    uint32_t conversion_ms; //!< Time from start() until fetch() has a result
+
+    /**
+     * @brief Add the device to the bus, verify it and select its SCL clock
+     *
+     * @return ESP_OK if the device is present and working
+     */
+    esp_err_t (*init)(i2c_port_t port, gpio_num_t sda, gpio_num_t scl);
+
+    /**
+     * @brief Free the device descriptor
+     */
+    void (*deinit)(void);
+
+    /**
+     * @brief Start a conversion, NULL if results are always available
+     *
+     * @return ESP_OK on success, error code otherwise
+     */
+    esp_err_t (*start)(void);
+
+    /**
+     * @brief Read the raw result of the last conversion
+     *
+     * @param[out] raw SENSOR_DRIVER_RAW_MAX bytes, layout private to the driver
+     *
+     * @return ESP_OK on success, error code otherwise
+     */
+    esp_err_t (*fetch)(uint8_t *raw);
+
+    /**
+     * @brief Convert a raw result into the driver's channels
+     *
+     * @param[in] raw Result of fetch()
+     * @param[in,out] data Readings, only the driver's channels are written
+     *
+     * @return ESP_OK on success, error code otherwise
+     */
+    esp_err_t (*decode)(const uint8_t *raw, sensor_data_t *data);
+} sensor_driver_t;
+
+#endif /* SENSOR_DRIVER_H */
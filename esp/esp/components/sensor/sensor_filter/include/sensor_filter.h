@@ -0,0 +1,110 @@
+/**
+ * @file sensor_filter.h
+ *
+ * @brief Sensor Filter Pipeline API
+ *
+ * Per-channel filtering between the sensor reader and the shared data:
+ * a median-of-N for spike rejection followed by a first-order IIR for
+ * smoothing. Both run in integer arithmetic on fixed-size windows.
+ */
+
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "sensor_manager.h"
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define SENSOR_FILTER_MEDIAN_MAX 9       //!< Largest median window
+#define SENSOR_FILTER_ALPHA_ONE  32768U  //!< IIR alpha of 1.0 (Q15), no smoothing
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Filtered channels
+ */
+typedef enum
+{
+    SENSOR_FILTER_TEMPERATURE = 0, //!< Temperature, filtered in 0.01 °C
+    SENSOR_FILTER_HUMIDITY,        //!< Humidity, filtered in 0.01 %
+    SENSOR_FILTER_LIGHT,           //!< Light, filtered in lux
+    SENSOR_FILTER_CHANNEL_MAX
+} sensor_filter_channel_t;
+
+/**
+ * @brief Channel filter configuration
+ */
+typedef struct
+{
+    uint8_t median_n;   //!< Median window, odd, 1 disables the median
+    uint16_t iir_alpha; //!< Weight of a new sample in Q15, SENSOR_FILTER_ALPHA_ONE disables the IIR
+} sensor_filter_config_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize all channels with the Kconfig defaults
+ */
+void sensor_filter_init(void);
+
+/**
+ * @brief Configure one channel
+ *
+ * Clears the channel history, the next sample passes through unfiltered.
+ *
+ * @param[in] channel Channel to configure
+ * @param[in] config New configuration
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if the channel is unknown, median_n is even or
+ *        above SENSOR_FILTER_MEDIAN_MAX, or iir_alpha is 0 or above 1.0
+ */
+esp_err_t sensor_filter_configure(sensor_filter_channel_t channel, const sensor_filter_config_t *config);
+
+/**
+ * @brief Get the configuration of one channel
+ *
+ * @param[in] channel Channel
+ * @param[out] config Current configuration
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the channel is unknown
+ */
+esp_err_t sensor_filter_get_config(sensor_filter_channel_t channel, sensor_filter_config_t *config);
+
+/**
+ * @brief Look up a channel by name
+ *
+ * @param[in] name "temperature", "humidity" or "light"
+ *
+ * @return Channel, SENSOR_FILTER_CHANNEL_MAX if unknown
+ */
+sensor_filter_channel_t sensor_filter_channel_from_name(const char *name);
+
+/**
+ * @brief Filter one fixed-point sample
+ *
+ * O(log N) comparisons for the median, O(1) for the IIR.
+ *
+ * @param[in] channel Channel
+ * @param[in] raw Sample in the channel unit
+ *
+ * @return Filtered sample in the channel unit
+ */
+int32_t sensor_filter_apply(sensor_filter_channel_t channel, int32_t raw);
+
+/**
+ * @brief Filter a reading in place
+ *
+ * Only channels set in data->channels are filtered; the others were not
+ * decoded and are left untouched.
+ *
+ * @param[in,out] data Reading from sensor_reader_read_all()
+ */
+void sensor_filter_process(sensor_data_t *data);
+
+#endif /* SENSOR_FILTER_H */
@@ -0,0 +1,289 @@
+/**
+ * @file sensor_filter.c
+ *
+ * @brief Sensor Filter Pipeline Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sensor_filter.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include <math.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define IIR_STATE_SHIFT 8  //!< Extra fraction bits kept in the IIR state
+#define ALPHA_SHIFT     15 //!< Q15 alpha
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Channel filter state
+ */
+typedef struct
+{
+    sensor_filter_config_t config;             //!< Active configuration
+    int32_t ring[SENSOR_FILTER_MEDIAN_MAX];    //!< Window in arrival order
+    int32_t sorted[SENSOR_FILTER_MEDIAN_MAX];  //!< Window in value order
+    uint8_t head;                              //!< Oldest entry in ring once full
+    uint8_t fill;                              //!< Samples in the window
+    int64_t iir_state;                         //!< IIR output << IIR_STATE_SHIFT
+    bool iir_primed;                           //!< iir_state holds a value
+} filter_channel_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "SENSOR_FILTER";
+
+static const char *const channel_names[SENSOR_FILTER_CHANNEL_MAX] = {
+    "temperature",
+    "humidity",
+    "light",
+};
+
+static filter_channel_t channels[SENSOR_FILTER_CHANNEL_MAX];
+static portMUX_TYPE filter_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief First index whose value is not below value (binary search)
+ *
+ * @param[in] sorted Sorted values
+ * @param[in] count Number of values
+ * @param[in] value Value to place
+ *
+ * @return Index in 0..count
+ */
+static uint8_t filter_lower_bound(const int32_t *sorted, uint8_t count, int32_t value);
+
+/**
+ * @brief Push a sample into the median window
+ *
+ * @param[in,out] ch Channel state
+ * @param[in] value New sample
+ *
+ * @return Median of the window
+ */
+static int32_t filter_median(filter_channel_t *ch, int32_t value);
+
+/**
+ * @brief Run one IIR step
+ *
+ * @param[in,out] ch Channel state
+ * @param[in] value New sample
+ *
+ * @return Filtered value
+ */
+static int32_t filter_iir(filter_channel_t *ch, int32_t value);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize all channels with the Kconfig defaults
+ */
+void sensor_filter_init(void)
+{
+    // The median needs an odd window, an even Kconfig value is rounded up
+    sensor_filter_config_t config = {
+        .median_n = CONFIG_SENSOR_FILTER_MEDIAN_N | 1,
+        .iir_alpha = (uint16_t)((CONFIG_SENSOR_FILTER_IIR_ALPHA_PCT * SENSOR_FILTER_ALPHA_ONE) / 100),
+    };
+    const sensor_filter_config_t pass_through = {
+        .median_n = 1,
+        .iir_alpha = SENSOR_FILTER_ALPHA_ONE,
+    };
+
+    for (int i = 0; i < SENSOR_FILTER_CHANNEL_MAX; i++)
+    {
+        esp_err_t ret = sensor_filter_configure((sensor_filter_channel_t)i, &config);
+        if (ret != ESP_OK)
+        {
+            // A zeroed channel would hold its first sample forever
+            ESP_LOGE(TAG, "Invalid default filter for %s, passing samples through", channel_names[i]);
+            sensor_filter_configure((sensor_filter_channel_t)i, &pass_through);
+        }
+    }
+
+    ESP_LOGI(TAG, "Median of %d, IIR alpha %d%%", config.median_n, CONFIG_SENSOR_FILTER_IIR_ALPHA_PCT);
+}
+
+/**
+ * @brief Configure one channel
+ */
+esp_err_t sensor_filter_configure(sensor_filter_channel_t channel, const sensor_filter_config_t *config)
+{
+    if (channel >= SENSOR_FILTER_CHANNEL_MAX || config == NULL ||
+        config->median_n == 0 || (config->median_n & 1) == 0 || config->median_n > SENSOR_FILTER_MEDIAN_MAX ||
+        config->iir_alpha == 0 || config->iir_alpha > SENSOR_FILTER_ALPHA_ONE)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&filter_lock);
+    memset(&channels[channel], 0, sizeof(channels[channel]));
+    channels[channel].config = *config;
+    portEXIT_CRITICAL(&filter_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the configuration of one channel
+ */
+esp_err_t sensor_filter_get_config(sensor_filter_channel_t channel, sensor_filter_config_t *config)
+{
+    if (channel >= SENSOR_FILTER_CHANNEL_MAX || config == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&filter_lock);
+    *config = channels[channel].config;
+    portEXIT_CRITICAL(&filter_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Look up a channel by name
+ */
+sensor_filter_channel_t sensor_filter_channel_from_name(const char *name)
+{
+    for (int i = 0; name != NULL && i < SENSOR_FILTER_CHANNEL_MAX; i++)
+    {
+        if (strcmp(name, channel_names[i]) == 0)
+        {
+            return (sensor_filter_channel_t)i;
+        }
+    }
+
+    return SENSOR_FILTER_CHANNEL_MAX;
+}
+
+/**
+ * @brief Filter one fixed-point sample
+ */
+int32_t sensor_filter_apply(sensor_filter_channel_t channel, int32_t raw)
+{
+    if (channel >= SENSOR_FILTER_CHANNEL_MAX)
+    {
+        return raw;
+    }
+
+    portENTER_CRITICAL(&filter_lock);
+    filter_channel_t *ch = &channels[channel];
+    int32_t value = filter_iir(ch, filter_median(ch, raw));
+    portEXIT_CRITICAL(&filter_lock);
+
+    return value;
+}
+
+/**
+ * @brief Filter a complete reading in place
+ */
+void sensor_filter_process(sensor_data_t *data)
+{
+    if (data == NULL)
+    {
+        return;
+    }
+
+    // A failed read leaves its channel at 0, which must not enter the history
+
+    // Temperature and humidity in hundredths, matching the published precision
+    if (data->channels & SENSOR_CHANNEL_TEMPERATURE)
+    {
+        data->temperature = sensor_filter_apply(SENSOR_FILTER_TEMPERATURE, (int32_t)lroundf(data->temperature * 100.0f)) / 100.0f;
+    }
+    if (data->channels & SENSOR_CHANNEL_HUMIDITY)
+    {
+        data->humidity = sensor_filter_apply(SENSOR_FILTER_HUMIDITY, (int32_t)lroundf(data->humidity * 100.0f)) / 100.0f;
+    }
+    if (data->channels & SENSOR_CHANNEL_LIGHT)
+    {
+        data->light = (uint16_t)sensor_filter_apply(SENSOR_FILTER_LIGHT, data->light);
+    }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief First index whose value is not below value (binary search)
+ */
+static uint8_t filter_lower_bound(const int32_t *sorted, uint8_t count, int32_t value)
+{
+    uint8_t lo = 0;
+    uint8_t hi = count;
+
+    while (lo < hi)
+    {
+        uint8_t mid = (uint8_t)((lo + hi) / 2);
+        if (sorted[mid] < value)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief Push a sample into the median window
+ */
+static int32_t filter_median(filter_channel_t *ch, int32_t value)
+{
+    uint8_t n = ch->config.median_n;
+
+    if (n <= 1)
+    {
+        return value;
+    }
+
+    if (ch->fill == n)
+    {
+        // Drop the oldest sample from the sorted view
+        uint8_t idx = filter_lower_bound(ch->sorted, ch->fill, ch->ring[ch->head]);
+        memmove(&ch->sorted[idx], &ch->sorted[idx + 1], (size_t)(ch->fill - idx - 1) * sizeof(int32_t));
+        ch->fill--;
+    }
+
+    ch->ring[ch->head] = value;
+    ch->head = (uint8_t)((ch->head + 1) % n);
+
+    uint8_t idx = filter_lower_bound(ch->sorted, ch->fill, value);
+    memmove(&ch->sorted[idx + 1], &ch->sorted[idx], (size_t)(ch->fill - idx) * sizeof(int32_t));
+    ch->sorted[idx] = value;
+    ch->fill++;
+
+    // Until the window is full, median of what has arrived
+    return ch->sorted[ch->fill / 2];
+}
+
+/**
+ * @brief Run one IIR step
+ */
+static int32_t filter_iir(filter_channel_t *ch, int32_t value)
+{
+    int64_t x = (int64_t)value << IIR_STATE_SHIFT;
+
+    if (!ch->iir_primed)
+    {
+        ch->iir_state = x;
+        ch->iir_primed = true;
+    }
+    else
+    {
+        // y += alpha * (x - y), fraction bits kept so small steps are not lost
+        ch->iir_state += ((x - ch->iir_state) * ch->config.iir_alpha) >> ALPHA_SHIFT;
+    }
+
+    // Round to nearest
+    return (int32_t)((ch->iir_state + (1 << (IIR_STATE_SHIFT - 1))) >> IIR_STATE_SHIFT);
+}
@@ -0,0 +1,596 @@
+/**
+ * @file history_archive.c
+ *
+ * @brief Flash Sample Archive Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "history_archive.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define HISTORY_ARCHIVE_RECORD_MIN 64     //!< Smaller remainders close the page
+#define HISTORY_ARCHIVE_BLANK_LEN  0xFFFF //!< Record length of erased flash
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Page header, written together with the first record
+ */
+typedef struct
+{
+    uint32_t magic;    //!< HISTORY_ARCHIVE_MAGIC
+    uint32_t seq;      //!< Page sequence number, one more than the page before
+    uint32_t first_ts; //!< Timestamp of the first sample in the page
+    uint32_t crc;      //!< CRC-32 of the fields above
+} history_archive_page_header_t;
+
+/**
+ * @brief Record header, followed by one history_codec block
+ */
+typedef struct
+{
+    uint16_t len;      //!< Block bytes
+    uint16_t reserved; //!< Left erased
+    uint32_t crc;      //!< CRC-32 of the block
+} history_archive_record_header_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "HISTORY_ARCHIVE";
+
+static const esp_partition_t *partition = NULL;
+static uint32_t page_count = 0;
+
+static uint32_t first_ts[HISTORY_ARCHIVE_MAX_PAGES]; //!< Sparse time index by page
+static uint32_t tail = 0;                           //!< Oldest page
+static uint32_t used = 0;                           //!< Pages in use from tail on
+static uint32_t head_seq = 0;                       //!< Sequence number of the newest page
+static size_t write_offset = HISTORY_ARCHIVE_PAGE_SIZE; //!< Next record in the newest page, page size when closed
+static uint32_t last_ts = 0;                        //!< Newest archived sample
+
+// Page read by a query or record being written; calls are serialized
+static uint8_t page_buf[HISTORY_ARCHIVE_PAGE_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Physical page of a position counted from the oldest page
+ *
+ * @param[in] logical Position, 0 for the oldest page
+ *
+ * @return Page index in the partition
+ */
+static uint32_t history_archive_page(uint32_t logical);
+
+/**
+ * @brief First page that can hold a timestamp
+ *
+ * Binary search over the page index for the first page starting after the
+ * timestamp; the timestamp falls into the page before it.
+ *
+ * @param[in] timestamp Timestamp to look up
+ *
+ * @return Position counted from the oldest page
+ */
+static uint32_t history_archive_find(uint32_t timestamp);
+
+/**
+ * @brief CRC of a page header
+ *
+ * @param[in] header Page header
+ *
+ * @return CRC-32 of the fields before crc
+ */
+static uint32_t history_archive_header_crc(const history_archive_page_header_t *header);
+
+/**
+ * @brief Read and validate a page header
+ *
+ * @param[in] page Page index
+ * @param[out] header Destination
+ *
+ * @return true if the page holds a valid header
+ */
+static bool history_archive_read_header(uint32_t page, history_archive_page_header_t *header);
+
+/**
+ * @brief Parse the record at an offset of a page image
+ *
+ * @param[in] page Page image
+ * @param[in,out] offset Record offset, advanced past the record
+ * @param[out] block Encoded block
+ * @param[out] len Block length
+ *
+ * @return
+ *      - ESP_OK on a valid record
+ *      - ESP_ERR_NOT_FOUND on erased flash or the end of the page
+ *      - ESP_ERR_INVALID_CRC on a torn or corrupted record
+ */
+static esp_err_t history_archive_next_record(const uint8_t *page, size_t *offset, const uint8_t **block, size_t *len);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Find the partition and rebuild the index from the page headers
+ */
+esp_err_t history_archive_init(const char *label)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (part == NULL)
+    {
+        ESP_LOGW(TAG, "No '%s' partition, history stays in RAM", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    page_count = part->size / HISTORY_ARCHIVE_PAGE_SIZE;
+    if (page_count > HISTORY_ARCHIVE_MAX_PAGES)
+    {
+        page_count = HISTORY_ARCHIVE_MAX_PAGES;
+    }
+
+    if (page_count < 2)
+    {
+        ESP_LOGE(TAG, "Partition '%s' too small", label);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    partition = part;
+    tail = 0;
+    used = 0;
+    head_seq = 0;
+    write_offset = HISTORY_ARCHIVE_PAGE_SIZE;
+    last_ts = 0;
+
+    // Newest page: the highest sequence number
+    history_archive_page_header_t header;
+    uint32_t head = 0;
+
+    for (uint32_t page = 0; page < page_count; page++)
+    {
+        if (history_archive_read_header(page, &header) && (used == 0 || header.seq > head_seq))
+        {
+            head = page;
+            head_seq = header.seq;
+            first_ts[page] = header.first_ts;
+            used = 1;
+        }
+    }
+
+    if (used == 0)
+    {
+        ESP_LOGI(TAG, "Archive empty, %lu pages", (unsigned long)page_count);
+        return ESP_OK;
+    }
+
+    // Older pages precede it with consecutive sequence numbers; anything else
+    // is blank, torn or from an earlier pass and gets erased when reached
+    tail = head;
+    while (used < page_count)
+    {
+        uint32_t prev = (tail + page_count - 1) % page_count;
+        if (!history_archive_read_header(prev, &header) || header.seq != head_seq - used)
+        {
+            break;
+        }
+
+        first_ts[prev] = header.first_ts;
+        tail = prev;
+        used++;
+    }
+
+    // Find the end of the newest page and its last sample
+    esp_err_t ret = esp_partition_read(partition, head * HISTORY_ARCHIVE_PAGE_SIZE, page_buf, HISTORY_ARCHIVE_PAGE_SIZE);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to read page %lu: %s", (unsigned long)head, esp_err_to_name(ret));
+        partition = NULL;
+        return ret;
+    }
+
+    size_t offset = sizeof(history_archive_page_header_t);
+    const uint8_t *block = NULL;
+    const uint8_t *last_block = NULL;
+    size_t len = 0;
+    size_t last_len = 0;
+
+    while ((ret = history_archive_next_record(page_buf, &offset, &block, &len)) == ESP_OK)
+    {
+        last_block = block;
+        last_len = len;
+    }
+
+    // A torn record leaves programmed bytes behind it, so the page is closed
+    write_offset = (ret == ESP_ERR_NOT_FOUND) ? offset : HISTORY_ARCHIVE_PAGE_SIZE;
+    if (ret == ESP_ERR_INVALID_CRC)
+    {
+        ESP_LOGW(TAG, "Torn record in page %lu at %u", (unsigned long)head, (unsigned)offset);
+    }
+
+    // Samples of a torn first record were newer than anything archived
+    last_ts = first_ts[head] - 1;
+
+    history_codec_reader_t reader;
+    if (last_block != NULL && history_codec_reader_init(&reader, last_block, last_len) == ESP_OK)
+    {
+        history_sample_t sample;
+        while (history_codec_reader_next(&reader, &sample))
+        {
+            last_ts = sample.timestamp;
+        }
+    }
+
+    ESP_LOGI(TAG, "Archive: %lu/%lu pages, %lu..%lu", (unsigned long)used, (unsigned long)page_count,
+             (unsigned long)first_ts[tail], (unsigned long)last_ts);
+    return ESP_OK;
+}
+
+/**
+ * @brief Whether the archive was initialized
+ */
+bool history_archive_ready(void)
+{
+    return partition != NULL;
+}
+
+/**
+ * @brief Append samples as one or more records
+ */
+esp_err_t history_archive_append(const history_sample_t *samples, size_t count)
+{
+    if (partition == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    size_t done = 0;
+
+    while (done < count)
+    {
+        bool fresh = HISTORY_ARCHIVE_PAGE_SIZE - write_offset <
+                     sizeof(history_archive_record_header_t) + HISTORY_ARCHIVE_RECORD_MIN;
+        uint32_t page;
+        size_t offset;
+        size_t header_len;
+
+        if (fresh)
+        {
+            // Reuse the oldest page once all are taken; it leaves the index
+            // before the erase, so a failed erase cannot leave it half valid
+            if (used == page_count)
+            {
+                tail = (tail + 1) % page_count;
+                used--;
+            }
+
+            page = history_archive_page(used);
+
+            esp_err_t ret = esp_partition_erase_range(partition, page * HISTORY_ARCHIVE_PAGE_SIZE,
+                                                      HISTORY_ARCHIVE_PAGE_SIZE);
+            if (ret != ESP_OK)
+            {
+                ESP_LOGE(TAG, "Failed to erase page %lu: %s", (unsigned long)page, esp_err_to_name(ret));
+                return ret;
+            }
+
+            offset = 0;
+            header_len = sizeof(history_archive_page_header_t);
+        }
+        else
+        {
+            page = history_archive_page(used - 1);
+            offset = write_offset;
+            header_len = 0;
+        }
+
+        // Page header (new page only), record header and block in one write
+        uint8_t *record = &page_buf[header_len];
+        uint8_t *block = record + sizeof(history_archive_record_header_t);
+        size_t cap = HISTORY_ARCHIVE_PAGE_SIZE - offset - header_len - sizeof(history_archive_record_header_t);
+        size_t len = 0;
+        size_t encoded = 0;
+
+        esp_err_t ret = history_codec_encode(&samples[done], count - done, 0, block, cap, &len, &encoded);
+        if (ret != ESP_OK)
+        {
+            return ret;
+        }
+
+        // No sample fit: the loop would never advance
+        if (encoded == 0)
+        {
+            ESP_LOGE(TAG, "No sample fits in %u bytes of page %lu", (unsigned)cap, (unsigned long)page);
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        history_archive_record_header_t record_header = {
+            .len = (uint16_t)len,
+            .reserved = 0xFFFF,
+            .crc = esp_rom_crc32_le(0, block, len),
+        };
+        memcpy(record, &record_header, sizeof(record_header));
+
+        if (fresh)
+        {
+            history_archive_page_header_t page_header = {
+                .magic = HISTORY_ARCHIVE_MAGIC,
+                .seq = head_seq + 1,
+                .first_ts = samples[done].timestamp,
+            };
+            page_header.crc = history_archive_header_crc(&page_header);
+            memcpy(page_buf, &page_header, sizeof(page_header));
+        }
+
+        size_t total = header_len + sizeof(history_archive_record_header_t) + len;
+        ret = esp_partition_write(partition, page * HISTORY_ARCHIVE_PAGE_SIZE + offset, page_buf, total);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Failed to write page %lu: %s", (unsigned long)page, esp_err_to_name(ret));
+            if (!fresh)
+            {
+                write_offset = HISTORY_ARCHIVE_PAGE_SIZE;
+            }
+            return ret;
+        }
+
+        if (fresh)
+        {
+            first_ts[page] = samples[done].timestamp;
+            head_seq++;
+            used++;
+        }
+
+        write_offset = offset + total;
+        done += encoded;
+        last_ts = samples[done - 1].timestamp;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Copy archived samples of a time range, oldest first
+ */
+size_t history_archive_read(uint32_t from, uint32_t to, history_sample_t *out, size_t max, bool *more)
+{
+    size_t copied = 0;
+
+    *more = false;
+
+    if (partition == NULL || used == 0 || from > to)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = history_archive_find(from); i < used; i++)
+    {
+        uint32_t page = history_archive_page(i);
+        if (first_ts[page] > to)
+        {
+            break;
+        }
+
+        esp_err_t ret = esp_partition_read(partition, page * HISTORY_ARCHIVE_PAGE_SIZE, page_buf, HISTORY_ARCHIVE_PAGE_SIZE);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Failed to read page %lu: %s", (unsigned long)page, esp_err_to_name(ret));
+            break;
+        }
+
+        history_archive_page_header_t header;
+        memcpy(&header, page_buf, sizeof(header));
+        if (header.magic != HISTORY_ARCHIVE_MAGIC || header.seq != head_seq - (used - 1 - i))
+        {
+            ESP_LOGW(TAG, "Page %lu does not match the index", (unsigned long)page);
+            continue;
+        }
+
+        size_t offset = sizeof(header);
+        const uint8_t *block;
+        size_t len;
+
+        while (history_archive_next_record(page_buf, &offset, &block, &len) == ESP_OK)
+        {
+            history_codec_reader_t reader;
+            if (history_codec_reader_init(&reader, block, len) != ESP_OK)
+            {
+                continue;
+            }
+
+            history_sample_t sample;
+            while (history_codec_reader_next(&reader, &sample))
+            {
+                if (sample.timestamp < from)
+                {
+                    continue;
+                }
+
+                if (sample.timestamp > to)
+                {
+                    return copied;
+                }
+
+                if (copied == max)
+                {
+                    *more = true;
+                    return copied;
+                }
+
+                out[copied++] = sample;
+            }
+        }
+    }
+
+    return copied;
+}
+
+/**
+ * @brief Drop every page that can hold samples at or after a timestamp
+ */
+esp_err_t history_archive_truncate(uint32_t timestamp)
+{
+    if (partition == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (used == 0 || last_ts < timestamp)
+    {
+        return ESP_OK;
+    }
+
+    // The page the timestamp falls into may also hold older samples; they
+    // go too, so every kept sample is older than the first dropped page
+    uint32_t keep = history_archive_find(timestamp);
+    uint32_t dropped_ts = first_ts[history_archive_page(keep)];
+
+    // Newest first, so an interrupted truncation still leaves a consecutive chain
+    while (used > keep)
+    {
+        uint32_t page = history_archive_page(used - 1);
+        esp_err_t ret = esp_partition_erase_range(partition, page * HISTORY_ARCHIVE_PAGE_SIZE,
+                                                  HISTORY_ARCHIVE_PAGE_SIZE);
+        if (ret != ESP_OK)
+        {
+            // last_ts stays ahead, so appends keep failing until a retry succeeds
+            ESP_LOGE(TAG, "Failed to erase page %lu: %s", (unsigned long)page, esp_err_to_name(ret));
+            write_offset = HISTORY_ARCHIVE_PAGE_SIZE;
+            return ret;
+        }
+
+        used--;
+        head_seq--;
+    }
+
+    // The next append opens a fresh page with the next sequence number
+    write_offset = HISTORY_ARCHIVE_PAGE_SIZE;
+    last_ts = (used > 0) ? dropped_ts - 1 : 0;
+
+    ESP_LOGW(TAG, "Archive truncated before %lu, %lu pages kept", (unsigned long)dropped_ts, (unsigned long)used);
+    return ESP_OK;
+}
+
+/**
+ * @brief Timestamp of the newest archived sample
+ */
+uint32_t history_archive_last_timestamp(void)
+{
+    return (partition != NULL && used > 0) ? last_ts : 0;
+}
+
+/**
+ * @brief Get the archive figures
+ */
+void history_archive_get_stats(history_archive_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    if (partition == NULL)
+    {
+        return;
+    }
+
+    stats->pages = page_count;
+    stats->used = used;
+    stats->page_writes = head_seq;
+
+    if (used > 0)
+    {
+        stats->bytes = (used - 1) * HISTORY_ARCHIVE_PAGE_SIZE + (uint32_t)write_offset;
+        stats->first_timestamp = first_ts[tail];
+        stats->last_timestamp = last_ts;
+    }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Physical page of a position counted from the oldest page
+ */
+static uint32_t history_archive_page(uint32_t logical)
+{
+    return (tail + logical) % page_count;
+}
+
+/**
+ * @brief First page that can hold a timestamp
+ */
+static uint32_t history_archive_find(uint32_t timestamp)
+{
+    uint32_t lo = 0;
+    uint32_t hi = used;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (first_ts[history_archive_page(mid)] <= timestamp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return (lo > 0) ? lo - 1 : 0;
+}
+
+/**
+ * @brief CRC of a page header
+ */
+static uint32_t history_archive_header_crc(const history_archive_page_header_t *header)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *)header, offsetof(history_archive_page_header_t, crc));
+}
+
+/**
+ * @brief Read and validate a page header
+ */
+static bool history_archive_read_header(uint32_t page, history_archive_page_header_t *header)
+{
+    if (esp_partition_read(partition, page * HISTORY_ARCHIVE_PAGE_SIZE, header, sizeof(*header)) != ESP_OK)
+    {
+        return false;
+    }
+
+    return header->magic == HISTORY_ARCHIVE_MAGIC && header->crc == history_archive_header_crc(header);
+}
+
+/**
+ * @brief Parse the record at an offset of a page image
+ */
+static esp_err_t history_archive_next_record(const uint8_t *page, size_t *offset, const uint8_t **block, size_t *len)
+{
+    history_archive_record_header_t header;
+
+    if (*offset + sizeof(header) > HISTORY_ARCHIVE_PAGE_SIZE)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    memcpy(&header, &page[*offset], sizeof(header));
+
+    if (header.len == HISTORY_ARCHIVE_BLANK_LEN && header.crc == 0xFFFFFFFF)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const uint8_t *data = &page[*offset + sizeof(header)];
+    if (header.len > HISTORY_ARCHIVE_PAGE_SIZE - *offset - sizeof(header) ||
+        esp_rom_crc32_le(0, data, header.len) != header.crc)
+    {
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    *block = data;
+    *len = header.len;
+    *offset += sizeof(header) + header.len;
+    return ESP_OK;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file history_archive.h
+ *
+ * @brief Flash Sample Archive API
+ *
+ * Circular log of history_codec blocks in a dedicated data partition. Each
+ * 4 KB sector is a page: a header with the page sequence number and the
+ * first timestamp, then records appended in batches until the page is
+ * full. Pages are used in order and each is erased only when the log wraps
+ * onto it, so every sector wears at the same rate.
+ *
+ * The first timestamp of every page is kept in RAM as a sparse index; a
+ * range query binary searches it and decodes from the first page that can
+ * hold the start of the range.
+ *
+ * Not thread safe, sensor_history serializes all calls.
+ */
+
+#ifndef HISTORY_ARCHIVE_H
+#define HISTORY_ARCHIVE_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "history_codec.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define HISTORY_ARCHIVE_PAGE_SIZE 4096       //!< Flash sector
+#define HISTORY_ARCHIVE_MAX_PAGES 256        //!< Index capacity, 1 MB partition
+#define HISTORY_ARCHIVE_MAGIC     0x31524148 //!< "HAR1"
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Archive figures
+ */
+typedef struct
+{
+    uint32_t pages;            //!< Pages in the partition
+    uint32_t used;             //!< Pages holding records
+    uint32_t page_writes;      //!< Pages opened since the partition was blank
+    uint32_t bytes;            //!< Bytes of pages and records in use
+    uint32_t first_timestamp;  //!< Oldest archived sample, 0 when empty
+    uint32_t last_timestamp;   //!< Newest archived sample, 0 when empty
+} history_archive_stats_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Find the partition and rebuild the index from the page headers
+ *
+ * A torn record at the end of the newest page closes that page; the next
+ * append starts a new one.
+ *
+ * @param[in] label Data partition label
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_FOUND if there is no such partition
+ *      - ESP_ERR_INVALID_SIZE if it holds fewer than two pages
+ *      - Flash read errors
+ */
+esp_err_t history_archive_init(const char *label);
+
+/**
+ * @brief Whether the archive was initialized
+ *
+ * @return true if reads and appends can be served
+ */
+bool history_archive_ready(void);
+
+/**
+ * @brief Append samples as one or more records
+ *
+ * Samples go into the newest page while they fit, the rest into the next
+ * page, which is erased first. Timestamps must be increasing and newer
+ * than history_archive_last_timestamp().
+ *
+ * @param[in] samples Samples, oldest first
+ * @param[in] count Number of samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *      - ESP_ERR_INVALID_SIZE if the encoder cannot fit a single sample
+ *      - Flash erase or write errors
+ */
+esp_err_t history_archive_append(const history_sample_t *samples, size_t count);
+
+/**
+ * @brief Copy archived samples of a time range, oldest first
+ *
+ * @param[in] from First timestamp to copy
+ * @param[in] to Last timestamp to copy
+ * @param[out] out Destination
+ * @param[in] max Destination capacity
+ * @param[out] more Set when a further sample in the range follows
+ *
+ * @return Number of samples copied
+ */
+size_t history_archive_read(uint32_t from, uint32_t to, history_sample_t *out, size_t max, bool *more);
+
+/**
+ * @brief Drop every page that can hold samples at or after a timestamp
+ *
+ * Used after the clock was corrected backwards, so samples stamped in the
+ * future do not block new appends. Pages are erased newest first; the
+ * page the timestamp falls into is dropped whole, older pages are kept.
+ *
+ * @param[in] timestamp First timestamp to drop
+ *
+ * @return
+ *      - ESP_OK on success, also when nothing is newer
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *      - Flash erase errors
+ */
+esp_err_t history_archive_truncate(uint32_t timestamp);
+
+/**
+ * @brief Timestamp of the newest archived sample
+ *
+ * @return Timestamp, 0 when the archive is empty or not initialized
+ */
+uint32_t history_archive_last_timestamp(void);
+
+/**
+ * @brief Get the archive figures
+ *
+ * @param[out] stats Destination
+ */
+void history_archive_get_stats(history_archive_stats_t *stats);
+
+#endif /* HISTORY_ARCHIVE_H */
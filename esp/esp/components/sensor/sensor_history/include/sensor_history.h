@@ -0,0 +1,105 @@
+/**
+ * @file sensor_history.h
+ *
+ * @brief Sensor History API
+ *
+ * Recorded samples in fixed point, appended at the publish interval and
+ * read back in time ranges for the get_history export and /api/history.
+ * New samples collect in a RAM ring and are written to the flash archive
+ * (history_archive.h) in batches; reads merge both. Timestamps increase
+ * strictly, so a reader's cursor is simply the next timestamp to read.
+ */
+
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "history_codec.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define SENSOR_HISTORY_SAMPLES CONFIG_SENSOR_HISTORY_SAMPLES //!< Ring capacity
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+#define SENSOR_HISTORY_FLUSH_SAMPLES CONFIG_SENSOR_HISTORY_FLUSH_SAMPLES //!< Samples per archive write
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize the history ring and the flash archive
+ *
+ * A missing or unreadable archive partition is logged and leaves the
+ * ring as the only history.
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sensor_history_init(void);
+
+/**
+ * @brief Append a sample, overwriting the oldest when full
+ *
+ * Every SENSOR_HISTORY_FLUSH_SAMPLES appends the history_flush task is
+ * woken to write the batch to the archive; the caller only copies the
+ * sample and never waits for a flash erase or write.
+ *
+ * A sample CONFIG_SENSOR_HISTORY_CLOCK_STEP or more older than the newest
+ * one is a clock correction: the newer samples are dropped, from the
+ * archive by the flush task, and the sample is recorded.
+ *
+ * @param[in] sample Sample to record
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if it is not newer than the last sample and no
+ *        clock correction
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ */
+esp_err_t sensor_history_append(const history_sample_t *sample);
+
+/**
+ * @brief Write the samples not archived yet
+ *
+ * Called before a planned restart so the pending batch is kept.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_SUPPORTED without CONFIG_SENSOR_HISTORY_ARCHIVE
+ *      - ESP_ERR_INVALID_STATE if not initialized or the archive is unavailable
+ *      - Flash errors
+ */
+esp_err_t sensor_history_flush(void);
+
+/**
+ * @brief Copy samples of a time range, oldest first
+ *
+ * Archived samples are found by binary search over the page index, so
+ * the cost does not grow with the archive size.
+ *
+ * @param[in,out] cursor Timestamp to continue from, 0 to start at from;
+ *                       advanced past the copied samples
+ * @param[in] from First timestamp to copy
+ * @param[in] to Last timestamp to copy
+ * @param[out] out Destination
+ * @param[in] max Destination capacity
+ * @param[out] more Set when a further sample in the range follows
+ *
+ * @return Number of samples copied
+ */
+size_t sensor_history_read(uint32_t *cursor, uint32_t from, uint32_t to,
+                           history_sample_t *out, size_t max, bool *more);
+
+/**
+ * @brief Number of samples held in RAM
+ *
+ * @return Sample count
+ */
+size_t sensor_history_count(void);
+
+#endif /* SENSOR_HISTORY_H */
@@ -0,0 +1,381 @@
+/**
+ * @file sensor_history.c
+ *
+ * @brief Sensor History Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sensor_history.h"
+#include "history_archive.h"
+#include "task_registry.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "SENSOR_HISTORY";
+
+static history_sample_t ring[SENSOR_HISTORY_SAMPLES];
+static uint32_t head = 0;     //!< Position of the next append
+static size_t count = 0;      //!< Samples held
+static uint32_t last_ts = 0;  //!< Newest sample, appends must be newer
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+static uint32_t flushed = 0;  //!< Position of the first sample not archived
+static bool truncate_pending = false; //!< Archive must drop samples from truncate_ts on
+static uint32_t truncate_ts = 0;
+
+// Archive side, serialized by archive_mutex; flash erases and writes happen
+// with it held but never with history_mutex held
+static history_sample_t batch[SENSOR_HISTORY_FLUSH_SAMPLES]; //!< Samples of one archive write
+static bool archive_failed = false;
+static SemaphoreHandle_t archive_mutex = NULL;
+static StaticSemaphore_t archive_mutex_buffer;
+
+static TaskHandle_t flush_task_handle = NULL;
+TASK_REGISTRY_STORAGE(flush_task, TASK_STACK_HISTORY_FLUSH);
+#endif
+
+// Ring, head, count, last_ts, flushed and the pending truncation; held only for copies
+static SemaphoreHandle_t history_mutex = NULL;
+static StaticSemaphore_t history_mutex_buffer;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Drop samples at or after a timestamp, called with history_mutex held
+ *
+ * @param[in] timestamp First timestamp to drop
+ */
+static void sensor_history_truncate_locked(uint32_t timestamp);
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+/**
+ * @brief Write the samples not archived yet, called with archive_mutex held
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sensor_history_flush_locked(void);
+
+/**
+ * @brief Background task writing full batches to the archive
+ *
+ * @param[in] arg Unused
+ */
+static void sensor_history_flush_task(void *arg);
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize the history ring and the flash archive
+ */
+esp_err_t sensor_history_init(void)
+{
+    if (history_mutex != NULL)
+    {
+        return ESP_OK;
+    }
+
+    history_mutex = xSemaphoreCreateMutexStatic(&history_mutex_buffer);
+    if (history_mutex == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    archive_mutex = xSemaphoreCreateMutexStatic(&archive_mutex_buffer);
+    if (archive_mutex == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create archive mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Without the archive the ring alone serves reads
+    if (history_archive_init(CONFIG_SENSOR_HISTORY_PARTITION) == ESP_OK)
+    {
+        last_ts = history_archive_last_timestamp();
+
+        // Appends run on the executor; sector erases must not
+        esp_err_t ret = task_registry_create_static(TASK_ID_HISTORY_FLUSH, sensor_history_flush_task, NULL,
+                                                    flush_task_stack, &flush_task_tcb, &flush_task_handle);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Failed to create flush task, history stays in RAM: %s", esp_err_to_name(ret));
+            archive_failed = true;
+        }
+    }
+#endif
+
+    ESP_LOGI(TAG, "History ring: %d samples", SENSOR_HISTORY_SAMPLES);
+    return ESP_OK;
+}
+
+/**
+ * @brief Append a sample, overwriting the oldest when full
+ */
+esp_err_t sensor_history_append(const history_sample_t *sample)
+{
+    if (history_mutex == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+
+    // Keeps the archive sorted for range queries. A large step back is a
+    // clock correction: the newer samples were stamped by a wrong clock and
+    // would otherwise block recording until the clock catches up.
+    if (sample->timestamp <= last_ts)
+    {
+        if (last_ts - sample->timestamp < CONFIG_SENSOR_HISTORY_CLOCK_STEP)
+        {
+            xSemaphoreGive(history_mutex);
+            ESP_LOGD(TAG, "Sample at %lu not newer than %lu", (unsigned long)sample->timestamp, (unsigned long)last_ts);
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        ESP_LOGW(TAG, "Clock stepped back from %lu to %lu, dropping newer samples",
+                 (unsigned long)last_ts, (unsigned long)sample->timestamp);
+        sensor_history_truncate_locked(sample->timestamp);
+    }
+
+    ring[head % SENSOR_HISTORY_SAMPLES] = *sample;
+    head++;
+    if (count < SENSOR_HISTORY_SAMPLES)
+    {
+        count++;
+    }
+    last_ts = sample->timestamp;
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    bool due = truncate_pending || (head - flushed >= SENSOR_HISTORY_FLUSH_SAMPLES);
+#endif
+
+    xSemaphoreGive(history_mutex);
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    // Only marks the batch as due, the flush task does the flash work
+    if (due && flush_task_handle != NULL)
+    {
+        xTaskNotifyGive(flush_task_handle);
+    }
+#endif
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Write the samples not archived yet
+ */
+esp_err_t sensor_history_flush(void)
+{
+    if (history_mutex == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    xSemaphoreTake(archive_mutex, portMAX_DELAY);
+    esp_err_t ret = sensor_history_flush_locked();
+    xSemaphoreGive(archive_mutex);
+    return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Copy samples of a time range, oldest first
+ */
+size_t sensor_history_read(uint32_t *cursor, uint32_t from, uint32_t to,
+                           history_sample_t *out, size_t max, bool *more)
+{
+    size_t copied = 0;
+    uint32_t start = (*cursor > from) ? *cursor : from;
+    uint32_t archived = 0;
+
+    *more = false;
+
+    if (history_mutex == NULL || start > to)
+    {
+        return 0;
+    }
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    // Archived samples first, the ring only adds the newer ones. A batch
+    // archived after this stays in the ring and is read from there.
+    xSemaphoreTake(archive_mutex, portMAX_DELAY);
+    if (history_archive_ready())
+    {
+        copied = history_archive_read(start, to, out, max, more);
+        archived = history_archive_last_timestamp();
+    }
+    xSemaphoreGive(archive_mutex);
+#endif
+
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+
+    for (uint32_t pos = head - (uint32_t)count; pos != head && !*more; pos++)
+    {
+        const history_sample_t *s = &ring[pos % SENSOR_HISTORY_SAMPLES];
+        if (s->timestamp < start || s->timestamp <= archived)
+        {
+            continue;
+        }
+
+        if (s->timestamp > to)
+        {
+            break;
+        }
+
+        // Stop on the first match that does not fit, the next read starts there
+        if (copied == max)
+        {
+            *more = true;
+            break;
+        }
+
+        out[copied++] = *s;
+    }
+
+    xSemaphoreGive(history_mutex);
+
+    if (copied > 0)
+    {
+        *cursor = out[copied - 1].timestamp + 1;
+    }
+
+    return copied;
+}
+
+/**
+ * @brief Number of samples held in RAM
+ */
+size_t sensor_history_count(void)
+{
+    return count;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Drop samples at or after a timestamp, called with history_mutex held
+ */
+static void sensor_history_truncate_locked(uint32_t timestamp)
+{
+    while (count > 0 && ring[(head - 1) % SENSOR_HISTORY_SAMPLES].timestamp >= timestamp)
+    {
+        head--;
+        count--;
+    }
+
+    last_ts = (count > 0) ? ring[(head - 1) % SENSOR_HISTORY_SAMPLES].timestamp : 0;
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+    // The flush task erases the archived part before its next write
+    if (!truncate_pending || timestamp < truncate_ts)
+    {
+        truncate_ts = timestamp;
+    }
+    truncate_pending = true;
+#endif
+}
+
+#if CONFIG_SENSOR_HISTORY_ARCHIVE
+/**
+ * @brief Write the samples not archived yet, called with archive_mutex held
+ */
+static esp_err_t sensor_history_flush_locked(void)
+{
+    if (!history_archive_ready() || archive_failed)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    while (true)
+    {
+        // Copy a batch out so appends only wait for the copy, not the flash
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+
+        if (truncate_pending)
+        {
+            uint32_t from = truncate_ts;
+            truncate_pending = false;
+            xSemaphoreGive(history_mutex);
+
+            esp_err_t ret = history_archive_truncate(from);
+            if (ret != ESP_OK)
+            {
+                ESP_LOGE(TAG, "Archive truncation failed, history stays in RAM: %s", esp_err_to_name(ret));
+                archive_failed = true;
+                return ret;
+            }
+
+            // Ring samples the dropped pages held are written again
+            uint32_t archived = history_archive_last_timestamp();
+
+            xSemaphoreTake(history_mutex, portMAX_DELAY);
+            flushed = head - (uint32_t)count;
+            while (flushed != head && ring[flushed % SENSOR_HISTORY_SAMPLES].timestamp <= archived)
+            {
+                flushed++;
+            }
+        }
+
+        // Samples overwritten before a flush are gone
+        uint32_t oldest = head - (uint32_t)count;
+        if (head - flushed > head - oldest)
+        {
+            flushed = oldest;
+        }
+
+        size_t n = 0;
+        while (n < SENSOR_HISTORY_FLUSH_SAMPLES && flushed + n != head)
+        {
+            batch[n] = ring[(flushed + n) % SENSOR_HISTORY_SAMPLES];
+            n++;
+        }
+
+        xSemaphoreGive(history_mutex);
+
+        if (n == 0)
+        {
+            return ESP_OK;
+        }
+
+        esp_err_t ret = history_archive_append(batch, n);
+        if (ret != ESP_OK)
+        {
+            // The ring keeps serving reads; retrying would wear a failing sector
+            ESP_LOGE(TAG, "Archive write failed, history stays in RAM: %s", esp_err_to_name(ret));
+            archive_failed = true;
+            return ret;
+        }
+
+        // Samples overwritten meanwhile are skipped on the next pass
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        flushed += n;
+        xSemaphoreGive(history_mutex);
+    }
+}
+
+/**
+ * @brief Background task writing full batches to the archive
+ */
+static void sensor_history_flush_task(void *arg)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTake(archive_mutex, portMAX_DELAY);
+        sensor_history_flush_locked();
+        xSemaphoreGive(archive_mutex);
+    }
+}
+#endif
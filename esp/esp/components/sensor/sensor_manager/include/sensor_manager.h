@@ -11,23 +11,17 @@
 
 #include "esp_err.h"
 #include "i2cdev_config.h"
+#include "sensor_driver.h"
 #include "sh1106.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
-/* Exported types ------------------------------------------------------------*/
+/* Exported defines ----------------------------------------------------------*/
 
-/**
- * @brief Structure containing all sensor readings
- */
-typedef struct
-{
-    float temperature;  //!< Temperature in degrees Celsius from SHT3x
-    float humidity;     //!< Relative humidity in percent from SHT3x
-    uint16_t light;     //!< Light intensity in lux from BH1750
-    uint32_t timestamp; //!< Unix timestamp from DS3231 RTC
-    bool valid;         //!< True if all sensors read successfully
-} sensor_data_t;
+#define SENSOR_MANAGER_MAX_FAILURES 3 //!< Consecutive failures before a driver is dropped
+
+/* Exported types ------------------------------------------------------------*/
 
 /**
  * @brief Structure containing sensor health status
@@ -40,6 +34,21 @@ typedef struct
     bool sh1106_ok; //!< True if SH1106 display is responding
 } sensor_status_t;
 
+/**
+ * @brief Registry entry of one sensor driver
+ */
+typedef struct
+{
+    const char *name;         //!< Driver name
+    bool ready;               //!< Initialized and sampled
+    uint32_t channels;        //!< SENSOR_CHANNEL_* bits provided
+    uint32_t conversion_ms;   //!< Declared conversion time
+    uint32_t reads;           //!< Sample attempts
+    uint32_t errors;          //!< Failed start, fetch or decode
+    uint32_t last_latency_us; //!< Start to decoded, last successful read
+    uint32_t max_latency_us;  //!< Start to decoded, worst successful read
+} sensor_driver_info_t;
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -52,10 +61,8 @@ esp_err_t sensor_manager_init_default(void);
 /**
  * @brief Initialize sensor manager and all connected sensors with custom pins
  *
- * This function initializes the I2C bus and all three sensors:
- * - DS3231 RTC for timestamps
- * - SHT3x for temperature and humidity
- * - BH1750 for light intensity
+ * This function initializes the I2C bus, every driver of the sensor
+ * registry (DS3231 RTC, SHT3x, BH1750) and the SH1106 display.
  *
  * @param[in] sda GPIO pin number for I2C SDA line
  * @param[in] scl GPIO pin number for I2C SCL line
@@ -75,9 +82,64 @@ esp_err_t sensor_manager_init(gpio_num_t sda, gpio_num_t scl);
  */
 esp_err_t sensor_manager_get_status(sensor_status_t *status);
 
+/**
+ * @brief Check whether the sensor manager is initialized
+ *
+ * @return true once sensor_manager_init() succeeded
+ */
+bool sensor_manager_is_initialized(void);
+
+/**
+ * @brief Sample every ready sensor
+ *
+ * Starts the conversions of all ready drivers, then fetches and decodes
+ * each one once its declared conversion time has passed. The call takes
+ * about as long as the slowest conversion.
+ *
+ * @param[out] data Readings; channels has a bit per decoded channel and
+ *                  valid is set when every channel was read. Cleared by
+ *                  the caller.
+ *
+ * @return
+ *      - ESP_OK on success, even when some sensors failed
+ *      - ESP_ERR_INVALID_ARG if data is NULL
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *
+ * @note A driver failing SENSOR_MANAGER_MAX_FAILURES times in a row is
+ *       dropped until the next initialization
+ */
+esp_err_t sensor_manager_sample(sensor_data_t *data);
+
+/**
+ * @brief Get the number of registered sensor drivers
+ *
+ * @return Registry size
+ */
+size_t sensor_manager_get_driver_count(void);
+
+/**
+ * @brief Get state and statistics of one sensor driver
+ *
+ * @param[in] index Registry index, below sensor_manager_get_driver_count()
+ * @param[out] info Driver state and statistics
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if index is out of range or info is NULL
+ */
+esp_err_t sensor_manager_get_driver_info(size_t index, sensor_driver_info_t *info);
+
+/**
+ * @brief Log state, read latency and error count of every sensor driver
+ */
+void sensor_manager_report(void);
+
 /**
  * @brief Get current timestamp from DS3231 RTC
  *
+ * Without a registered RTC driver (trace backend) the system time is
+ * returned instead.
+ *
  * @param[out] timestamp Unix timestamp in seconds
  *
  * @return ESP_OK on success, error code otherwise
@@ -87,6 +149,8 @@ esp_err_t sensor_manager_get_timestamp(uint32_t *timestamp);
 /**
  * @brief Set timestamp to DS3231 RTC
  *
+ * Without a registered RTC driver the system time is set instead.
+ *
  * @param[in] timestamp Unix timestamp in seconds
  *
  * @return ESP_OK on success, error code otherwise
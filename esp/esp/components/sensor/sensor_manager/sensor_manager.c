@@ -8,37 +8,111 @@
 
 #include "sensor_manager.h"
 #include "i2cdev.h"
-#include "ds3231.h"
-#include "sht3x.h"
-#include "bh1750.h"
+#include "ds3231_sensor.h"
+#include "sht3x_sensor.h"
+#include "bh1750_sensor.h"
 #include "sh1106.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <string.h>
+#include <sys/time.h>
 
-/* Exported variables ---------------------------------------------------------*/
+/* Private types -------------------------------------------------------------*/
 
-// Initialization flags (exported for sensor_reader.c)
-bool initialized = false;
-
-// I2C device descriptors (exported for sensor_reader.c)
-ds3231_t ds3231_dev;
-sht3x_t sht3x_dev;
-bh1750_t bh1750_dev;
-sh1106_t sh1106_dev;
-
-// Sensor readiness flags (exported for sensor_reader.c)
-bool ds3231_ready = false;
-bool sht3x_ready = false;
-bool bh1750_ready = false;
-bool sh1106_ready = false;
+/**
+ * @brief Runtime state of one registered driver
+ */
+typedef struct
+{
+    bool attached;            //!< init() succeeded, descriptor held
+    bool ready;               //!< Sampled, cleared when dropped
+    uint8_t failures;         //!< Consecutive failed reads
+    uint32_t reads;           //!< Sample attempts
+    uint32_t errors;          //!< Failed start, fetch or decode
+    uint32_t last_latency_us; //!< Start to decoded, last successful read
+    uint32_t max_latency_us;  //!< Start to decoded, worst successful read
+} sensor_slot_t;
 
 /* Private variables ----------------------------------------------------------*/
 
 static const char *TAG = "SENSOR_MANAGER";
 
+// Sensor registry, initialized and sampled in this order. The trace
+// backend replays samples instead and registers no sensor.
+static const sensor_driver_t *const sensor_drivers[] = {
+#ifdef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+    &ds3231_sensor_driver,
+    &sht3x_sensor_driver,
+    &bh1750_sensor_driver,
+#endif
+};
+
+#define SENSOR_DRIVER_COUNT ((int)(sizeof(sensor_drivers) / sizeof(sensor_drivers[0])))
+
+// The bus is brought up only when something sits on it
+#if defined(CONFIG_SENSOR_READER_BACKEND_HARDWARE) || defined(CONFIG_DISPLAY_SH1106)
+#define SENSOR_MANAGER_USES_I2C 1
+#else
+#define SENSOR_MANAGER_USES_I2C 0
+#endif
+
+static sensor_slot_t sensor_slots[SENSOR_DRIVER_COUNT];
+static portMUX_TYPE slot_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool initialized = false;
+
+#ifdef CONFIG_DISPLAY_SH1106
+static sh1106_t sh1106_dev;
+#endif
+static bool sh1106_ready = false;
+
 // I2C configuration
 static int i2c_port = 0; //!< I2C port 0
 
+/* Private function prototypes -----------------------------------------------*/
+
+#ifdef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+/**
+ * @brief Check whether a registered driver is ready
+ *
+ * @param[in] driver Registered driver
+ *
+ * @return true if the driver is in the registry and ready
+ */
+static bool sensor_manager_driver_ready(const sensor_driver_t *driver);
+#endif
+
+/**
+ * @brief Account one read attempt of a driver
+ *
+ * Drops the driver after SENSOR_MANAGER_MAX_FAILURES failures in a row.
+ * Its descriptor stays allocated until sensor_manager_deinit().
+ *
+ * @param[in] index Registry index
+ * @param[in] result Outcome of the read
+ * @param[in] latency_us Start to decoded, used on success
+ */
+static void sensor_manager_account(int index, esp_err_t result, int64_t latency_us);
+
+/**
+ * @brief Sleep until a point in time
+ *
+ * @param[in] deadline_us esp_timer time to reach
+ */
+static void sensor_manager_wait_until(int64_t deadline_us);
+
+#ifdef CONFIG_DISPLAY_SH1106
+/**
+ * @brief Add the SH1106 panel to the bus and initialize it
+ *
+ * @param[in] sda SDA pin
+ * @param[in] scl SCL pin
+ */
+static void sensor_manager_init_display(gpio_num_t sda, gpio_num_t scl);
+#endif
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -65,6 +139,7 @@ esp_err_t sensor_manager_init(gpio_num_t sda, gpio_num_t scl)
         return ESP_OK;
     }
 
+#if SENSOR_MANAGER_USES_I2C
     // Initialize I2C bus
     ret = i2c_bus_init(i2c_port, sda, scl, I2C_MASTER_FREQ_HZ);
     if (ret != ESP_OK)
@@ -73,161 +148,206 @@ esp_err_t sensor_manager_init(gpio_num_t sda, gpio_num_t scl)
         return ESP_FAIL;
     }
     ESP_LOGI(TAG, "I2C bus initialized successfully");
+#else
+    ESP_LOGI(TAG, "No I2C sensor or display configured, bus not started");
+#endif
 
-    // Initialize DS3231 RTC
-    ret = ds3231_init_desc(&ds3231_dev, i2c_port, sda, scl);
-    if (ret == ESP_OK)
+    // Each driver adds its device, verifies it and selects its SCL clock
+    int ready_count = 0;
+    for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
     {
-        // Add device to I2C bus
-        ret = i2c_dev_init(&ds3231_dev.i2c_dev);
-        if (ret != ESP_OK)
+        const sensor_driver_t *driver = sensor_drivers[i];
+
+        memset(&sensor_slots[i], 0, sizeof(sensor_slots[i]));
+
+        ret = driver->init(i2c_port, sda, scl);
+        if (ret == ESP_OK)
         {
-            ds3231_free_desc(&ds3231_dev);
-            ds3231_ready = false;
-            ESP_LOGW(TAG, "DS3231 device add failed: %s", esp_err_to_name(ret));
+            sensor_slots[i].attached = true;
+            sensor_slots[i].ready = true;
+            ready_count++;
+            ESP_LOGI(TAG, "%s initialized (conversion %lu ms)", driver->name, (unsigned long)driver->conversion_ms);
         }
         else
         {
-            // Verify hardware by reading time
-            struct tm time;
-            ret = ds3231_get_time(&ds3231_dev, &time);
-            if (ret == ESP_OK)
-            {
-                ds3231_ready = true;
-                ESP_LOGI(TAG, "DS3231 RTC initialized");
-            }
-            else
-            {
-                ds3231_free_desc(&ds3231_dev);
-                ds3231_ready = false;
-                ESP_LOGW(TAG, "DS3231 hardware verification failed: %s", esp_err_to_name(ret));
-            }
+            ESP_LOGW(TAG, "%s initialization failed: %s", driver->name, esp_err_to_name(ret));
         }
     }
-    else
+
+#ifdef CONFIG_DISPLAY_SH1106
+    sensor_manager_init_display(sda, scl);
+#endif
+
+    // Check if at least one sensor is ready
+    if (SENSOR_DRIVER_COUNT > 0 && ready_count == 0)
     {
-        ds3231_ready = false;
-        ESP_LOGW(TAG, "DS3231 initialization failed: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "All sensor initializations failed");
+        return ESP_ERR_NOT_FOUND;
     }
 
-    // Initialize SHT3x sensor
-    ret = sht3x_init_desc(&sht3x_dev, SHT3X_I2C_ADDR_GND, i2c_port, sda, scl);
-    if (ret == ESP_OK)
+    initialized = true;
+
+    ESP_LOGI(TAG, "Sensor Manager initialized (%d/%d sensors, SH1106=%d)",
+             ready_count, SENSOR_DRIVER_COUNT, sh1106_ready);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Check whether the sensor manager is initialized
+ */
+bool sensor_manager_is_initialized(void)
+{
+    return initialized;
+}
+
+/**
+ * @brief Sample every ready sensor
+ */
+esp_err_t sensor_manager_sample(sensor_data_t *data)
+{
+    if (data == NULL)
     {
-        // Add device to I2C bus
-        ret = i2c_dev_init(&sht3x_dev.i2c_dev);
-        if (ret != ESP_OK)
-        {
-            sht3x_free_desc(&sht3x_dev);
-            sht3x_ready = false;
-            ESP_LOGW(TAG, "SHT3x device add failed: %s", esp_err_to_name(ret));
-        }
-        else
-        {
-            ret = sht3x_init(&sht3x_dev);
-            if (ret == ESP_OK)
-            {
-                sht3x_ready = true;
-                ESP_LOGI(TAG, "SHT3x sensor initialized");
-            }
-            else
-            {
-                sht3x_free_desc(&sht3x_dev);
-                sht3x_ready = false;
-                ESP_LOGW(TAG, "SHT3x hardware verification failed: %s", esp_err_to_name(ret));
-            }
-        }
+        return ESP_ERR_INVALID_ARG;
     }
-    else
+
+    if (!initialized)
     {
-        sht3x_ready = false;
-        ESP_LOGW(TAG, "SHT3x initialization failed: %s", esp_err_to_name(ret));
+        return ESP_ERR_INVALID_STATE;
     }
 
-    // Initialize BH1750 light sensor
-    ret = bh1750_init_desc(&bh1750_dev, BH1750_ADDR_LO, i2c_port, sda, scl);
-    if (ret == ESP_OK)
+    int64_t start_us[SENSOR_DRIVER_COUNT];
+    int64_t due_us[SENSOR_DRIVER_COUNT];
+    bool pending[SENSOR_DRIVER_COUNT];
+    uint32_t channels = 0;
+
+    // Start every conversion first so they run side by side
+    for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
     {
-        // Add device to I2C bus
-        ret = i2c_dev_init(&bh1750_dev.i2c_dev);
-        if (ret != ESP_OK)
+        const sensor_driver_t *driver = sensor_drivers[i];
+
+        pending[i] = false;
+        if (!sensor_slots[i].ready)
         {
-            bh1750_free_desc(&bh1750_dev);
-            bh1750_ready = false;
-            ESP_LOGW(TAG, "BH1750 device add failed: %s", esp_err_to_name(ret));
+            continue;
         }
-        else
+
+        start_us[i] = esp_timer_get_time();
+        if (driver->start != NULL)
         {
-            // Verify hardware by setup sensor
-            ret = bh1750_setup(&bh1750_dev, BH1750_MODE_CONTINUOUS, BH1750_RES_HIGH);
-            if (ret == ESP_OK)
+            esp_err_t ret = driver->start();
+            if (ret != ESP_OK)
             {
-                bh1750_ready = true;
-                ESP_LOGI(TAG, "BH1750 sensor initialized");
-            }
-            else
-            {
-                bh1750_free_desc(&bh1750_dev);
-                bh1750_ready = false;
-                ESP_LOGW(TAG, "BH1750 hardware verification failed: %s", esp_err_to_name(ret));
+                ESP_LOGE(TAG, "%s start failed: %s", driver->name, esp_err_to_name(ret));
+                sensor_manager_account(i, ret, 0);
+                continue;
             }
         }
-    }
-    else
-    {
-        bh1750_ready = false;
-        ESP_LOGW(TAG, "BH1750 initialization failed: %s", esp_err_to_name(ret));
+
+        due_us[i] = start_us[i] + (int64_t)driver->conversion_ms * 1000;
+        pending[i] = true;
     }
 
-    // Initialize SH1106 OLED display
-    ret = sh1106_init_desc(&sh1106_dev, 0x3C, i2c_port, sda, scl);
-    if (ret == ESP_OK)
+    // Collect results in the order they become ready
+    for (;;)
     {
-        // Add device to I2C bus
-        ret = i2c_dev_init(&sh1106_dev.i2c_dev);
-        if (ret != ESP_OK)
+        int next = -1;
+        for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
         {
-            sh1106_free_desc(&sh1106_dev);
-            sh1106_ready = false;
-            ESP_LOGW(TAG, "SH1106 device add failed: %s", esp_err_to_name(ret));
+            if (pending[i] && (next < 0 || due_us[i] < due_us[next]))
+            {
+                next = i;
+            }
+        }
+
+        if (next < 0)
+        {
+            break;
+        }
+
+        const sensor_driver_t *driver = sensor_drivers[next];
+        uint8_t raw[SENSOR_DRIVER_RAW_MAX];
+
+        pending[next] = false;
+        sensor_manager_wait_until(due_us[next]);
+
+        esp_err_t ret = driver->fetch(raw);
+        if (ret == ESP_OK)
+        {
+            ret = driver->decode(raw, data);
+        }
+
+        sensor_manager_account(next, ret, esp_timer_get_time() - start_us[next]);
+
+        if (ret == ESP_OK)
+        {
+            channels |= driver->channels;
         }
         else
         {
-            ret = sh1106_init(&sh1106_dev);
-            if (ret == ESP_OK)
-            {
-                sh1106_ready = true;
-                ESP_LOGI(TAG, "SH1106 display initialized");
-            }
-            else
-            {
-                sh1106_free_desc(&sh1106_dev);
-                sh1106_ready = false;
-                ESP_LOGW(TAG, "SH1106 hardware verification failed: %s", esp_err_to_name(ret));
-            }
+            ESP_LOGE(TAG, "%s read failed: %s", driver->name, esp_err_to_name(ret));
         }
     }
-    else
-    {
-        sh1106_ready = false;
-        ESP_LOGW(TAG, "SH1106 initialization failed: %s", esp_err_to_name(ret));
-    }
 
-    // Check if at least one sensor is ready
-    if (!ds3231_ready && !sht3x_ready && !bh1750_ready)
+    data->channels = channels;
+    data->valid = (channels & SENSOR_CHANNEL_ALL) == SENSOR_CHANNEL_ALL;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the number of registered sensor drivers
+ */
+size_t sensor_manager_get_driver_count(void)
+{
+    return (size_t)SENSOR_DRIVER_COUNT;
+}
+
+/**
+ * @brief Get state and statistics of one sensor driver
+ */
+esp_err_t sensor_manager_get_driver_info(size_t index, sensor_driver_info_t *info)
+{
+    if (info == NULL || index >= sensor_manager_get_driver_count())
     {
-        ESP_LOGE(TAG, "All sensor initializations failed");
-        return ESP_ERR_NOT_FOUND;
+        return ESP_ERR_INVALID_ARG;
     }
 
-    initialized = true;
+    const sensor_driver_t *driver = sensor_drivers[index];
 
-    ESP_LOGI(TAG, "Sensor Manager initialized (DS3231=%d, SHT3x=%d, BH1750=%d, SH1106=%d)",
-             ds3231_ready, sht3x_ready, bh1750_ready, sh1106_ready);
+    info->name = driver->name;
+    info->channels = driver->channels;
+    info->conversion_ms = driver->conversion_ms;
+
+    portENTER_CRITICAL(&slot_lock);
+    info->ready = sensor_slots[index].ready;
+    info->reads = sensor_slots[index].reads;
+    info->errors = sensor_slots[index].errors;
+    info->last_latency_us = sensor_slots[index].last_latency_us;
+    info->max_latency_us = sensor_slots[index].max_latency_us;
+    portEXIT_CRITICAL(&slot_lock);
 
     return ESP_OK;
 }
 
+/**
+ * @brief Log state, read latency and error count of every sensor driver
+ */
+void sensor_manager_report(void)
+{
+    for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
+    {
+        sensor_driver_info_t info;
+
+        sensor_manager_get_driver_info((size_t)i, &info);
+        ESP_LOGI(TAG, "%s: %s, reads=%lu errors=%lu, latency last=%lu us max=%lu us (conversion %lu ms)",
+                 info.name, info.ready ? "ready" : "off",
+                 (unsigned long)info.reads, (unsigned long)info.errors,
+                 (unsigned long)info.last_latency_us, (unsigned long)info.max_latency_us,
+                 (unsigned long)info.conversion_ms);
+    }
+}
+
 /**
  * @brief Get health status of all sensors
  */
@@ -239,13 +359,20 @@ esp_err_t sensor_manager_get_status(sensor_status_t *status)
         return ESP_ERR_INVALID_ARG;
     }
 
-    status->ds3231_ok = ds3231_ready;
-    status->sht3x_ok = sht3x_ready;
-    status->bh1750_ok = bh1750_ready;
+#ifdef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+    status->ds3231_ok = sensor_manager_driver_ready(&ds3231_sensor_driver);
+    status->sht3x_ok = sensor_manager_driver_ready(&sht3x_sensor_driver);
+    status->bh1750_ok = sensor_manager_driver_ready(&bh1750_sensor_driver);
+#else
+    // Trace backend: no sensor is registered
+    status->ds3231_ok = false;
+    status->sht3x_ok = false;
+    status->bh1750_ok = false;
+#endif
     status->sh1106_ok = sh1106_ready;
 
-    ESP_LOGD(TAG, "Sensor status: DS3231=%d, SHT3x=%d, BH1750=%d, SH1106=%d", 
-             ds3231_ready, sht3x_ready, bh1750_ready, sh1106_ready);
+    ESP_LOGD(TAG, "Sensor status: DS3231=%d, SHT3x=%d, BH1750=%d, SH1106=%d",
+             status->ds3231_ok, status->sht3x_ok, status->bh1750_ok, status->sh1106_ok);
 
     return ESP_OK;
 }
@@ -263,28 +390,15 @@ esp_err_t sensor_manager_deinit(void)
 
     ESP_LOGI(TAG, "Deinitializing sensor manager");
 
-    // Free SHT3x resources
-    if (sht3x_ready)
-    {
-        sht3x_free_desc(&sht3x_dev);
-        sht3x_ready = false;
-        ESP_LOGD(TAG, "SHT3x freed");
-    }
-
-    // Free DS3231 resources
-    if (ds3231_ready)
-    {
-        ds3231_free_desc(&ds3231_dev);
-        ds3231_ready = false;
-        ESP_LOGD(TAG, "DS3231 freed");
-    }
-
-    // Free BH1750 resources
-    if (bh1750_ready)
+    for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
     {
-        bh1750_free_desc(&bh1750_dev);
-        bh1750_ready = false;
-        ESP_LOGD(TAG, "BH1750 freed");
+        if (sensor_slots[i].attached)
+        {
+            sensor_drivers[i]->deinit();
+            sensor_slots[i].attached = false;
+            sensor_slots[i].ready = false;
+            ESP_LOGD(TAG, "%s freed", sensor_drivers[i]->name);
+        }
     }
 
     // Note: I2C Master driver (new API) is managed by i2cdev layer
@@ -301,13 +415,25 @@ esp_err_t sensor_manager_deinit(void)
  */
 esp_err_t sensor_manager_get_timestamp(uint32_t *timestamp)
 {
-    if (!ds3231_ready)
+    if (timestamp == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#ifndef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+    // Without an RTC (trace backend) the system clock is the time source
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    *timestamp = (uint32_t)tv.tv_sec;
+    return ESP_OK;
+#else
+    if (!sensor_manager_driver_ready(&ds3231_sensor_driver))
     {
         ESP_LOGW(TAG, "DS3231 not ready");
         return ESP_ERR_INVALID_STATE;
     }
 
-    esp_err_t ret = ds3231_get_timestamp(&ds3231_dev, timestamp);
+    esp_err_t ret = ds3231_get_timestamp(ds3231_sensor_get_device(), timestamp);
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to get timestamp from DS3231: %s", esp_err_to_name(ret));
@@ -315,6 +441,7 @@ esp_err_t sensor_manager_get_timestamp(uint32_t *timestamp)
     }
 
     return ESP_OK;
+#endif
 }
 
 /**
@@ -322,7 +449,12 @@ esp_err_t sensor_manager_get_timestamp(uint32_t *timestamp)
  */
 esp_err_t sensor_manager_set_timestamp(uint32_t timestamp)
 {
-    if (!ds3231_ready)
+#ifndef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+    struct timeval tv = {.tv_sec = (time_t)timestamp, .tv_usec = 0};
+    ESP_LOGI(TAG, "No RTC, setting system time: %lu", (unsigned long)timestamp);
+    return (settimeofday(&tv, NULL) == 0) ? ESP_OK : ESP_FAIL;
+#else
+    if (!sensor_manager_driver_ready(&ds3231_sensor_driver))
     {
         ESP_LOGW(TAG, "DS3231 not ready");
         return ESP_ERR_INVALID_STATE;
@@ -330,7 +462,7 @@ esp_err_t sensor_manager_set_timestamp(uint32_t timestamp)
 
     ESP_LOGI(TAG, "Setting timestamp: %lu", (unsigned long)timestamp);
 
-    esp_err_t ret = ds3231_set_timestamp(&ds3231_dev, timestamp);
+    esp_err_t ret = ds3231_set_timestamp(ds3231_sensor_get_device(), timestamp);
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "Failed to set timestamp to DS3231: %s", esp_err_to_name(ret));
@@ -339,6 +471,7 @@ esp_err_t sensor_manager_set_timestamp(uint32_t timestamp)
 
     ESP_LOGI(TAG, "Timestamp set successfully");
     return ESP_OK;
+#endif
 }
 
 /**
@@ -346,11 +479,134 @@ esp_err_t sensor_manager_set_timestamp(uint32_t timestamp)
  */
 sh1106_t* sensor_manager_get_display_device(void)
 {
+#ifdef CONFIG_DISPLAY_SH1106
     if (!sh1106_ready)
     {
         ESP_LOGW(TAG, "SH1106 display not ready");
         return NULL;
     }
-    
+
     return &sh1106_dev;
+#else
+    return NULL;
+#endif
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+#ifdef CONFIG_SENSOR_READER_BACKEND_HARDWARE
+/**
+ * @brief Check whether a registered driver is ready
+ */
+static bool sensor_manager_driver_ready(const sensor_driver_t *driver)
+{
+    for (int i = 0; i < SENSOR_DRIVER_COUNT; i++)
+    {
+        if (sensor_drivers[i] == driver)
+        {
+            return sensor_slots[i].ready;
+        }
+    }
+
+    return false;
+}
+#endif
+
+/**
+ * @brief Account one read attempt of a driver
+ */
+static void sensor_manager_account(int index, esp_err_t result, int64_t latency_us)
+{
+    sensor_slot_t *slot = &sensor_slots[index];
+    bool dropped = false;
+
+    portENTER_CRITICAL(&slot_lock);
+    slot->reads++;
+    if (result == ESP_OK)
+    {
+        slot->failures = 0;
+        slot->last_latency_us = (uint32_t)latency_us;
+        if (slot->last_latency_us > slot->max_latency_us)
+        {
+            slot->max_latency_us = slot->last_latency_us;
+        }
+    }
+    else
+    {
+        slot->errors++;
+        if (++slot->failures >= SENSOR_MANAGER_MAX_FAILURES)
+        {
+            slot->ready = false;
+            dropped = true;
+        }
+    }
+    portEXIT_CRITICAL(&slot_lock);
+
+    if (dropped)
+    {
+        ESP_LOGE(TAG, "%s dropped after %d failures", sensor_drivers[index]->name, SENSOR_MANAGER_MAX_FAILURES);
+    }
+}
+
+/**
+ * @brief Sleep until a point in time
+ */
+static void sensor_manager_wait_until(int64_t deadline_us)
+{
+    const int64_t tick_us = (int64_t)portTICK_PERIOD_MS * 1000;
+    int64_t remaining_us = deadline_us - esp_timer_get_time();
+
+    // vTaskDelay may return up to one tick early, so check again
+    while (remaining_us > 0)
+    {
+        vTaskDelay((TickType_t)((remaining_us + tick_us - 1) / tick_us));
+        remaining_us = deadline_us - esp_timer_get_time();
+    }
+}
+
+#ifdef CONFIG_DISPLAY_SH1106
+/**
+ * @brief Add the SH1106 panel to the bus and initialize it
+ */
+static void sensor_manager_init_display(gpio_num_t sda, gpio_num_t scl)
+{
+    esp_err_t ret = sh1106_init_desc(&sh1106_dev, 0x3C, i2c_port, sda, scl);
+    if (ret == ESP_OK)
+    {
+        // Add device to I2C bus
+        ret = i2c_dev_init(&sh1106_dev.i2c_dev);
+        if (ret != ESP_OK)
+        {
+            sh1106_free_desc(&sh1106_dev);
+            sh1106_ready = false;
+            ESP_LOGW(TAG, "SH1106 device add failed: %s", esp_err_to_name(ret));
+        }
+        else
+        {
+            ret = sh1106_init(&sh1106_dev);
+            if (ret == ESP_OK)
+            {
+                sh1106_ready = true;
+                ESP_LOGI(TAG, "SH1106 display initialized");
+            }
+            else
+            {
+                sh1106_free_desc(&sh1106_dev);
+                sh1106_ready = false;
+                ESP_LOGW(TAG, "SH1106 hardware verification failed: %s", esp_err_to_name(ret));
+            }
+        }
+    }
+    else
+    {
+        sh1106_ready = false;
+        ESP_LOGW(TAG, "SH1106 initialization failed: %s", esp_err_to_name(ret));
+    }
+
+    // The display page flush gains the most from a faster SCL clock
+    if (sh1106_ready)
+    {
+        sh1106_probe_speed(&sh1106_dev);
+    }
 }
+#endif
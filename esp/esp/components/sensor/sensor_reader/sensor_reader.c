@@ -6,29 +6,34 @@
 /* Includes ------------------------------------------------------------------*/
 
 #include "sensor_reader.h"
-#include "ds3231.h"
-#include "sht3x.h"
-#include "bh1750.h"
+#include "sensor_manager.h"
+#include "sensor_trace.h"
 #include "esp_log.h"
 #include <string.h>
-
-/* External variables ---------------------------------------------------------*/
-
-// Forward declarations - internal access only
-extern ds3231_t ds3231_dev;
-extern sht3x_t sht3x_dev;
-extern bh1750_t bh1750_dev;
-
-extern bool initialized;
-
-extern bool ds3231_ready;
-extern bool sht3x_ready;
-extern bool bh1750_ready;
+#include <sys/time.h>
 
 /* Private variables ----------------------------------------------------------*/
 
 static const char *TAG = "SENSOR_READER";
 
+/* Private function prototypes -----------------------------------------------*/
+
+#ifndef CONFIG_SENSOR_READER_BACKEND_TRACE
+/**
+ * @brief Read all values from the I2C sensors
+ *
+ * @param[out] data Readings, cleared by the caller
+ */
+static void sensor_reader_read_hardware(sensor_data_t *data);
+#else
+/**
+ * @brief Read all values from the replayed trace
+ *
+ * @param[out] data Readings, cleared by the caller
+ */
+static void sensor_reader_read_trace(sensor_data_t *data);
+#endif
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -42,95 +47,86 @@ esp_err_t sensor_reader_read_all(sensor_data_t *data)
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (!initialized)
+    if (!sensor_manager_is_initialized())
     {
         ESP_LOGE(TAG, "Sensor manager not initialized");
         return ESP_ERR_INVALID_STATE;
     }
 
-    ESP_LOGI(TAG, "Reading all sensors...");
-
     // Initialize data structure
     memset(data, 0, sizeof(sensor_data_t));
 
-    // Track individual sensor success
-    bool ds3231_success = false;
-    bool sht3x_success = false;
-    bool bh1750_success = false;
+#ifdef CONFIG_SENSOR_READER_BACKEND_TRACE
+    sensor_reader_read_trace(data);
+#else
+    sensor_reader_read_hardware(data);
 
-    // Read DS3231 timestamp
-    if (ds3231_ready)
-    {
-        esp_err_t ret = ds3231_get_timestamp(&ds3231_dev, &data->timestamp);
-        if (ret != ESP_OK)
-        {
-            ESP_LOGE(TAG, "DS3231 read failed: %s", esp_err_to_name(ret));
-            ds3231_ready = false;
-        }
-        else
-        {
-            ESP_LOGI(TAG, "DS3231: timestamp %lu", data->timestamp);
-            ds3231_success = true;
-        }
-    }
-    else
+    // Complete samples feed a running trace recording
+    if (data->valid)
     {
-        ESP_LOGW(TAG, "DS3231 not available (not initialized)");
+        sensor_trace_record_sample(data->temperature, data->humidity, data->light);
     }
+#endif
+
+    return ESP_OK;
+}
+
+/* Private functions ---------------------------------------------------------*/
 
-    // Read SHT3x temperature and humidity
-    if (sht3x_ready)
+#ifndef CONFIG_SENSOR_READER_BACKEND_TRACE
+/**
+ * @brief Read all values from the I2C sensors
+ */
+static void sensor_reader_read_hardware(sensor_data_t *data)
+{
+    ESP_LOGI(TAG, "Reading all sensors...");
+
+    // Conversions overlap; the call lasts about as long as the slowest one
+    sensor_manager_sample(data);
+
+    if (data->valid)
     {
-        esp_err_t ret = sht3x_measure(&sht3x_dev, &data->temperature, &data->humidity);
-        if (ret != ESP_OK)
-        {
-            ESP_LOGE(TAG, "SHT3x read failed: %s", esp_err_to_name(ret));
-            sht3x_ready = false;
-        }
-        else
-        {
-            ESP_LOGI(TAG, "SHT3x: temp=%.2f°C, humidity=%.2f%%",
-                     data->temperature, data->humidity);
-            sht3x_success = true;
-        }
+        ESP_LOGI(TAG, "All sensors read successfully: timestamp %lu, temp=%.2f°C, humidity=%.2f%%, light=%u lux",
+                 (unsigned long)data->timestamp, data->temperature, data->humidity, data->light);
     }
     else
     {
-        ESP_LOGW(TAG, "SHT3x not available (not initialized)");
+        ESP_LOGW(TAG, "Partial reading: timestamp %lu, temp=%.2f°C, humidity=%.2f%%, light=%u lux",
+                 (unsigned long)data->timestamp, data->temperature, data->humidity, data->light);
     }
+}
+#else
+/**
+ * @brief Read all values from the replayed trace
+ */
+static void sensor_reader_read_trace(sensor_data_t *data)
+{
+    sensor_trace_sample_t sample;
 
-    // Read BH1750 light intensity
-    if (bh1750_ready)
+    // Open the configured trace on first use
+    esp_err_t ret = sensor_trace_next(&sample);
+    if (ret == ESP_ERR_INVALID_STATE && sensor_trace_open(NULL) == ESP_OK)
     {
-        esp_err_t ret = bh1750_read_light_basic(&bh1750_dev, &data->light);
-        if (ret != ESP_OK)
-        {
-            ESP_LOGE(TAG, "BH1750 read failed: %s", esp_err_to_name(ret));
-            bh1750_ready = false;
-        }
-        else
-        {
-            ESP_LOGI(TAG, "BH1750: light=%u lux", data->light);
-            bh1750_success = true;
-        }
-    }
-    else
-    {
-        ESP_LOGW(TAG, "BH1750 not available (not initialized)");
+        ret = sensor_trace_next(&sample);
     }
 
-    // Determine overall validity
-    data->valid = ds3231_success && sht3x_success && bh1750_success;
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    data->timestamp = (uint32_t)tv.tv_sec;
 
-    if (data->valid)
+    if (ret != ESP_OK)
     {
-        ESP_LOGI(TAG, "All sensors read successfully");
-    }
-    else
-    {
-        ESP_LOGW(TAG, "Partial success: DS3231=%d, SHT3x=%d, BH1750=%d",
-                 ds3231_success, sht3x_success, bh1750_success);
+        ESP_LOGW(TAG, "Trace: no sample (%s)", esp_err_to_name(ret));
+        return;
     }
 
-    return ESP_OK;
+    data->temperature = sample.temperature;
+    data->humidity = sample.humidity;
+    data->light = sample.light;
+    data->channels = SENSOR_CHANNEL_ALL;
+    data->valid = true;
+
+    ESP_LOGI(TAG, "Trace @%lums: temp=%.2f°C, humidity=%.2f%%, light=%u lux",
+             (unsigned long)sample.t_ms, data->temperature, data->humidity, data->light);
 }
+#endif
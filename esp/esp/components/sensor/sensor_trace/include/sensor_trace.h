@@ -0,0 +1,137 @@
+/**
+ * @file sensor_trace.h
+ *
+ * @brief Sensor Trace Replay and Recording API
+ *
+ * Replays recorded sensor traces in place of the I2C sensors and records
+ * traces in the same format from real hardware. A trace is CSV text, one
+ * sample per line as "t_ms,temperature,humidity,lux", with t_ms relative
+ * to the first sample. Lines starting with '#' are comments.
+ */
+
+#ifndef SENSOR_TRACE_H
+#define SENSOR_TRACE_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief One trace sample
+ */
+typedef struct
+{
+    uint32_t t_ms;     //!< Sample time relative to the first sample
+    float temperature; //!< Temperature in degrees Celsius
+    float humidity;    //!< Relative humidity in percent
+    uint16_t light;    //!< Light intensity in lux
+} sensor_trace_sample_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize trace replay and recording
+ *
+ * Opens no trace; replay starts with sensor_trace_open().
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sensor_trace_init(void);
+
+/**
+ * @brief Open a trace for replay and start the replay clock
+ *
+ * Mounts the storage partition if needed. Replaces the open trace.
+ *
+ * @param[in] path File path, NULL for the configured source (embedded
+ *                 trace or CONFIG_SENSOR_TRACE_FILE)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *      - ESP_ERR_NOT_FOUND if the trace file cannot be opened
+ *      - ESP_ERR_INVALID_SIZE if the trace holds no sample
+ */
+esp_err_t sensor_trace_open(const char *path);
+
+/**
+ * @brief Get the sample due now
+ *
+ * With a speed of 0, every call returns the next sample. Otherwise the
+ * trace advances with the replay clock scaled by the speed and the latest
+ * sample at or before the current trace time is returned.
+ *
+ * @param[out] sample Sample due now
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_FOUND once the trace has ended and looping is off
+ *      - ESP_ERR_INVALID_STATE if no trace is open
+ */
+esp_err_t sensor_trace_next(sensor_trace_sample_t *sample);
+
+/**
+ * @brief Set replay speed
+ *
+ * @param[in] speed_pct Percent of real time (100 = recorded pace), 0 to
+ *                      step one sample per read
+ */
+void sensor_trace_set_speed(uint32_t speed_pct);
+
+/**
+ * @brief Enable or disable looping at the end of the trace
+ *
+ * @param[in] loop true to restart from the first sample
+ */
+void sensor_trace_set_loop(bool loop);
+
+/**
+ * @brief Restart replay from the first sample
+ */
+void sensor_trace_rewind(void);
+
+/**
+ * @brief Start recording samples to a trace file
+ *
+ * Replaces the file. Recording stops by itself after max_samples.
+ *
+ * @param[in] path File path, NULL for CONFIG_SENSOR_TRACE_RECORD_FILE
+ * @param[in] max_samples Samples to record, 0 for no limit
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if a recording is already running
+ *      - ESP_FAIL if the file cannot be created
+ */
+esp_err_t sensor_trace_record_start(const char *path, uint32_t max_samples);
+
+/**
+ * @brief Append a sample to the running recording
+ *
+ * Does nothing when no recording is running.
+ *
+ * @param[in] temperature Temperature in degrees Celsius
+ * @param[in] humidity Relative humidity in percent
+ * @param[in] light Light intensity in lux
+ */
+void sensor_trace_record_sample(float temperature, float humidity, uint16_t light);
+
+/**
+ * @brief Stop the running recording
+ *
+ * @return Number of samples written
+ */
+uint32_t sensor_trace_record_stop(void);
+
+/**
+ * @brief Check whether a recording is running
+ *
+ * @return true while recording
+ */
+bool sensor_trace_is_recording(void);
+
+#endif /* SENSOR_TRACE_H */
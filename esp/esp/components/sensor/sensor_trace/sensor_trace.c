@@ -0,0 +1,626 @@
+/**
+ * @file sensor_trace.c
+ *
+ * @brief Sensor Trace Replay and Recording Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sensor_trace.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_spiffs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define TRACE_LINE_MAX 64                                //!< Longest accepted trace line
+#define TRACE_HEADER "# t_ms,temperature,humidity,lux\n" //!< Written at the top of recordings
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Replay state
+ */
+typedef struct
+{
+    bool open;                      //!< A trace source is open
+    FILE *file;                     //!< File source, NULL for the embedded trace
+    const char *cursor;             //!< Read position in the embedded trace
+    uint32_t speed_pct;             //!< Percent of real time, 0 = step per read
+    bool loop;                      //!< Restart at the end
+    uint64_t base_trace_ms;         //!< Trace time at base_us
+    int64_t base_us;                //!< Replay clock origin
+    uint64_t loop_offset_ms;        //!< Trace time of the current pass start
+    uint64_t last_at_ms;            //!< Trace time of the last fetched sample
+    uint32_t gap_ms;                //!< Spacing before the last fetched sample
+    uint32_t fetched;               //!< Samples fetched since open
+    sensor_trace_sample_t current;  //!< Sample returned by the last read
+    uint64_t current_at_ms;         //!< Trace time of current
+    bool have_current;              //!< current is valid
+    sensor_trace_sample_t pending;  //!< Next sample
+    uint64_t pending_at_ms;         //!< Trace time of pending
+    bool have_pending;              //!< pending is valid
+} trace_replay_t;
+
+/**
+ * @brief Recording state
+ */
+typedef struct
+{
+    FILE *file;           //!< Output file, NULL when idle
+    uint32_t count;       //!< Samples written
+    uint32_t max_samples; //!< Stop after this many, 0 = no limit
+    int64_t start_us;     //!< Time of the first sample
+} trace_recorder_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "SENSOR_TRACE";
+
+// Embedded trace, NUL terminated by EMBED_TXTFILES
+extern const char trace_embedded_start[] asm("_binary_demo_csv_start");
+
+static SemaphoreHandle_t mutex = NULL;
+static StaticSemaphore_t mutex_buffer;
+
+static trace_replay_t replay = {
+    .speed_pct = CONFIG_SENSOR_TRACE_SPEED_PCT,
+#ifdef CONFIG_SENSOR_TRACE_LOOP
+    .loop = true,
+#endif
+};
+static trace_recorder_t recorder = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Mount the trace storage partition if it is not mounted yet
+ *
+ * @param[in] format Format the partition if it cannot be mounted
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sensor_trace_mount(bool format);
+
+/**
+ * @brief Open a trace source and prime the first sample
+ *
+ * @param[in] path File path, NULL for the embedded trace
+ *
+ * @return ESP_OK on success, error code otherwise
+ *
+ * @note Caller holds the mutex
+ */
+static esp_err_t sensor_trace_open_locked(const char *path);
+
+/**
+ * @brief Close the open trace source
+ *
+ * @note Caller holds the mutex
+ */
+static void sensor_trace_close_locked(void);
+
+/**
+ * @brief Parse the next sample from the source
+ *
+ * @param[out] sample Parsed sample
+ *
+ * @return false at the end of the source
+ */
+static bool sensor_trace_parse_next(sensor_trace_sample_t *sample);
+
+/**
+ * @brief Load the next sample into pending, wrapping when looping
+ *
+ * @return false when the trace has ended
+ */
+static bool sensor_trace_fetch(void);
+
+/**
+ * @brief Current trace time from the replay clock
+ *
+ * @return Trace time in milliseconds
+ */
+static uint64_t sensor_trace_now_ms(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Initialize trace replay and recording
+ */
+esp_err_t sensor_trace_init(void)
+{
+    if (mutex == NULL)
+    {
+        mutex = xSemaphoreCreateMutexStatic(&mutex_buffer);
+    }
+
+    return mutex ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Open a trace for replay and start the replay clock
+ */
+esp_err_t sensor_trace_open(const char *path)
+{
+    if (mutex == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+#ifdef CONFIG_SENSOR_TRACE_SOURCE_FILE
+    if (path == NULL)
+    {
+        path = CONFIG_SENSOR_TRACE_FILE;
+    }
+#endif
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    esp_err_t ret = sensor_trace_open_locked(path);
+    xSemaphoreGive(mutex);
+
+    if (ret == ESP_OK)
+    {
+        ESP_LOGI(TAG, "Replaying %s at %lu%%%s", path ? path : "embedded trace",
+                 (unsigned long)replay.speed_pct, replay.loop ? ", looped" : "");
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Cannot replay %s: %s", path ? path : "embedded trace", esp_err_to_name(ret));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Get the sample due now
+ */
+esp_err_t sensor_trace_next(sensor_trace_sample_t *sample)
+{
+    if (sample == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (mutex == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    if (!replay.open)
+    {
+        xSemaphoreGive(mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (replay.speed_pct == 0)
+    {
+        // Step mode: one sample per read, independent of timing
+        if (!replay.have_pending)
+        {
+            xSemaphoreGive(mutex);
+            return ESP_ERR_NOT_FOUND;
+        }
+
+        replay.current = replay.pending;
+        replay.current_at_ms = replay.pending_at_ms;
+        replay.have_current = true;
+        replay.have_pending = sensor_trace_fetch();
+    }
+    else
+    {
+        uint64_t now_ms = sensor_trace_now_ms();
+
+        // Sample and hold: latest sample at or before the trace time
+        while (replay.have_pending && (replay.pending_at_ms <= now_ms || !replay.have_current))
+        {
+            replay.current = replay.pending;
+            replay.current_at_ms = replay.pending_at_ms;
+            replay.have_current = true;
+            replay.have_pending = sensor_trace_fetch();
+        }
+
+        // The last sample is held for one spacing, then the trace has ended
+        if (!replay.have_pending && now_ms >= replay.current_at_ms + replay.gap_ms)
+        {
+            xSemaphoreGive(mutex);
+            return ESP_ERR_NOT_FOUND;
+        }
+    }
+
+    *sample = replay.current;
+    xSemaphoreGive(mutex);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Set replay speed
+ */
+void sensor_trace_set_speed(uint32_t speed_pct)
+{
+    if (mutex == NULL)
+    {
+        replay.speed_pct = speed_pct;
+        return;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    // Rebase the clock so trace time continues from where it is
+    replay.base_trace_ms = (replay.speed_pct == 0) ? (replay.have_current ? replay.current_at_ms : 0)
+                                                   : sensor_trace_now_ms();
+    replay.base_us = esp_timer_get_time();
+    replay.speed_pct = speed_pct;
+
+    xSemaphoreGive(mutex);
+}
+
+/**
+ * @brief Enable or disable looping at the end of the trace
+ */
+void sensor_trace_set_loop(bool loop)
+{
+    replay.loop = loop;
+}
+
+/**
+ * @brief Restart replay from the first sample
+ */
+void sensor_trace_rewind(void)
+{
+    if (mutex == NULL)
+    {
+        return;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (replay.open)
+    {
+        if (replay.file)
+        {
+            rewind(replay.file);
+        }
+        else
+        {
+            replay.cursor = trace_embedded_start;
+        }
+
+        replay.base_trace_ms = 0;
+        replay.base_us = esp_timer_get_time();
+        replay.loop_offset_ms = 0;
+        replay.last_at_ms = 0;
+        replay.gap_ms = 0;
+        replay.fetched = 0;
+        replay.have_current = false;
+        replay.have_pending = sensor_trace_fetch();
+    }
+    xSemaphoreGive(mutex);
+}
+
+/**
+ * @brief Start recording samples to a trace file
+ */
+esp_err_t sensor_trace_record_start(const char *path, uint32_t max_samples)
+{
+    if (mutex == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (path == NULL || path[0] == '\0')
+    {
+        path = CONFIG_SENSOR_TRACE_RECORD_FILE;
+    }
+
+    esp_err_t ret = sensor_trace_mount(true);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    if (recorder.file != NULL)
+    {
+        xSemaphoreGive(mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    recorder.file = fopen(path, "w");
+    if (recorder.file == NULL)
+    {
+        xSemaphoreGive(mutex);
+        ESP_LOGE(TAG, "Cannot create %s", path);
+        return ESP_FAIL;
+    }
+
+    fputs(TRACE_HEADER, recorder.file);
+    recorder.count = 0;
+    recorder.max_samples = max_samples;
+
+    xSemaphoreGive(mutex);
+
+    ESP_LOGI(TAG, "Recording to %s (%lu samples)", path, (unsigned long)max_samples);
+    return ESP_OK;
+}
+
+/**
+ * @brief Append a sample to the running recording
+ */
+void sensor_trace_record_sample(float temperature, float humidity, uint16_t light)
+{
+    if (mutex == NULL || recorder.file == NULL)
+    {
+        return;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    if (recorder.file != NULL)
+    {
+        int64_t now_us = esp_timer_get_time();
+        if (recorder.count == 0)
+        {
+            recorder.start_us = now_us;
+        }
+
+        fprintf(recorder.file, "%lu,%.2f,%.2f,%u\n",
+                (unsigned long)((now_us - recorder.start_us) / 1000),
+                temperature, humidity, light);
+        recorder.count++;
+
+        if (recorder.max_samples > 0 && recorder.count >= recorder.max_samples)
+        {
+            fclose(recorder.file);
+            recorder.file = NULL;
+            ESP_LOGI(TAG, "Recording complete: %lu samples", (unsigned long)recorder.count);
+        }
+    }
+
+    xSemaphoreGive(mutex);
+}
+
+/**
+ * @brief Stop the running recording
+ */
+uint32_t sensor_trace_record_stop(void)
+{
+    if (mutex == NULL)
+    {
+        return 0;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (recorder.file != NULL)
+    {
+        fclose(recorder.file);
+        recorder.file = NULL;
+        ESP_LOGI(TAG, "Recording stopped: %lu samples", (unsigned long)recorder.count);
+    }
+    uint32_t count = recorder.count;
+    xSemaphoreGive(mutex);
+
+    return count;
+}
+
+/**
+ * @brief Check whether a recording is running
+ */
+bool sensor_trace_is_recording(void)
+{
+    return recorder.file != NULL;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Mount the trace storage partition if it is not mounted yet
+ */
+static esp_err_t sensor_trace_mount(bool format)
+{
+    if (esp_spiffs_mounted(CONFIG_SENSOR_TRACE_PARTITION))
+    {
+        return ESP_OK;
+    }
+
+    esp_vfs_spiffs_conf_t conf = {
+        .base_path = CONFIG_SENSOR_TRACE_BASE_PATH,
+        .partition_label = CONFIG_SENSOR_TRACE_PARTITION,
+        .max_files = 2,
+        .format_if_mount_failed = format,
+    };
+
+    esp_err_t ret = esp_vfs_spiffs_register(&conf);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Cannot mount %s: %s", CONFIG_SENSOR_TRACE_PARTITION, esp_err_to_name(ret));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Open a trace source and prime the first sample
+ */
+static esp_err_t sensor_trace_open_locked(const char *path)
+{
+    sensor_trace_close_locked();
+
+    if (path != NULL)
+    {
+        esp_err_t ret = sensor_trace_mount(false);
+        if (ret != ESP_OK)
+        {
+            return ret;
+        }
+
+        replay.file = fopen(path, "r");
+        if (replay.file == NULL)
+        {
+            return ESP_ERR_NOT_FOUND;
+        }
+    }
+    else
+    {
+        replay.cursor = trace_embedded_start;
+    }
+
+    replay.open = true;
+    replay.base_trace_ms = 0;
+    replay.base_us = esp_timer_get_time();
+    replay.loop_offset_ms = 0;
+    replay.last_at_ms = 0;
+    replay.gap_ms = 0;
+    replay.fetched = 0;
+    replay.have_current = false;
+    replay.have_pending = sensor_trace_fetch();
+
+    if (!replay.have_pending)
+    {
+        sensor_trace_close_locked();
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Close the open trace source
+ */
+static void sensor_trace_close_locked(void)
+{
+    if (replay.file != NULL)
+    {
+        fclose(replay.file);
+        replay.file = NULL;
+    }
+
+    replay.cursor = NULL;
+    replay.open = false;
+    replay.have_current = false;
+    replay.have_pending = false;
+}
+
+/**
+ * @brief Parse the next sample from the source
+ */
+static bool sensor_trace_parse_next(sensor_trace_sample_t *sample)
+{
+    char line[TRACE_LINE_MAX];
+
+    while (1)
+    {
+        if (replay.file != NULL)
+        {
+            if (fgets(line, sizeof(line), replay.file) == NULL)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (replay.cursor == NULL || *replay.cursor == '\0')
+            {
+                return false;
+            }
+
+            const char *eol = strchr(replay.cursor, '\n');
+            size_t len = eol ? (size_t)(eol - replay.cursor) : strlen(replay.cursor);
+            size_t copy = (len < sizeof(line) - 1) ? len : sizeof(line) - 1;
+            memcpy(line, replay.cursor, copy);
+            line[copy] = '\0';
+            replay.cursor += eol ? len + 1 : len;
+        }
+
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == '\0')
+        {
+            continue;
+        }
+
+        char *end;
+        sample->t_ms = (uint32_t)strtoul(line, &end, 10);
+        if (*end != ',')
+        {
+            ESP_LOGW(TAG, "Skipping malformed line: %s", line);
+            continue;
+        }
+        sample->temperature = strtof(end + 1, &end);
+        if (*end != ',')
+        {
+            ESP_LOGW(TAG, "Skipping malformed line: %s", line);
+            continue;
+        }
+        sample->humidity = strtof(end + 1, &end);
+        if (*end != ',')
+        {
+            ESP_LOGW(TAG, "Skipping malformed line: %s", line);
+            continue;
+        }
+        sample->light = (uint16_t)strtoul(end + 1, NULL, 10);
+
+        return true;
+    }
+}
+
+/**
+ * @brief Load the next sample into pending, wrapping when looping
+ */
+static bool sensor_trace_fetch(void)
+{
+    sensor_trace_sample_t sample;
+
+    if (!sensor_trace_parse_next(&sample))
+    {
+        if (!replay.loop || replay.fetched == 0)
+        {
+            return false;
+        }
+
+        // Next pass starts one sample spacing after the last sample
+        replay.loop_offset_ms = replay.last_at_ms + (replay.gap_ms ? replay.gap_ms : 1);
+        if (replay.file != NULL)
+        {
+            rewind(replay.file);
+        }
+        else
+        {
+            replay.cursor = trace_embedded_start;
+        }
+
+        if (!sensor_trace_parse_next(&sample))
+        {
+            return false;
+        }
+    }
+
+    uint64_t at_ms = replay.loop_offset_ms + sample.t_ms;
+    if (replay.fetched > 0 && at_ms > replay.last_at_ms)
+    {
+        replay.gap_ms = (uint32_t)(at_ms - replay.last_at_ms);
+    }
+
+    replay.last_at_ms = at_ms;
+    replay.fetched++;
+    replay.pending = sample;
+    replay.pending_at_ms = at_ms;
+
+    return true;
+}
+
+/**
+ * @brief Current trace time from the replay clock
+ */
+static uint64_t sensor_trace_now_ms(void)
+{
+    uint64_t elapsed_ms = (uint64_t)(esp_timer_get_time() - replay.base_us) / 1000;
+
+    return replay.base_trace_ms + elapsed_ms * replay.speed_pct / 100;
+}
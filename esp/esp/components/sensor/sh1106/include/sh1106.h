@@ -9,6 +9,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "esp_err.h"
 #include "driver/gpio.h"
@@ -19,6 +20,10 @@
 
 #define SH1106_I2C_ADDR_DEFAULT 0x3C
 
+#define SH1106_PAGE_COUNT 8                                       //!< Pages of 8 pixel rows
+#define SH1106_PAGE_WIDTH 128                                     //!< Visible columns per page
+#define SH1106_FRAME_SIZE (SH1106_PAGE_COUNT * SH1106_PAGE_WIDTH) //!< Bytes per frame
+
 /* Exported types ------------------------------------------------------------*/
 
 /**
@@ -26,8 +31,10 @@
  */
 typedef struct
 {
-    i2c_dev_t i2c_dev;       //!< I2C device descriptor
-    uint8_t buffer[1024];    //!< Display buffer (128x64 / 8)
+    i2c_dev_t i2c_dev;                     //!< I2C device descriptor
+    uint8_t frames[2][SH1106_FRAME_SIZE]; //!< Front/back frame buffer pair
+    uint8_t *buffer;                       //!< Back buffer, target of all drawing
+    uint8_t *front;                        //!< Front buffer, last presented frame
 } sh1106_t;
 
 /* Exported functions --------------------------------------------------------*/
@@ -54,6 +61,19 @@ esp_err_t sh1106_init_desc(sh1106_t *dev, uint8_t addr, i2c_port_t port, gpio_nu
  */
 esp_err_t sh1106_free_desc(sh1106_t *dev);
 
+/**
+ * @brief Select the highest reliable SCL clock
+ *
+ * Writes a pattern to a RAM column outside the visible area and reads it
+ * back at each clock step. The page flush is the largest bus consumer, so
+ * this device gains most from a faster clock.
+ *
+ * @param[in] dev Device descriptor, added to the bus
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sh1106_probe_speed(sh1106_t *dev);
+
 /**
  * @brief Initialize SH1106 display
  *
@@ -89,15 +109,72 @@ void sh1106_draw_horizontal_line(sh1106_t *dev, int y);
 void sh1106_clear_display(sh1106_t *dev);
 
 /**
- * @brief Send the display buffer to the hardware
+ * @brief Send the back buffer to the hardware synchronously
  *
  * @param[in] dev Device descriptor
  *
- * @note Call this after modifying the buffer to make changes visible
+ * @note Blocks for the whole frame; task_display presents frames through
+ *       sh1106_swap_buffers() and a flush task instead
  * @return ESP_OK on success, error code otherwise
  */
 esp_err_t sh1106_update_display(sh1106_t *dev);
 
+/**
+ * @brief Present the back buffer
+ *
+ * Swaps the buffer pair so the drawn frame becomes the front buffer, then
+ * seeds the new back buffer with it so partial redraws start from the
+ * latest frame. Nothing is sent to the hardware.
+ *
+ * @param[in] dev Device descriptor
+ *
+ * @note Not thread-safe: serialize with readers of the front buffer
+ */
+void sh1106_swap_buffers(sh1106_t *dev);
+
+/**
+ * @brief Send one page to the hardware
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] page Page index (0-7)
+ * @param[in] data SH1106_PAGE_WIDTH bytes of page data
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sh1106_write_page(sh1106_t *dev, uint8_t page, const uint8_t *data);
+
+/**
+ * @brief Set panel contrast
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] contrast Contrast level (0x00-0xFF, reset value 0x80)
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sh1106_set_contrast(sh1106_t *dev, uint8_t contrast);
+
+/**
+ * @brief Switch the panel on or off
+ *
+ * Display RAM is kept while the panel is off, so switching it back on
+ * shows the last written frame.
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] on true to switch the panel on
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sh1106_set_display_on(sh1106_t *dev, bool on);
+
+/**
+ * @brief Get the front buffer
+ *
+ * @param[in] dev Device descriptor
+ *
+ * @return Pointer to the last presented frame (SH1106_FRAME_SIZE bytes)
+ */
+const uint8_t *sh1106_get_front_buffer(sh1106_t *dev);
+
 /**
  * @brief Get direct access to the display buffer
  *
@@ -41,11 +41,15 @@
 /* I2C Configuration */
 #define I2C_FREQ_HZ I2C_MASTER_FREQ_HZ
 
+/* Rated 400 kHz; steps above are only used with Fast-mode Plus enabled and
+ * after the RAM readback in sh1106_verify() passes */
+#define SH1106_MAX_SCL_HZ 1000000
+
 /* SH1106 HARDWARE CONSTANTS */
 #define SH1106_WIDTH 128
 #define SH1106_HEIGHT 64
 #define SH1106_PIXELS_PER_BYTE 8
-#define SH1106_BUFFER_SIZE (SH1106_HEIGHT * SH1106_WIDTH / SH1106_PIXELS_PER_BYTE)
+#define SH1106_BUFFER_SIZE SH1106_FRAME_SIZE
 #define SH1106_I2C_ADDR_DEFAULT 0x3C
 
 /* SH1106 COMMANDS */
@@ -64,6 +68,10 @@
 #define SH1106_CMD_SET_ENTIRE_DISPLAY_OFF 0xA4
 #define SH1106_CMD_SET_DISPLAY_ON 0xAF
 #define SH1106_CMD_SET_DISPLAY_OFF 0xAE
+#define SH1106_CMD_SET_CONTRAST 0x81
+
+/* Column outside the visible 2..129 window, used by the speed probe */
+#define SH1106_PROBE_COLUMN 130
 
 /* Private variables ---------------------------------------------------------*/
 
@@ -112,6 +120,26 @@ static esp_err_t sh1106_write_data(sh1106_t *dev, const uint8_t *data, size_t le
  */
 static esp_err_t sh1106_init_display(sh1106_t *dev);
 
+/**
+ * @brief Set page and column address
+ *
+ * @param[in] dev Device descriptor
+ * @param[in] page Page (0-7)
+ * @param[in] column RAM column (0-131)
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sh1106_set_address(sh1106_t *dev, uint8_t page, uint8_t column);
+
+/**
+ * @brief Speed probe check: write a pattern to hidden RAM and read it back
+ *
+ * @param[in] arg Device descriptor (sh1106_t)
+ *
+ * @return ESP_OK if the readback matches
+ */
+static esp_err_t sh1106_verify(void *arg);
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -133,6 +161,10 @@ esp_err_t sh1106_init_desc(sh1106_t *dev, uint8_t addr, i2c_port_t port, gpio_nu
     dev->i2c_dev.sda_io_num = sda_gpio;
     dev->i2c_dev.scl_io_num = scl_gpio;
     dev->i2c_dev.clk_speed = I2C_FREQ_HZ;
+    dev->i2c_dev.max_clk_speed = SH1106_MAX_SCL_HZ;
+
+    dev->buffer = dev->frames[0];
+    dev->front = dev->frames[1];
 
     esp_err_t res = i2c_dev_create_mutex(&dev->i2c_dev);
     if (res == ESP_OK)
@@ -164,6 +196,16 @@ esp_err_t sh1106_free_desc(sh1106_t *dev)
     return ret;
 }
 
+/**
+ * @brief Select the highest reliable SCL clock
+ */
+esp_err_t sh1106_probe_speed(sh1106_t *dev)
+{
+    CHECK_ARG(dev);
+
+    return i2c_dev_probe_speed(&dev->i2c_dev, sh1106_verify, dev);
+}
+
 /**
  * @brief Initialize SH1106 display
  */
@@ -173,8 +215,8 @@ esp_err_t sh1106_init(sh1106_t *dev)
 
     ESP_LOGI(TAG, "Initializing SH1106 display hardware");
 
-    // Clear internal buffer
-    memset(dev->buffer, 0, SH1106_BUFFER_SIZE);
+    // Clear both frame buffers
+    memset(dev->frames, 0, sizeof(dev->frames));
 
     // Initialize display hardware
     esp_err_t res = sh1106_init_display(dev);
@@ -232,22 +274,55 @@ esp_err_t sh1106_update_display(sh1106_t *dev)
     CHECK_ARG(dev);
 
     // SH1106 has 8 pages (rows of 8 pixels each)
-    for (int page = 0; page < 8; page++)
+    for (int page = 0; page < SH1106_PAGE_COUNT; page++)
     {
-        // Set page address
-        CHECK(sh1106_write_cmd(dev, SH1106_CMD_SET_PAGE_ADDR | page));
-
-        // Set column address (SH1106 has 132 columns, we use 128, start at column 2)
-        CHECK(sh1106_write_cmd(dev, SH1106_CMD_SET_COLUMN_ADDR_LOW | 0x02));
-        CHECK(sh1106_write_cmd(dev, SH1106_CMD_SET_COLUMN_ADDR_HIGH | 0x00));
-
-        // Send data for this page
-        CHECK(sh1106_write_data(dev, &dev->buffer[page * SH1106_WIDTH], SH1106_WIDTH));
+        CHECK(sh1106_write_page(dev, page, &dev->buffer[page * SH1106_WIDTH]));
     }
 
     return ESP_OK;
 }
 
+void sh1106_swap_buffers(sh1106_t *dev)
+{
+    if (!dev)
+        return;
+
+    uint8_t *drawn = dev->buffer;
+    dev->buffer = dev->front;
+    dev->front = drawn;
+
+    memcpy(dev->buffer, dev->front, SH1106_BUFFER_SIZE);
+}
+
+esp_err_t sh1106_write_page(sh1106_t *dev, uint8_t page, const uint8_t *data)
+{
+    CHECK_ARG(dev && data && page < SH1106_PAGE_COUNT);
+
+    // SH1106 has 132 columns, we use 128, starting at column 2
+    CHECK(sh1106_set_address(dev, page, 2));
+
+    return sh1106_write_data(dev, data, SH1106_WIDTH);
+}
+
+esp_err_t sh1106_set_contrast(sh1106_t *dev, uint8_t contrast)
+{
+    CHECK_ARG(dev);
+
+    return sh1106_write_cmd_param(dev, SH1106_CMD_SET_CONTRAST, contrast);
+}
+
+esp_err_t sh1106_set_display_on(sh1106_t *dev, bool on)
+{
+    CHECK_ARG(dev);
+
+    return sh1106_write_cmd(dev, on ? SH1106_CMD_SET_DISPLAY_ON : SH1106_CMD_SET_DISPLAY_OFF);
+}
+
+const uint8_t *sh1106_get_front_buffer(sh1106_t *dev)
+{
+    return dev ? dev->front : NULL;
+}
+
 uint8_t *sh1106_get_buffer(sh1106_t *dev)
 {
     return dev ? dev->buffer : NULL;
@@ -286,17 +361,9 @@ static esp_err_t sh1106_write_cmd_param(sh1106_t *dev, uint8_t cmd, uint8_t para
  */
 static esp_err_t sh1106_write_data(sh1106_t *dev, const uint8_t *data, size_t len)
 {
-    // Create buffer with data mode prefix (0x40 = data mode, Co=0, D/C=1)
-    uint8_t *buffer = malloc(len + 1);
-    if (!buffer)
-        return ESP_ERR_NO_MEM;
-
-    buffer[0] = 0x40; // Data mode
-    memcpy(buffer + 1, data, len);
-
-    esp_err_t ret = i2c_dev_write(&dev->i2c_dev, buffer, len + 1);
-    free(buffer);
-    return ret;
+    // Data mode prefix (0x40 = data mode, Co=0, D/C=1) goes out in the
+    // register slot, so page data is sent straight from the frame buffer
+    return i2c_dev_write_reg(&dev->i2c_dev, 0x40, data, len);
 }
 
 /**
@@ -341,3 +408,41 @@ static esp_err_t sh1106_init_display(sh1106_t *dev)
     ESP_LOGI(TAG, "SH1106 hardware initialized successfully");
     return ESP_OK;
 }
+
+/**
+ * @brief Set page and column address
+ */
+static esp_err_t sh1106_set_address(sh1106_t *dev, uint8_t page, uint8_t column)
+{
+    CHECK(sh1106_write_cmd(dev, SH1106_CMD_SET_PAGE_ADDR | page));
+    CHECK(sh1106_write_cmd(dev, SH1106_CMD_SET_COLUMN_ADDR_LOW | (column & 0x0F)));
+    return sh1106_write_cmd(dev, SH1106_CMD_SET_COLUMN_ADDR_HIGH | (column >> 4));
+}
+
+/**
+ * @brief Speed probe check: write a pattern to hidden RAM and read it back
+ */
+static esp_err_t sh1106_verify(void *arg)
+{
+    static uint8_t seed = 0;
+
+    sh1106_t *dev = (sh1106_t *)arg;
+    uint8_t pattern[2] = {(uint8_t)(0xA5 ^ seed), (uint8_t)(0x5A ^ seed)};
+    uint8_t readback[3];
+
+    seed++;
+
+    CHECK(sh1106_set_address(dev, 0, SH1106_PROBE_COLUMN));
+    CHECK(sh1106_write_data(dev, pattern, sizeof(pattern)));
+
+    // First byte after a column change is a dummy read
+    CHECK(sh1106_set_address(dev, 0, SH1106_PROBE_COLUMN));
+    CHECK(i2c_dev_read_reg(&dev->i2c_dev, 0x40, readback, sizeof(readback)));
+
+    if (readback[1] != pattern[0] || readback[2] != pattern[1])
+    {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    return ESP_OK;
+}
@@ -86,6 +86,18 @@ esp_err_t sht3x_init_desc(sht3x_t *dev, uint8_t addr, i2c_port_t port, gpio_num_
  */
 esp_err_t sht3x_free_desc(sht3x_t *dev);
 
+/**
+ * @brief Select the highest reliable SCL clock
+ *
+ * Probes up to 1 MHz (Fast-mode Plus), reading the CRC-protected status
+ * register at each step.
+ *
+ * @param[in] dev Device descriptor, added to the bus
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t sht3x_probe_speed(sht3x_t *dev);
+
 /**
  * @brief Initialize sensor
  *
@@ -180,6 +192,18 @@ esp_err_t sht3x_get_raw_data(sht3x_t *dev, sht3x_raw_data_t raw_data);
  */
 esp_err_t sht3x_compute_values(sht3x_raw_data_t raw_data, float *temperature, float *humidity);
 
+/**
+ * @brief Compute the CRC8 the sensor appends to every data word
+ *
+ * Polynomial 0x31, initial value 0xFF.
+ *
+ * @param[in] data Data bytes
+ * @param[in] len Number of bytes
+ *
+ * @return CRC8 checksum
+ */
+uint8_t sht3x_crc8(const uint8_t *data, int len);
+
 /**
  * @brief Get measurement results in form of sensor values
  *
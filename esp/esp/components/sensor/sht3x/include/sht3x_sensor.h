@@ -0,0 +1,21 @@
+/**
+ * @file sht3x_sensor.h
+ *
+ * @brief SHT3x Sensor Driver
+ */
+
+#ifndef SHT3X_SENSOR_H
+#define SHT3X_SENSOR_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sensor_driver.h"
+
+/* Exported variables --------------------------------------------------------*/
+
+/**
+ * @brief SHT3x temperature and humidity, single shot at high repeatability
+ */
+extern const sensor_driver_t sht3x_sensor_driver;
+
+#endif /* SHT3X_SENSOR_H */
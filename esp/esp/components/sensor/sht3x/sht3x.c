@@ -59,6 +59,7 @@
 
 // I2C configuration
 #define I2C_FREQ_HZ I2C_MASTER_FREQ_HZ
+#define SHT3X_MAX_SCL_HZ 1000000 //!< Fast-mode Plus, datasheet limit
 
 /* Private variables  ---------------------------------------------------------*/
 
@@ -97,16 +98,6 @@ static const uint8_t SHT3X_MEAS_DURATION_TICKS[3] = {
  */
 static inline uint16_t shuffle(uint16_t val);
 
-/**
- * @brief Compute CRC8 checksum for data array
- *
- * @param[in] data Data array
- * @param[in] len Length of data array
- *
- * @return Computed CRC8 checksum
- */
-static uint8_t crc8(uint8_t data[], int len);
-
 /**
  * @brief Send command to SHT3x without taking mutex
  *
@@ -157,6 +148,15 @@ static inline bool is_measuring(sht3x_t *dev);
  */
 static esp_err_t get_raw_data_nolock(sht3x_t *dev, sht3x_raw_data_t raw_data);
 
+/**
+ * @brief Speed probe check: read the status register and verify its CRC
+ *
+ * @param[in] arg Device descriptor (sht3x_t)
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_CRC on a corrupted read
+ */
+static esp_err_t sht3x_verify(void *arg);
+
 /* External functions --------------------------------------------------------*/
 
 /**
@@ -179,6 +179,7 @@ esp_err_t sht3x_init_desc(sht3x_t *dev, uint8_t addr, i2c_port_t port, gpio_num_
     dev->i2c_dev.sda_io_num = sda_gpio;
     dev->i2c_dev.scl_io_num = scl_gpio;
     dev->i2c_dev.clk_speed = I2C_FREQ_HZ;
+    dev->i2c_dev.max_clk_speed = SHT3X_MAX_SCL_HZ;
 
     esp_err_t res = i2c_dev_create_mutex(&dev->i2c_dev);
     if (res == ESP_OK)
@@ -210,6 +211,16 @@ esp_err_t sht3x_free_desc(sht3x_t *dev)
     return ret;
 }
 
+/**
+ * @brief Select the highest reliable SCL clock
+ */
+esp_err_t sht3x_probe_speed(sht3x_t *dev)
+{
+    CHECK_ARG(dev);
+
+    return i2c_dev_probe_speed(&dev->i2c_dev, sht3x_verify, dev);
+}
+
 /**
  * @brief Initialize SHT3x sensor
  */
@@ -333,7 +344,7 @@ esp_err_t sht3x_start_measurement(sht3x_t *dev, sht3x_mode_t mode, sht3x_repeat_
 
     const char *mode_str[] = {"single-shot", "0.5mps", "1mps", "2mps", "4mps", "10mps"};
     const char *repeat_str[] = {"high", "medium", "low"};
-    ESP_LOGI(TAG, "Started %s measurement (repeatability: %s, port=%d, addr=0x%02x)",
+    ESP_LOGD(TAG, "Started %s measurement (repeatability: %s, port=%d, addr=0x%02x)",
              mode_str[mode], repeat_str[repeat], dev->i2c_dev.port, dev->i2c_dev.addr);
 
     return ESP_OK;
@@ -381,14 +392,10 @@ esp_err_t sht3x_get_results(sht3x_t *dev, float *temperature, float *humidity)
     return sht3x_compute_values(raw_data, temperature, humidity);
 }
 
-/* Private functions --------------------------------------------------------*/
-
-static inline uint16_t shuffle(uint16_t val)
-{
-    return (val >> 8) | (val << 8);
-}
-
-static uint8_t crc8(uint8_t data[], int len)
+/**
+ * @brief Compute the SHT3x CRC8 of a data word
+ */
+uint8_t sht3x_crc8(const uint8_t *data, int len)
 {
     // initialization value
     uint8_t crc = 0xff;
@@ -407,6 +414,13 @@ static uint8_t crc8(uint8_t data[], int len)
     return crc;
 }
 
+/* Private functions --------------------------------------------------------*/
+
+static inline uint16_t shuffle(uint16_t val)
+{
+    return (val >> 8) | (val << 8);
+}
+
 static esp_err_t send_cmd_nolock(sht3x_t *dev, uint16_t cmd)
 {
     cmd = shuffle(cmd);
@@ -472,18 +486,32 @@ static esp_err_t get_raw_data_nolock(sht3x_t *dev, sht3x_raw_data_t raw_data)
         dev->meas_started = false;
 
     // check temperature crc
-    if (crc8(raw_data, 2) != raw_data[2])
+    if (sht3x_crc8(raw_data, 2) != raw_data[2])
     {
         ESP_LOGE(TAG, "CRC check for temperature data failed");
+        i2c_dev_report_error(&dev->i2c_dev, ESP_ERR_INVALID_CRC);
         return ESP_ERR_INVALID_CRC;
     }
 
     // check humidity crc
-    if (crc8(raw_data + 3, 2) != raw_data[5])
+    if (sht3x_crc8(raw_data + 3, 2) != raw_data[5])
     {
         ESP_LOGE(TAG, "CRC check for humidity data failed");
+        i2c_dev_report_error(&dev->i2c_dev, ESP_ERR_INVALID_CRC);
         return ESP_ERR_INVALID_CRC;
     }
 
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+static esp_err_t sht3x_verify(void *arg)
+{
+    sht3x_t *dev = (sht3x_t *)arg;
+    uint8_t status[3];
+
+    uint16_t cmd = shuffle(SHT3X_STATUS_CMD);
+    CHECK(i2c_dev_write(&dev->i2c_dev, &cmd, 2));
+    CHECK(i2c_dev_read(&dev->i2c_dev, status, sizeof(status)));
+
+    return sht3x_crc8(status, 2) == status[2] ? ESP_OK : ESP_ERR_INVALID_CRC;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file sht3x_sensor.c
+ *
+ * @brief SHT3x Sensor Driver Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sht3x_sensor.h"
+#include "sht3x.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define SHT3X_SENSOR_CONVERSION_MS 15 //!< Single shot, high repeatability
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "SHT3X_SENSOR";
+
+static sht3x_t sht3x_dev;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Add the sensor to the bus and verify it by clearing its status
+ *
+ * @param[in] port I2C port
+ * @param[in] sda SDA pin
+ * @param[in] scl SCL pin
+ *
+ * @return ESP_OK if the sensor answered
+ */
+static esp_err_t sht3x_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl);
+
+/**
+ * @brief Free the device descriptor
+ */
+static void sht3x_sensor_deinit(void);
+
+/**
+ * @brief Start a single shot measurement
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sht3x_sensor_start(void);
+
+/**
+ * @brief Read the CRC-checked measurement
+ *
+ * @param[out] raw SHT3X_RAW_DATA_SIZE bytes
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sht3x_sensor_fetch(uint8_t *raw);
+
+/**
+ * @brief Convert the measurement to temperature and humidity
+ *
+ * @param[in] raw Result of sht3x_sensor_fetch()
+ * @param[in,out] data Readings
+ *
+ * @return ESP_OK on success, error code otherwise
+ */
+static esp_err_t sht3x_sensor_decode(const uint8_t *raw, sensor_data_t *data);
+
+/* Exported variables --------------------------------------------------------*/
+
+const sensor_driver_t sht3x_sensor_driver = {
+    .name = "sht3x",
+    .channels = SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY,
+    .conversion_ms = SHT3X_SENSOR_CONVERSION_MS,
+    .init = sht3x_sensor_init,
+    .deinit = sht3x_sensor_deinit,
+    .start = sht3x_sensor_start,
+    .fetch = sht3x_sensor_fetch,
+    .decode = sht3x_sensor_decode,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Add the sensor to the bus and verify it by clearing its status
+ */
+static esp_err_t sht3x_sensor_init(i2c_port_t port, gpio_num_t sda, gpio_num_t scl)
+{
+    esp_err_t ret = sht3x_init_desc(&sht3x_dev, SHT3X_I2C_ADDR_GND, port, sda, scl);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    ret = i2c_dev_init(&sht3x_dev.i2c_dev);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Device add failed: %s", esp_err_to_name(ret));
+        sht3x_free_desc(&sht3x_dev);
+        return ret;
+    }
+
+    ret = sht3x_init(&sht3x_dev);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Hardware verification failed: %s", esp_err_to_name(ret));
+        sht3x_free_desc(&sht3x_dev);
+        return ret;
+    }
+
+    sht3x_probe_speed(&sht3x_dev);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Free the device descriptor
+ */
+static void sht3x_sensor_deinit(void)
+{
+    sht3x_free_desc(&sht3x_dev);
+}
+
+/**
+ * @brief Start a single shot measurement
+ */
+static esp_err_t sht3x_sensor_start(void)
+{
+    return sht3x_start_measurement(&sht3x_dev, SHT3X_SINGLE_SHOT, SHT3X_HIGH);
+}
+
+/**
+ * @brief Read the CRC-checked measurement
+ */
+static esp_err_t sht3x_sensor_fetch(uint8_t *raw)
+{
+    return sht3x_get_raw_data(&sht3x_dev, raw);
+}
+
+/**
+ * @brief Convert the measurement to temperature and humidity
+ */
+static esp_err_t sht3x_sensor_decode(const uint8_t *raw, sensor_data_t *data)
+{
+    sht3x_raw_data_t raw_data;
+
+    memcpy(raw_data, raw, sizeof(raw_data));
+
+    return sht3x_compute_values(raw_data, &data->temperature, &data->humidity);
+}
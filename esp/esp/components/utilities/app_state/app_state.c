@@ -0,0 +1,274 @@
+/**
+ * @file app_state.c
+ *
+ * @brief Application State Store Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "app_state.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include <stdatomic.h>
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Subscriber table entry
+ */
+typedef struct
+{
+    uint32_t mask;           //!< APP_STATE_* bits of interest
+    app_state_cb_t callback; //!< Change notification
+    void *arg;               //!< Callback argument
+} app_state_subscriber_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "APP_STATE";
+
+// Boolean fields as APP_STATE_* bits in one word
+static _Atomic uint32_t state_flags = 0;
+static _Atomic uint32_t state_interval_ms = 0;
+
+// Sequence counter: odd while a write is in progress, version = seq / 2
+static _Atomic uint32_t state_seq = 0;
+
+// Serializes writers; readers never take it
+static portMUX_TYPE state_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static app_state_subscriber_t subscribers[APP_STATE_MAX_SUBSCRIBERS];
+static _Atomic uint32_t subscriber_count = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Store a field value and bump the sequence if it changed
+ *
+ * @param[in] field Field to write
+ * @param[in] value New value
+ *
+ * @return true if the value changed
+ *
+ * @note Caller holds state_lock
+ */
+static bool app_state_store_locked(_Atomic uint32_t *field, uint32_t value);
+
+/**
+ * @brief Set or clear a boolean field
+ *
+ * @param[in] bit APP_STATE_* bit of the field
+ * @param[in] value New value
+ */
+static void app_state_set_flag(uint32_t bit, bool value);
+
+/**
+ * @brief Call the subscribers of the changed fields
+ *
+ * @param[in] changed Mask of changed APP_STATE_* bits
+ */
+static void app_state_notify(uint32_t changed);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Subscribe to changes of some fields
+ */
+esp_err_t app_state_subscribe(uint32_t mask, app_state_cb_t callback, void *arg)
+{
+    if (callback == NULL || (mask & APP_STATE_ALL) == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&state_lock);
+    uint32_t count = atomic_load_explicit(&subscriber_count, memory_order_relaxed);
+    if (count >= APP_STATE_MAX_SUBSCRIBERS)
+    {
+        portEXIT_CRITICAL(&state_lock);
+        ESP_LOGE(TAG, "Subscriber table full");
+        return ESP_ERR_NO_MEM;
+    }
+
+    subscribers[count].mask = mask;
+    subscribers[count].callback = callback;
+    subscribers[count].arg = arg;
+
+    // Publish the entry after it is complete; notify() reads without the lock
+    atomic_store_explicit(&subscriber_count, count + 1, memory_order_release);
+    portEXIT_CRITICAL(&state_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Get a consistent view of all fields
+ */
+void app_state_get_snapshot(app_state_snapshot_t *snapshot)
+{
+    uint32_t seq_begin, seq_end, flags, interval_ms;
+
+    do
+    {
+        seq_begin = atomic_load_explicit(&state_seq, memory_order_acquire);
+        flags = atomic_load_explicit(&state_flags, memory_order_relaxed);
+        interval_ms = atomic_load_explicit(&state_interval_ms, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        seq_end = atomic_load_explicit(&state_seq, memory_order_relaxed);
+    } while ((seq_begin & 1U) != 0 || seq_begin != seq_end);
+
+    snapshot->mode_on = (flags & APP_STATE_MODE_ON) != 0;
+    snapshot->wifi_connected = (flags & APP_STATE_WIFI_CONNECTED) != 0;
+    snapshot->wifi_connecting = (flags & APP_STATE_WIFI_CONNECTING) != 0;
+    snapshot->mqtt_connected = (flags & APP_STATE_MQTT_CONNECTED) != 0;
+    snapshot->interval_ms = interval_ms;
+    snapshot->version = seq_begin / 2;
+}
+
+/**
+ * @brief Get the current version
+ */
+uint32_t app_state_get_version(void)
+{
+    return atomic_load_explicit(&state_seq, memory_order_acquire) / 2;
+}
+
+/**
+ * @brief Set device mode
+ */
+void app_state_set_mode_on(bool on)
+{
+    app_state_set_flag(APP_STATE_MODE_ON, on);
+}
+
+/**
+ * @brief Check device mode
+ */
+bool app_state_is_mode_on(void)
+{
+    return (atomic_load_explicit(&state_flags, memory_order_acquire) & APP_STATE_MODE_ON) != 0;
+}
+
+/**
+ * @brief Set WiFi station connection state
+ */
+void app_state_set_wifi_connected(bool connected)
+{
+    app_state_set_flag(APP_STATE_WIFI_CONNECTED, connected);
+}
+
+/**
+ * @brief Check WiFi station connection state
+ */
+bool app_state_is_wifi_connected(void)
+{
+    return (atomic_load_explicit(&state_flags, memory_order_acquire) & APP_STATE_WIFI_CONNECTED) != 0;
+}
+
+/**
+ * @brief Set WiFi connection attempt state
+ */
+void app_state_set_wifi_connecting(bool connecting)
+{
+    app_state_set_flag(APP_STATE_WIFI_CONNECTING, connecting);
+}
+
+/**
+ * @brief Check WiFi connection attempt state
+ */
+bool app_state_is_wifi_connecting(void)
+{
+    return (atomic_load_explicit(&state_flags, memory_order_acquire) & APP_STATE_WIFI_CONNECTING) != 0;
+}
+
+/**
+ * @brief Set MQTT connection state
+ */
+void app_state_set_mqtt_connected(bool connected)
+{
+    app_state_set_flag(APP_STATE_MQTT_CONNECTED, connected);
+}
+
+/**
+ * @brief Check MQTT connection state
+ */
+bool app_state_is_mqtt_connected(void)
+{
+    return (atomic_load_explicit(&state_flags, memory_order_acquire) & APP_STATE_MQTT_CONNECTED) != 0;
+}
+
+/**
+ * @brief Set data publish interval
+ */
+void app_state_set_interval_ms(uint32_t interval_ms)
+{
+    portENTER_CRITICAL(&state_lock);
+    bool changed = app_state_store_locked(&state_interval_ms, interval_ms);
+    portEXIT_CRITICAL(&state_lock);
+
+    if (changed)
+    {
+        app_state_notify(APP_STATE_INTERVAL);
+    }
+}
+
+/**
+ * @brief Get data publish interval
+ */
+uint32_t app_state_get_interval_ms(void)
+{
+    return atomic_load_explicit(&state_interval_ms, memory_order_acquire);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Store a field value and bump the sequence if it changed
+ */
+static bool app_state_store_locked(_Atomic uint32_t *field, uint32_t value)
+{
+    if (atomic_load_explicit(field, memory_order_relaxed) == value)
+    {
+        return false;
+    }
+
+    // Seqlock write: odd sequence, data, even sequence
+    atomic_fetch_add_explicit(&state_seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(field, value, memory_order_relaxed);
+    atomic_fetch_add_explicit(&state_seq, 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Set or clear a boolean field
+ */
+static void app_state_set_flag(uint32_t bit, bool value)
+{
+    portENTER_CRITICAL(&state_lock);
+    uint32_t flags = atomic_load_explicit(&state_flags, memory_order_relaxed);
+    bool changed = app_state_store_locked(&state_flags, value ? (flags | bit) : (flags & ~bit));
+    portEXIT_CRITICAL(&state_lock);
+
+    if (changed)
+    {
+        app_state_notify(bit);
+    }
+}
+
+/**
+ * @brief Call the subscribers of the changed fields
+ */
+static void app_state_notify(uint32_t changed)
+{
+    uint32_t count = atomic_load_explicit(&subscriber_count, memory_order_acquire);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (subscribers[i].mask & changed)
+        {
+            subscribers[i].callback(changed, subscribers[i].arg);
+        }
+    }
+}
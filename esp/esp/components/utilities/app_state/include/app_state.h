@@ -0,0 +1,162 @@
+/**
+ * @file app_state.h
+ *
+ * @brief Application State Store API
+ *
+ * Typed store for the device-wide state that used to live in global flags
+ * (mode, WiFi, MQTT, publish interval). Fields are atomics readable from
+ * any task without locks; writers bump a version counter and notify
+ * subscribers of the fields that actually changed, so consumers wake on
+ * change instead of polling.
+ */
+
+#ifndef APP_STATE_H
+#define APP_STATE_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define APP_STATE_MAX_SUBSCRIBERS 8 //!< Subscriber table size
+
+/**
+ * @brief Change mask bits passed to subscribers
+ */
+#define APP_STATE_MODE_ON         (1U << 0) //!< Device mode ON/OFF
+#define APP_STATE_WIFI_CONNECTED  (1U << 1) //!< Station has an IP
+#define APP_STATE_WIFI_CONNECTING (1U << 2) //!< Connection attempt in progress
+#define APP_STATE_MQTT_CONNECTED  (1U << 3) //!< Broker session up
+#define APP_STATE_INTERVAL        (1U << 4) //!< Data publish interval
+#define APP_STATE_ALL             0x1FU     //!< Every field
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Consistent view of all fields
+ */
+typedef struct
+{
+    bool mode_on;         //!< Device mode is ON
+    bool wifi_connected;  //!< Station has an IP
+    bool wifi_connecting; //!< Connection attempt in progress
+    bool mqtt_connected;  //!< Broker session up
+    uint32_t interval_ms; //!< Data publish interval in milliseconds
+    uint32_t version;     //!< Incremented on every change
+} app_state_snapshot_t;
+
+/**
+ * @brief Change notification
+ *
+ * Runs in the context of the task that changed the state (WiFi event task,
+ * MQTT task, executor). Keep it short: post work or notify a task.
+ *
+ * @param changed Mask of APP_STATE_* bits that changed
+ * @param arg Argument given at subscription
+ */
+typedef void (*app_state_cb_t)(uint32_t changed, void *arg);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Subscribe to changes of some fields
+ *
+ * @param[in] mask APP_STATE_* bits of interest
+ * @param[in] callback Change notification
+ * @param[in] arg Callback argument
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if callback is NULL or mask is empty
+ *      - ESP_ERR_NO_MEM if the subscriber table is full
+ */
+esp_err_t app_state_subscribe(uint32_t mask, app_state_cb_t callback, void *arg);
+
+/**
+ * @brief Get a consistent view of all fields
+ *
+ * @param[out] snapshot Filled with the fields of one version
+ */
+void app_state_get_snapshot(app_state_snapshot_t *snapshot);
+
+/**
+ * @brief Get the current version
+ *
+ * @return Version counter, incremented on every change
+ */
+uint32_t app_state_get_version(void);
+
+/**
+ * @brief Set device mode
+ *
+ * @param[in] on true when mode is ON
+ */
+void app_state_set_mode_on(bool on);
+
+/**
+ * @brief Check device mode
+ *
+ * @return true when mode is ON
+ */
+bool app_state_is_mode_on(void);
+
+/**
+ * @brief Set WiFi station connection state
+ *
+ * @param[in] connected true once an IP is assigned
+ */
+void app_state_set_wifi_connected(bool connected);
+
+/**
+ * @brief Check WiFi station connection state
+ *
+ * @return true when the station has an IP
+ */
+bool app_state_is_wifi_connected(void);
+
+/**
+ * @brief Set WiFi connection attempt state
+ *
+ * @param[in] connecting true while connecting
+ */
+void app_state_set_wifi_connecting(bool connecting);
+
+/**
+ * @brief Check WiFi connection attempt state
+ *
+ * @return true while connecting
+ */
+bool app_state_is_wifi_connecting(void);
+
+/**
+ * @brief Set MQTT connection state
+ *
+ * @param[in] connected true while the broker session is up
+ */
+void app_state_set_mqtt_connected(bool connected);
+
+/**
+ * @brief Check MQTT connection state
+ *
+ * @return true while the broker session is up
+ */
+bool app_state_is_mqtt_connected(void);
+
+/**
+ * @brief Set data publish interval
+ *
+ * @param[in] interval_ms Interval in milliseconds
+ */
+void app_state_set_interval_ms(uint32_t interval_ms);
+
+/**
+ * @brief Get data publish interval
+ *
+ * @return Interval in milliseconds
+ */
+uint32_t app_state_get_interval_ms(void);
+
+#endif /* APP_STATE_H */
@@ -0,0 +1,357 @@
+/**
+ * @file heap_account.c
+ *
+ * @brief Per-module Heap Accounting Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "heap_account.h"
+#include "task_registry.h"
+#include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "esp_log.h"
+#if CONFIG_HEAP_ACCOUNT_CONSOLE
+#include "esp_console.h"
+#endif
+#include <stdio.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Counters of one module
+ */
+typedef struct
+{
+    uint32_t live_bytes; //!< Bytes currently allocated
+    uint32_t peak_bytes; //!< Highest live_bytes
+    uint32_t allocs;     //!< Successful allocations
+    uint32_t frees;      //!< Frees
+} heap_account_counter_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "HEAP_ACCOUNT";
+
+static const char *module_names[HEAP_ACCOUNT_MAX] = {
+    [HEAP_ACCOUNT_JSON] = "json",
+    [HEAP_ACCOUNT_MQTT] = "mqtt",
+    [HEAP_ACCOUNT_OTA] = "ota",
+};
+
+static portMUX_TYPE account_lock = portMUX_INITIALIZER_UNLOCKED;
+static heap_account_counter_t counters[HEAP_ACCOUNT_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+/**
+ * @brief Count an allocation
+ *
+ * @param[in] module Module tag
+ * @param[in] ptr Allocated block
+ */
+static void heap_account_add(heap_account_module_t module, void *ptr);
+
+/**
+ * @brief cJSON allocation hook
+ *
+ * @param[in] size Bytes
+ *
+ * @return Block, NULL on failure
+ */
+static void *heap_account_json_malloc(size_t size);
+
+/**
+ * @brief cJSON free hook
+ *
+ * @param[in] ptr Block
+ */
+static void heap_account_json_free(void *ptr);
+#endif
+
+#if CONFIG_HEAP_ACCOUNT_CONSOLE
+/**
+ * @brief `heap [reset]` console command
+ *
+ * @param[in] argc Argument count
+ * @param[in] argv Arguments
+ *
+ * @return 0 on success, 1 on bad arguments
+ */
+static int heap_account_console_cmd(int argc, char **argv);
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Install the cJSON hooks
+ */
+void heap_account_init(void)
+{
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+    cJSON_Hooks hooks = {
+        .malloc_fn = heap_account_json_malloc,
+        .free_fn = heap_account_json_free,
+    };
+    cJSON_InitHooks(&hooks);
+
+    ESP_LOGI(TAG, "Heap accounting enabled");
+#endif
+}
+
+/**
+ * @brief Read system heap figures and module counters
+ */
+esp_err_t heap_account_get_report(heap_account_report_t *report)
+{
+    if (report == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    report->free_bytes = esp_get_free_heap_size();
+    report->min_free_bytes = esp_get_minimum_free_heap_size();
+    report->largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+
+    portENTER_CRITICAL(&account_lock);
+    for (int i = 0; i < HEAP_ACCOUNT_MAX; i++)
+    {
+        report->modules[i].name = module_names[i];
+        report->modules[i].live_bytes = counters[i].live_bytes;
+        report->modules[i].peak_bytes = counters[i].peak_bytes;
+        report->modules[i].allocs = counters[i].allocs;
+        report->modules[i].frees = counters[i].frees;
+    }
+    portEXIT_CRITICAL(&account_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Restart peak tracking from the current live bytes
+ */
+void heap_account_reset_peaks(void)
+{
+    portENTER_CRITICAL(&account_lock);
+    for (int i = 0; i < HEAP_ACCOUNT_MAX; i++)
+    {
+        counters[i].peak_bytes = counters[i].live_bytes;
+    }
+    portEXIT_CRITICAL(&account_lock);
+}
+
+/**
+ * @brief Log the report
+ */
+void heap_account_log(void)
+{
+    heap_account_report_t report;
+
+    heap_account_get_report(&report);
+
+    ESP_LOGI(TAG, "free=%lu min_free=%lu largest=%lu",
+             (unsigned long)report.free_bytes, (unsigned long)report.min_free_bytes,
+             (unsigned long)report.largest_block);
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+    for (int i = 0; i < HEAP_ACCOUNT_MAX; i++)
+    {
+        const heap_account_stats_t *m = &report.modules[i];
+        ESP_LOGI(TAG, "%s: live=%lu peak=%lu allocs=%lu frees=%lu", m->name,
+                 (unsigned long)m->live_bytes, (unsigned long)m->peak_bytes,
+                 (unsigned long)m->allocs, (unsigned long)m->frees);
+    }
+#endif
+}
+
+/**
+ * @brief Start a UART console with the `heap` command
+ */
+esp_err_t heap_account_console_start(void)
+{
+#if CONFIG_HEAP_ACCOUNT_CONSOLE
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+
+    // The REPL task is created by esp_console, placed like the other background tasks
+    repl_config.prompt = "smarthome>";
+    repl_config.task_priority = TASK_PRIO_BACKGROUND;
+    repl_config.task_core_id = TASK_CORE_NETWORK;
+
+    esp_err_t ret = esp_console_new_repl_uart(&uart_config, &repl_config, &repl);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Console init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    const esp_console_cmd_t cmd = {
+        .command = "heap",
+        .help = "Print free heap and per-module allocations, 'heap reset' restarts peaks",
+        .hint = "[reset]",
+        .func = heap_account_console_cmd,
+    };
+
+    esp_console_register_help_command();
+    ret = esp_console_cmd_register(&cmd);
+    if (ret == ESP_OK)
+    {
+        ret = esp_console_start_repl(repl);
+    }
+
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Console start failed: %s", esp_err_to_name(ret));
+    }
+
+    return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+
+/**
+ * @brief malloc() counted against a module
+ */
+void *heap_account_malloc(heap_account_module_t module, size_t size)
+{
+    void *ptr = malloc(size);
+    heap_account_add(module, ptr);
+    return ptr;
+}
+
+/**
+ * @brief calloc() counted against a module
+ */
+void *heap_account_calloc(heap_account_module_t module, size_t n, size_t size)
+{
+    void *ptr = calloc(n, size);
+    heap_account_add(module, ptr);
+    return ptr;
+}
+
+/**
+ * @brief strndup() counted against a module
+ */
+char *heap_account_strndup(heap_account_module_t module, const char *s, size_t n)
+{
+    char *ptr = strndup(s, n);
+    heap_account_add(module, ptr);
+    return ptr;
+}
+
+/**
+ * @brief free() a block allocated with the same module tag
+ */
+void heap_account_free(heap_account_module_t module, void *ptr)
+{
+    if (ptr == NULL || module >= HEAP_ACCOUNT_MAX)
+    {
+        free(ptr);
+        return;
+    }
+
+    uint32_t size = heap_caps_get_allocated_size(ptr);
+
+    portENTER_CRITICAL(&account_lock);
+    // Blocks allocated before heap_account_init() were never added
+    counters[module].live_bytes -= (size < counters[module].live_bytes) ? size : counters[module].live_bytes;
+    counters[module].frees++;
+    portEXIT_CRITICAL(&account_lock);
+
+    free(ptr);
+}
+
+#endif /* CONFIG_HEAP_ACCOUNT_ENABLE */
+
+/* Private functions ---------------------------------------------------------*/
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+
+/**
+ * @brief Count an allocation
+ */
+static void heap_account_add(heap_account_module_t module, void *ptr)
+{
+    if (ptr == NULL || module >= HEAP_ACCOUNT_MAX)
+    {
+        return;
+    }
+
+    uint32_t size = heap_caps_get_allocated_size(ptr);
+
+    portENTER_CRITICAL(&account_lock);
+    counters[module].live_bytes += size;
+    if (counters[module].live_bytes > counters[module].peak_bytes)
+    {
+        counters[module].peak_bytes = counters[module].live_bytes;
+    }
+    counters[module].allocs++;
+    portEXIT_CRITICAL(&account_lock);
+}
+
+/**
+ * @brief cJSON allocation hook
+ */
+static void *heap_account_json_malloc(size_t size)
+{
+    return heap_account_malloc(HEAP_ACCOUNT_JSON, size);
+}
+
+/**
+ * @brief cJSON free hook
+ */
+static void heap_account_json_free(void *ptr)
+{
+    heap_account_free(HEAP_ACCOUNT_JSON, ptr);
+}
+
+#endif /* CONFIG_HEAP_ACCOUNT_ENABLE */
+
+#if CONFIG_HEAP_ACCOUNT_CONSOLE
+
+/**
+ * @brief `heap [reset]` console command
+ */
+static int heap_account_console_cmd(int argc, char **argv)
+{
+    if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0))
+    {
+        printf("usage: heap [reset]\n");
+        return 1;
+    }
+
+    if (argc == 2)
+    {
+        heap_account_reset_peaks();
+    }
+
+    heap_account_report_t report;
+    heap_account_get_report(&report);
+
+    printf("free %lu  min free %lu  largest block %lu\n",
+           (unsigned long)report.free_bytes, (unsigned long)report.min_free_bytes,
+           (unsigned long)report.largest_block);
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+    printf("%-8s %10s %10s %10s %10s\n", "module", "live", "peak", "allocs", "frees");
+    for (int i = 0; i < HEAP_ACCOUNT_MAX; i++)
+    {
+        const heap_account_stats_t *m = &report.modules[i];
+        printf("%-8s %10lu %10lu %10lu %10lu\n", m->name,
+               (unsigned long)m->live_bytes, (unsigned long)m->peak_bytes,
+               (unsigned long)m->allocs, (unsigned long)m->frees);
+    }
+#endif
+
+    return 0;
+}
+
+#endif /* CONFIG_HEAP_ACCOUNT_CONSOLE */
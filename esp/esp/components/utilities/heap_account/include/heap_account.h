@@ -0,0 +1,150 @@
+/**
+ * @file heap_account.h
+ *
+ * @brief Per-module Heap Accounting API
+ *
+ * Tagged allocators that count live bytes, peak bytes and alloc/free calls
+ * per module. cJSON is routed through the JSON tag with cJSON hooks. With
+ * CONFIG_HEAP_ACCOUNT_ENABLE off the allocators are plain malloc/free and
+ * only the system heap figures are reported.
+ */
+
+#ifndef HEAP_ACCOUNT_H
+#define HEAP_ACCOUNT_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Accounted modules
+ */
+typedef enum
+{
+    HEAP_ACCOUNT_JSON = 0, //!< cJSON trees and printed strings (json_helper, local API)
+    HEAP_ACCOUNT_MQTT,     //!< mqtt_manager buffers, TLS transport context, history export
+    HEAP_ACCOUNT_OTA,      //!< OTA job
+    HEAP_ACCOUNT_MAX
+} heap_account_module_t;
+
+/**
+ * @brief Counters of one module
+ *
+ * Sizes are the usable block sizes reported by the allocator, so they
+ * include rounding but not the block header.
+ */
+typedef struct
+{
+    const char *name;    //!< Module name
+    uint32_t live_bytes; //!< Bytes currently allocated
+    uint32_t peak_bytes; //!< Highest live_bytes since boot or reset
+    uint32_t allocs;     //!< Successful allocations
+    uint32_t frees;      //!< Frees
+} heap_account_stats_t;
+
+/**
+ * @brief System heap figures and per-module counters
+ */
+typedef struct
+{
+    uint32_t free_bytes;                            //!< Free heap
+    uint32_t min_free_bytes;                        //!< Lowest free heap since boot
+    uint32_t largest_block;                         //!< Largest free 8-bit capable block
+    heap_account_stats_t modules[HEAP_ACCOUNT_MAX]; //!< Zero when accounting is disabled
+} heap_account_report_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Install the cJSON hooks
+ *
+ * @note Call before the first cJSON allocation, blocks allocated earlier
+ *       are not counted
+ */
+void heap_account_init(void);
+
+/**
+ * @brief Read system heap figures and module counters
+ *
+ * @param[out] report Destination
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on NULL report
+ */
+esp_err_t heap_account_get_report(heap_account_report_t *report);
+
+/**
+ * @brief Restart peak tracking from the current live bytes
+ */
+void heap_account_reset_peaks(void);
+
+/**
+ * @brief Log the report
+ */
+void heap_account_log(void);
+
+/**
+ * @brief Start a UART console with the `heap` command
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED without
+ *         CONFIG_HEAP_ACCOUNT_CONSOLE, error code otherwise
+ */
+esp_err_t heap_account_console_start(void);
+
+#if CONFIG_HEAP_ACCOUNT_ENABLE
+
+/**
+ * @brief malloc() counted against a module
+ *
+ * @param[in] module Module tag
+ * @param[in] size Bytes
+ *
+ * @return Block, NULL on failure
+ */
+void *heap_account_malloc(heap_account_module_t module, size_t size);
+
+/**
+ * @brief calloc() counted against a module
+ *
+ * @param[in] module Module tag
+ * @param[in] n Elements
+ * @param[in] size Element size
+ *
+ * @return Zeroed block, NULL on failure
+ */
+void *heap_account_calloc(heap_account_module_t module, size_t n, size_t size);
+
+/**
+ * @brief strndup() counted against a module
+ *
+ * @param[in] module Module tag
+ * @param[in] s Source string
+ * @param[in] n Maximum characters to copy
+ *
+ * @return NUL terminated copy, NULL on failure
+ */
+char *heap_account_strndup(heap_account_module_t module, const char *s, size_t n);
+
+/**
+ * @brief free() a block allocated with the same module tag
+ *
+ * @param[in] module Module tag
+ * @param[in] ptr Block, NULL is ignored
+ */
+void heap_account_free(heap_account_module_t module, void *ptr);
+
+#else
+
+static inline void *heap_account_malloc(heap_account_module_t module, size_t size) { (void)module; return malloc(size); }
+static inline void *heap_account_calloc(heap_account_module_t module, size_t n, size_t size) { (void)module; return calloc(n, size); }
+static inline char *heap_account_strndup(heap_account_module_t module, const char *s, size_t n) { (void)module; return strndup(s, n); }
+static inline void heap_account_free(heap_account_module_t module, void *ptr) { (void)module; free(ptr); }
+
+#endif
+
+#endif /* HEAP_ACCOUNT_H */
@@ -0,0 +1,547 @@
+/**
+ * @file history_codec.c
+ *
+ * @brief Compressed Sensor History Block Codec Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "history_codec.h"
+#include <math.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Payload widths of the prefix classes '10', '110', '1110', '1111'
+ *
+ * A zero is the single bit '0'. The last class holds any 32 bit value.
+ */
+typedef struct
+{
+    uint8_t bits[4]; //!< Payload bits per class
+} history_codec_classes_t;
+
+/**
+ * @brief MSB first bit writer
+ */
+typedef struct
+{
+    uint8_t *buf;   //!< Destination, zeroed before use
+    size_t bit_pos; //!< Next bit
+} history_codec_writer_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+// Timestamp delta-of-delta: jitter of a few seconds, then interval changes
+static const history_codec_classes_t ts_classes = {{7, 9, 12, 32}};
+
+// Value deltas: sensor noise, then real changes
+static const history_codec_classes_t value_classes = {{4, 8, 12, 32}};
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Zig-zag map a signed value so small magnitudes get small codes
+ *
+ * @param[in] value Signed value
+ *
+ * @return Mapped value
+ */
+static uint32_t history_codec_zigzag(int32_t value);
+
+/**
+ * @brief Bits used by a mapped value
+ *
+ * @param[in] classes Prefix classes
+ * @param[in] zz Zig-zag mapped value
+ *
+ * @return Prefix plus payload bits
+ */
+static uint32_t history_codec_code_bits(const history_codec_classes_t *classes, uint32_t zz);
+
+/**
+ * @brief Write a mapped value
+ *
+ * @param[in,out] w Bit writer
+ * @param[in] classes Prefix classes
+ * @param[in] zz Zig-zag mapped value
+ */
+static void history_codec_put_code(history_codec_writer_t *w, const history_codec_classes_t *classes, uint32_t zz);
+
+/**
+ * @brief Write the low bits of a value, MSB first
+ *
+ * @param[in,out] w Bit writer
+ * @param[in] value Value
+ * @param[in] bits Bit count (1-32)
+ */
+static void history_codec_put_bits(history_codec_writer_t *w, uint32_t value, uint8_t bits);
+
+/**
+ * @brief Read a mapped value and undo the zig-zag mapping
+ *
+ * @param[in] stream Bit stream
+ * @param[in,out] pos Bit position
+ * @param[in] classes Prefix classes
+ *
+ * @return Signed value
+ */
+static int32_t history_codec_get_code(const uint8_t *stream, size_t *pos, const history_codec_classes_t *classes);
+
+/**
+ * @brief Skip the mapped values of one column, checking the stream length
+ *
+ * @param[in] stream Bit stream
+ * @param[in,out] pos Bit position
+ * @param[in] stream_bits Bits available
+ * @param[in] classes Prefix classes
+ * @param[in] n Values in the column
+ *
+ * @return true if the column ends within the stream
+ */
+static bool history_codec_skip_column(const uint8_t *stream, size_t *pos, size_t stream_bits,
+                                      const history_codec_classes_t *classes, size_t n);
+
+/**
+ * @brief Read bits MSB first
+ *
+ * @param[in] stream Bit stream
+ * @param[in,out] pos Bit position
+ * @param[in] bits Bit count (1-32)
+ *
+ * @return Value
+ */
+static uint32_t history_codec_get_bits(const uint8_t *stream, size_t *pos, uint8_t bits);
+
+/**
+ * @brief Mapped codes of one sample against its predecessor
+ *
+ * @param[in] samples Samples
+ * @param[in] i Sample index, at least 1
+ * @param[out] zz Codes per column
+ */
+static void history_codec_sample_codes(const history_sample_t *samples, size_t i, uint32_t zz[HISTORY_CODEC_COLUMNS]);
+
+/**
+ * @brief Store a little-endian 16 bit integer
+ *
+ * @param[out] p Destination
+ * @param[in] value Value
+ */
+static void history_codec_put_le16(uint8_t *p, uint16_t value);
+
+/**
+ * @brief Store a little-endian 32 bit integer
+ *
+ * @param[out] p Destination
+ * @param[in] value Value
+ */
+static void history_codec_put_le32(uint8_t *p, uint32_t value);
+
+/**
+ * @brief Load a little-endian 16 bit integer
+ *
+ * @param[in] p Source
+ *
+ * @return Value
+ */
+static uint16_t history_codec_get_le16(const uint8_t *p);
+
+/**
+ * @brief Load a little-endian 32 bit integer
+ *
+ * @param[in] p Source
+ *
+ * @return Value
+ */
+static uint32_t history_codec_get_le32(const uint8_t *p);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Encode as many samples as fit into one block
+ */
+esp_err_t history_codec_encode(const history_sample_t *samples, size_t count, uint16_t seq,
+                               uint8_t *block, size_t cap, size_t *len, size_t *encoded)
+{
+    if (samples == NULL || count == 0 || block == NULL || len == NULL || encoded == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (cap < HISTORY_CODEC_HEADER_LEN)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (count > HISTORY_CODEC_MAX_SAMPLES)
+    {
+        count = HISTORY_CODEC_MAX_SAMPLES;
+    }
+
+    // Sizing pass: the columns are written one after another, so the number
+    // of samples has to be fixed before the first column is written
+    size_t stream_bits = 0;
+    size_t cap_bits = (cap - HISTORY_CODEC_HEADER_LEN) * 8;
+    size_t n = 1;
+
+    for (; n < count; n++)
+    {
+        uint32_t zz[HISTORY_CODEC_COLUMNS];
+        history_codec_sample_codes(samples, n, zz);
+
+        size_t bits = history_codec_code_bits(&ts_classes, zz[0]);
+        for (int c = 1; c < HISTORY_CODEC_COLUMNS; c++)
+        {
+            bits += history_codec_code_bits(&value_classes, zz[c]);
+        }
+
+        if (stream_bits + bits > cap_bits)
+        {
+            break;
+        }
+        stream_bits += bits;
+    }
+
+    size_t stream_len = (stream_bits + 7) / 8;
+
+    // Header with the first sample in full
+    block[0] = HISTORY_CODEC_MAGIC;
+    block[1] = HISTORY_CODEC_VERSION;
+    block[2] = 0;
+    block[3] = 0;
+    history_codec_put_le16(&block[4], seq);
+    history_codec_put_le16(&block[6], (uint16_t)n);
+    history_codec_put_le32(&block[8], samples[0].timestamp);
+    history_codec_put_le16(&block[12], (uint16_t)samples[0].temperature);
+    history_codec_put_le16(&block[14], samples[0].humidity);
+    history_codec_put_le16(&block[16], samples[0].light);
+
+    // Columns: timestamps, temperature, humidity, light
+    history_codec_writer_t w = {
+        .buf = &block[HISTORY_CODEC_HEADER_LEN],
+        .bit_pos = 0,
+    };
+    memset(w.buf, 0, stream_len);
+
+    for (int c = 0; c < HISTORY_CODEC_COLUMNS; c++)
+    {
+        const history_codec_classes_t *classes = (c == 0) ? &ts_classes : &value_classes;
+
+        for (size_t i = 1; i < n; i++)
+        {
+            uint32_t zz[HISTORY_CODEC_COLUMNS];
+            history_codec_sample_codes(samples, i, zz);
+            history_codec_put_code(&w, classes, zz[c]);
+        }
+    }
+
+    *len = HISTORY_CODEC_HEADER_LEN + stream_len;
+    *encoded = n;
+    return ESP_OK;
+}
+
+/**
+ * @brief Mark a block as the last one of an export
+ */
+void history_codec_set_last(uint8_t *block)
+{
+    block[2] |= HISTORY_CODEC_FLAG_LAST;
+}
+
+/**
+ * @brief Convert a reading to a fixed point sample
+ */
+void history_codec_make_sample(uint32_t timestamp, float temperature, float humidity, int light,
+                               history_sample_t *sample)
+{
+    float t = roundf(temperature * 100.0f);
+    float h = roundf(humidity * 100.0f);
+
+    sample->timestamp = timestamp;
+    sample->temperature = (int16_t)((t > INT16_MAX) ? INT16_MAX : (t < INT16_MIN) ? INT16_MIN : t);
+    sample->humidity = (uint16_t)((h > UINT16_MAX) ? UINT16_MAX : (h < 0) ? 0 : h);
+    sample->light = (uint16_t)((light > UINT16_MAX) ? UINT16_MAX : (light < 0) ? 0 : light);
+}
+
+/**
+ * @brief Start reading a block
+ */
+esp_err_t history_codec_reader_init(history_codec_reader_t *reader, const uint8_t *block, size_t len)
+{
+    if (reader == NULL || block == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (len < HISTORY_CODEC_HEADER_LEN)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (block[0] != HISTORY_CODEC_MAGIC || block[1] != HISTORY_CODEC_VERSION)
+    {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    uint16_t count = history_codec_get_le16(&block[6]);
+    if (count == 0)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    reader->stream = &block[HISTORY_CODEC_HEADER_LEN];
+    reader->count = count;
+    reader->next = 0;
+    reader->delta = 0;
+    reader->prev.timestamp = history_codec_get_le32(&block[8]);
+    reader->prev.temperature = (int16_t)history_codec_get_le16(&block[12]);
+    reader->prev.humidity = history_codec_get_le16(&block[14]);
+    reader->prev.light = history_codec_get_le16(&block[16]);
+
+    // Columns follow each other, so each start is found by skipping the one before
+    size_t stream_bits = (len - HISTORY_CODEC_HEADER_LEN) * 8;
+    size_t pos = 0;
+
+    for (int c = 0; c < HISTORY_CODEC_COLUMNS; c++)
+    {
+        reader->pos[c] = pos;
+        if (!history_codec_skip_column(reader->stream, &pos, stream_bits,
+                                       (c == 0) ? &ts_classes : &value_classes, count - 1))
+        {
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Read the next sample of a block
+ */
+bool history_codec_reader_next(history_codec_reader_t *reader, history_sample_t *sample)
+{
+    if (reader->next >= reader->count)
+    {
+        return false;
+    }
+
+    if (reader->next > 0)
+    {
+        history_sample_t *prev = &reader->prev;
+
+        reader->delta += (uint32_t)history_codec_get_code(reader->stream, &reader->pos[0], &ts_classes);
+        prev->timestamp += reader->delta;
+        prev->temperature = (int16_t)(prev->temperature +
+                                      history_codec_get_code(reader->stream, &reader->pos[1], &value_classes));
+        prev->humidity = (uint16_t)(prev->humidity +
+                                    history_codec_get_code(reader->stream, &reader->pos[2], &value_classes));
+        prev->light = (uint16_t)(prev->light +
+                                 history_codec_get_code(reader->stream, &reader->pos[3], &value_classes));
+    }
+
+    reader->next++;
+    *sample = reader->prev;
+    return true;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Zig-zag map a signed value so small magnitudes get small codes
+ */
+static uint32_t history_codec_zigzag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+/**
+ * @brief Bits used by a mapped value
+ */
+static uint32_t history_codec_code_bits(const history_codec_classes_t *classes, uint32_t zz)
+{
+    if (zz == 0)
+    {
+        return 1;
+    }
+
+    for (int k = 0; k < 3; k++)
+    {
+        if (zz < (1UL << classes->bits[k]))
+        {
+            return (uint32_t)(k + 2) + classes->bits[k];
+        }
+    }
+
+    return 4 + classes->bits[3];
+}
+
+/**
+ * @brief Write a mapped value
+ */
+static void history_codec_put_code(history_codec_writer_t *w, const history_codec_classes_t *classes, uint32_t zz)
+{
+    if (zz == 0)
+    {
+        history_codec_put_bits(w, 0x0, 1);
+        return;
+    }
+
+    // Prefixes '10', '110', '1110', then '1111' without a terminating zero
+    for (int k = 0; k < 3; k++)
+    {
+        if (zz < (1UL << classes->bits[k]))
+        {
+            history_codec_put_bits(w, (1UL << (k + 2)) - 2, k + 2);
+            history_codec_put_bits(w, zz, classes->bits[k]);
+            return;
+        }
+    }
+
+    history_codec_put_bits(w, 0xF, 4);
+    history_codec_put_bits(w, zz, classes->bits[3]);
+}
+
+/**
+ * @brief Write the low bits of a value, MSB first
+ */
+static void history_codec_put_bits(history_codec_writer_t *w, uint32_t value, uint8_t bits)
+{
+    for (int b = bits - 1; b >= 0; b--)
+    {
+        if ((value >> b) & 1)
+        {
+            w->buf[w->bit_pos >> 3] |= (uint8_t)(0x80 >> (w->bit_pos & 7));
+        }
+        w->bit_pos++;
+    }
+}
+
+/**
+ * @brief Read a mapped value and undo the zig-zag mapping
+ */
+static int32_t history_codec_get_code(const uint8_t *stream, size_t *pos, const history_codec_classes_t *classes)
+{
+    int prefix = 0;
+    while (prefix < 4 && history_codec_get_bits(stream, pos, 1))
+    {
+        prefix++;
+    }
+
+    if (prefix == 0)
+    {
+        return 0;
+    }
+
+    uint32_t zz = history_codec_get_bits(stream, pos, classes->bits[prefix - 1]);
+    return (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+}
+
+/**
+ * @brief Skip the mapped values of one column, checking the stream length
+ */
+static bool history_codec_skip_column(const uint8_t *stream, size_t *pos, size_t stream_bits,
+                                      const history_codec_classes_t *classes, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        // A code is at most 4 prefix bits and the widest payload; check the
+        // prefix bit by bit, then the payload as a whole
+        int prefix = 0;
+        while (prefix < 4)
+        {
+            if (*pos >= stream_bits)
+            {
+                return false;
+            }
+            if (!history_codec_get_bits(stream, pos, 1))
+            {
+                break;
+            }
+            prefix++;
+        }
+
+        if (prefix > 0)
+        {
+            *pos += classes->bits[prefix - 1];
+            if (*pos > stream_bits)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Read bits MSB first
+ */
+static uint32_t history_codec_get_bits(const uint8_t *stream, size_t *pos, uint8_t bits)
+{
+    uint32_t value = 0;
+
+    for (uint8_t b = 0; b < bits; b++)
+    {
+        value = (value << 1) | ((stream[*pos >> 3] >> (7 - (*pos & 7))) & 1);
+        (*pos)++;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Mapped codes of one sample against its predecessor
+ */
+static void history_codec_sample_codes(const history_sample_t *samples, size_t i, uint32_t zz[HISTORY_CODEC_COLUMNS])
+{
+    const history_sample_t *cur = &samples[i];
+    const history_sample_t *prev = &samples[i - 1];
+
+    // Timestamp arithmetic wraps modulo 2^32, so any sequence round-trips;
+    // the delta before the first sample counts as 0
+    uint32_t delta = cur->timestamp - prev->timestamp;
+    uint32_t prev_delta = (i >= 2) ? prev->timestamp - samples[i - 2].timestamp : 0;
+
+    zz[0] = history_codec_zigzag((int32_t)(delta - prev_delta));
+    zz[1] = history_codec_zigzag((int32_t)cur->temperature - prev->temperature);
+    zz[2] = history_codec_zigzag((int32_t)cur->humidity - prev->humidity);
+    zz[3] = history_codec_zigzag((int32_t)cur->light - prev->light);
+}
+
+/**
+ * @brief Store a little-endian 16 bit integer
+ */
+static void history_codec_put_le16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * @brief Store a little-endian 32 bit integer
+ */
+static void history_codec_put_le32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+/**
+ * @brief Load a little-endian 16 bit integer
+ */
+static uint16_t history_codec_get_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * @brief Load a little-endian 32 bit integer
+ */
+static uint32_t history_codec_get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file history_codec.h
+ *
+ * @brief Compressed Sensor History Block Codec API
+ *
+ * Encodes a run of samples as one self-contained block: an 18 byte header
+ * with the first sample, then a bit stream holding one column per field.
+ * Timestamps are stored as delta-of-delta and values as deltas, both
+ * zig-zag mapped and written with a prefix code that spends one bit on a
+ * zero. Each block decodes on its own, so a lost block loses only its
+ * samples.
+ *
+ * The reader decodes a block one sample at a time with a bit position per
+ * column, without buffering the columns.
+ */
+
+#ifndef HISTORY_CODEC_H
+#define HISTORY_CODEC_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define HISTORY_CODEC_MAGIC       0x48   //!< 'H'
+#define HISTORY_CODEC_VERSION     1      //!< Block format version
+#define HISTORY_CODEC_HEADER_LEN  18     //!< Header bytes before the bit stream
+#define HISTORY_CODEC_MAX_SAMPLES 0xFFFF //!< Samples per block
+#define HISTORY_CODEC_FLAG_LAST   0x01   //!< Last block of an export
+#define HISTORY_CODEC_COLUMNS     4      //!< timestamp, temperature, humidity, light
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief One recorded sample in fixed point
+ */
+typedef struct
+{
+    uint32_t timestamp;  //!< Unix timestamp in seconds
+    int16_t temperature; //!< Temperature in 0.01 degrees Celsius
+    uint16_t humidity;   //!< Relative humidity in 0.01 percent
+    uint16_t light;      //!< Light intensity in lux
+} history_sample_t;
+
+/**
+ * @brief Sequential block reader
+ */
+typedef struct
+{
+    const uint8_t *stream;                //!< Bit stream after the header
+    size_t pos[HISTORY_CODEC_COLUMNS];    //!< Next bit per column
+    history_sample_t prev;                //!< Last sample returned
+    uint32_t delta;                       //!< Last timestamp delta
+    uint16_t count;                       //!< Samples in the block
+    uint16_t next;                        //!< Index of the next sample
+} history_codec_reader_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Encode as many samples as fit into one block
+ *
+ * Samples are taken in order until the next one would not fit into cap
+ * bytes or HISTORY_CODEC_MAX_SAMPLES is reached.
+ *
+ * @param[in] samples Samples, oldest first
+ * @param[in] count Number of samples
+ * @param[in] seq Block sequence number within the export
+ * @param[out] block Destination
+ * @param[in] cap Destination size
+ * @param[out] len Bytes written
+ * @param[out] encoded Samples consumed
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on NULL pointers or no samples
+ *      - ESP_ERR_INVALID_SIZE if cap cannot hold the header
+ */
+esp_err_t history_codec_encode(const history_sample_t *samples, size_t count, uint16_t seq,
+                               uint8_t *block, size_t cap, size_t *len, size_t *encoded);
+
+/**
+ * @brief Mark a block as the last one of an export
+ *
+ * @param[in,out] block Encoded block
+ */
+void history_codec_set_last(uint8_t *block);
+
+/**
+ * @brief Convert a reading to a fixed point sample
+ *
+ * Values outside the field ranges are clamped.
+ *
+ * @param[in] timestamp Unix timestamp in seconds
+ * @param[in] temperature Temperature in degrees Celsius
+ * @param[in] humidity Relative humidity in percent
+ * @param[in] light Light intensity in lux
+ * @param[out] sample Destination
+ */
+void history_codec_make_sample(uint32_t timestamp, float temperature, float humidity, int light,
+                               history_sample_t *sample);
+
+/**
+ * @brief Start reading a block
+ *
+ * Validates the header and walks the columns once, so reading the samples
+ * afterwards cannot run past len.
+ *
+ * @param[out] reader Reader
+ * @param[in] block Encoded block, kept referenced until the last sample
+ * @param[in] len Block length
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on NULL pointers
+ *      - ESP_ERR_INVALID_VERSION on a bad magic or an unknown version
+ *      - ESP_ERR_INVALID_SIZE if the block is truncated or empty
+ */
+esp_err_t history_codec_reader_init(history_codec_reader_t *reader, const uint8_t *block, size_t len);
+
+/**
+ * @brief Read the next sample of a block
+ *
+ * @param[in,out] reader Reader
+ * @param[out] sample Destination
+ *
+ * @return true if a sample was read, false at the end of the block
+ */
+bool history_codec_reader_next(history_codec_reader_t *reader, history_sample_t *sample);
+
+#endif /* HISTORY_CODEC_H */
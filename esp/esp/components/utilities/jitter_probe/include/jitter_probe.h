@@ -0,0 +1,87 @@
+/**
+ * @file jitter_probe.h
+ *
+ * @brief Scheduling Jitter Probe API
+ *
+ * Lightweight latency probes for the scheduling benchmark. Loop periods are
+ * measured by loop_monitor. With CONFIG_JITTER_PROBE_ENABLE off every call
+ * compiles to nothing.
+ */
+
+#ifndef JITTER_PROBE_H
+#define JITTER_PROBE_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Benchmark probes
+ */
+typedef enum
+{
+    JITTER_PROBE_BUTTON_TO_RELAY = 0, //!< Button edge interrupt to relay GPIO write
+    JITTER_PROBE_MAX
+} jitter_probe_id_t;
+
+/**
+ * @brief Probe statistics in microseconds
+ */
+typedef struct
+{
+    uint32_t count;  //!< Samples taken
+    uint32_t min_us; //!< Smallest sample
+    uint32_t max_us; //!< Largest sample
+    uint32_t avg_us; //!< Mean of all samples
+} jitter_probe_stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+#if CONFIG_JITTER_PROBE_ENABLE
+
+/**
+ * @brief Mark the start of a latency measurement (ISR safe)
+ *
+ * @param[in] id Probe id
+ */
+void jitter_probe_start(jitter_probe_id_t id);
+
+/**
+ * @brief Mark the end of a latency measurement
+ *
+ * Records the time since the last jitter_probe_start(). Ignored if no
+ * start is pending.
+ *
+ * @param[in] id Probe id
+ */
+void jitter_probe_stop(jitter_probe_id_t id);
+
+/**
+ * @brief Read probe statistics
+ *
+ * @param[in] id Probe id
+ * @param[out] out Statistics
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad arguments
+ */
+esp_err_t jitter_probe_get_stats(jitter_probe_id_t id, jitter_probe_stats_t *out);
+
+/**
+ * @brief Log statistics of all probes
+ */
+void jitter_probe_report(void);
+
+#else
+
+static inline void jitter_probe_start(jitter_probe_id_t id) { (void)id; }
+static inline void jitter_probe_stop(jitter_probe_id_t id) { (void)id; }
+static inline esp_err_t jitter_probe_get_stats(jitter_probe_id_t id, jitter_probe_stats_t *out) { return ESP_ERR_NOT_SUPPORTED; }
+static inline void jitter_probe_report(void) {}
+
+#endif
+
+#endif /* JITTER_PROBE_H */
@@ -0,0 +1,149 @@
+/**
+ * @file jitter_probe.c
+ *
+ * @brief Scheduling Jitter Probe Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "jitter_probe.h"
+
+#if CONFIG_JITTER_PROBE_ENABLE
+
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Probe state
+ */
+typedef struct
+{
+    int64_t mark_us;  //!< Pending start time, 0 if none
+    uint32_t count;   //!< Samples taken
+    uint32_t min_us;  //!< Smallest sample
+    uint32_t max_us;  //!< Largest sample
+    uint64_t sum_us;  //!< Sum of all samples
+} jitter_probe_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "JITTER_PROBE";
+
+static const char *probe_names[JITTER_PROBE_MAX] = {
+    [JITTER_PROBE_BUTTON_TO_RELAY] = "button_to_relay",
+};
+
+static portMUX_TYPE probe_lock = portMUX_INITIALIZER_UNLOCKED;
+static jitter_probe_state_t probes[JITTER_PROBE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Add one sample to a probe (caller holds probe_lock)
+ *
+ * @param[in] probe Probe state
+ * @param[in] sample_us Sample in microseconds
+ */
+static void jitter_probe_add(jitter_probe_state_t *probe, uint32_t sample_us);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Mark the start of a latency measurement (ISR safe)
+ */
+void IRAM_ATTR jitter_probe_start(jitter_probe_id_t id)
+{
+    if (id >= JITTER_PROBE_MAX)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL_ISR(&probe_lock);
+    probes[id].mark_us = esp_timer_get_time();
+    portEXIT_CRITICAL_ISR(&probe_lock);
+}
+
+/**
+ * @brief Mark the end of a latency measurement
+ */
+void jitter_probe_stop(jitter_probe_id_t id)
+{
+    if (id >= JITTER_PROBE_MAX)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&probe_lock);
+    if (probes[id].mark_us != 0)
+    {
+        jitter_probe_add(&probes[id], (uint32_t)(now - probes[id].mark_us));
+        probes[id].mark_us = 0;
+    }
+    portEXIT_CRITICAL(&probe_lock);
+}
+
+/**
+ * @brief Read probe statistics
+ */
+esp_err_t jitter_probe_get_stats(jitter_probe_id_t id, jitter_probe_stats_t *out)
+{
+    if (id >= JITTER_PROBE_MAX || out == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&probe_lock);
+    out->count = probes[id].count;
+    out->min_us = probes[id].min_us;
+    out->max_us = probes[id].max_us;
+    out->avg_us = probes[id].count ? (uint32_t)(probes[id].sum_us / probes[id].count) : 0;
+    portEXIT_CRITICAL(&probe_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Log statistics of all probes
+ */
+void jitter_probe_report(void)
+{
+    jitter_probe_stats_t stats;
+
+    for (int id = 0; id < JITTER_PROBE_MAX; id++)
+    {
+        jitter_probe_get_stats((jitter_probe_id_t)id, &stats);
+        ESP_LOGI(TAG, "%s: n=%lu min=%lu avg=%lu max=%lu us",
+                 probe_names[id], (unsigned long)stats.count,
+                 (unsigned long)stats.min_us, (unsigned long)stats.avg_us,
+                 (unsigned long)stats.max_us);
+    }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Add one sample to a probe
+ */
+static void jitter_probe_add(jitter_probe_state_t *probe, uint32_t sample_us)
+{
+    if (probe->count == 0 || sample_us < probe->min_us)
+    {
+        probe->min_us = sample_us;
+    }
+
+    if (sample_us > probe->max_us)
+    {
+        probe->max_us = sample_us;
+    }
+
+    probe->sum_us += sample_us;
+    probe->count++;
+}
+
+#endif /* CONFIG_JITTER_PROBE_ENABLE */
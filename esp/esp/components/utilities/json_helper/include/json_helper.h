@@ -68,7 +68,7 @@ bool json_helper_get_bool(cJSON *object, const char *key, bool default_val);
  * @param[in] humidity Humidity in percentage
  * @param[in] light Light level (lux)
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"timestamp": 1701388800, "temperature": 25.6, "humidity": 65.2, "light": 450}
  */
@@ -84,7 +84,7 @@ char *json_helper_create_data(uint32_t timestamp, float temperature, float humid
  * @param[in] ac AC state (1=ON, 0=OFF)
  * @param[in] interval Data reporting interval in seconds
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"timestamp": 1701388800, "mode": 1, "interval": 5, "fan": 1, "light": 1, "ac": 1}
  */
@@ -100,7 +100,7 @@ char *json_helper_create_state(uint32_t timestamp, int mode, int interval, int f
  * @param[in] broker MQTT broker URI
  * @param[in] firmware Firmware version string
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"timestamp": 1701388800, "id": "esp_01", "ssid": "MyHomeWiFi",
  *               "ip": "192.168.1.100", "broker": "mqtt://192.168.1.20:1883",
@@ -115,7 +115,7 @@ char *json_helper_create_info(uint32_t timestamp, const char *device_id, const c
  * @param[in] cmd_id Command ID
  * @param[in] status Status string
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"cmd_id": "1234", "status": "success"}
  */
@@ -143,7 +143,7 @@ cJSON *json_helper_parse_command(const char *json_str, char *cmd_id, size_t cmd_
  * @param[in] ap_list Array of WiFi access point records
  * @param[in] ap_count Number of access points
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"ssid": "Network1", "rssi": -45, "auth": 3}, ...
  */
@@ -174,7 +174,7 @@ esp_err_t json_helper_parse_wifi_credentials(const char *json_str,
  * @param[in] ip_address IP address string (can be NULL)
  * @param[in] rssi Signal strength (ignored if not connected)
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"connected": true, "provisioned": true, "ip": "192.168.1.100", "rssi": -45}
  */
@@ -187,7 +187,7 @@ char *json_helper_create_wifi_status(bool connected, bool provisioned,
  * @param[in] status Status string ("ok", "error", etc.)
  * @param[in] message Response message
  *
- * @return JSON string (caller must free) or NULL on error
+ * @return JSON string (release with cJSON_free()) or NULL on error
  *
  * @note Format: {"status": "ok", "message": "Success"}
  */
@@ -117,7 +117,7 @@ char *json_helper_create_data(uint32_t timestamp, float temperature, float humid
     cJSON_AddNumberToObject(root, "humidity", hum_rounded);
     cJSON_AddNumberToObject(root, "light", light);
 
-    char *json_str = cJSON_Print(root);
+    char *json_str = cJSON_PrintUnformatted(root);
     cJSON_Delete(root);
 
     if (json_str == NULL)
@@ -148,7 +148,7 @@ char *json_helper_create_state(uint32_t timestamp, int mode, int interval, int f
     cJSON_AddNumberToObject(root, "light", light);
     cJSON_AddNumberToObject(root, "ac", ac);
 
-    char *json_str = cJSON_Print(root);
+    char *json_str = cJSON_PrintUnformatted(root);
     cJSON_Delete(root);
 
     if (json_str == NULL)
@@ -275,6 +275,15 @@ cJSON *json_helper_parse_command(const char *json_str, char *cmd_id, size_t cmd_
         return NULL;
     }
 
+#if CONFIG_JSON_HELPER_LOG_TRUNCATION
+    size_t id_length = strlen(id_item->valuestring);
+    if (id_length >= cmd_id_len)
+    {
+        ESP_LOGW(TAG, "Command ID '%s' (len=%zu) will be truncated to %zu chars",
+                 id_item->valuestring, id_length, cmd_id_len - 1);
+    }
+#endif
+
     strncpy(cmd_id, id_item->valuestring, cmd_id_len - 1);
     cmd_id[cmd_id_len - 1] = '\0';
 
@@ -287,6 +296,15 @@ cJSON *json_helper_parse_command(const char *json_str, char *cmd_id, size_t cmd_
         return NULL;
     }
 
+#if CONFIG_JSON_HELPER_LOG_TRUNCATION
+    size_t cmd_length = strlen(cmd_item->valuestring);
+    if (cmd_length >= command_len)
+    {
+        ESP_LOGW(TAG, "Command '%s' (len=%zu) will be truncated to %zu chars",
+                 cmd_item->valuestring, cmd_length, command_len - 1);
+    }
+#endif
+
     strncpy(command, cmd_item->valuestring, command_len - 1);
     command[command_len - 1] = '\0';
 
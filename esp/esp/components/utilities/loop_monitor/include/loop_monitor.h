@@ -0,0 +1,118 @@
+/**
+ * @file loop_monitor.h
+ *
+ * @brief Periodic Loop Monitor API
+ *
+ * Each monitored loop ticks once per cycle with its expected period. The
+ * time since the previous tick beyond that period is the cycle's lateness;
+ * it is counted in a histogram, the longest gap between two ticks is kept
+ * as the maximum stall, and a cycle later than CONFIG_LOOP_MONITOR_MISS_PERCENT
+ * of its period counts as a missed deadline. The report is published on the
+ * metrics topic, so scheduling changes can be accepted or rejected on the
+ * numbers. With CONFIG_LOOP_MONITOR_ENABLE off every call compiles to nothing.
+ */
+
+#ifndef LOOP_MONITOR_H
+#define LOOP_MONITOR_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define LOOP_MONITOR_BUCKETS 8 //!< Lateness buckets: <1, <2, <5, <10, <50, <100, <500, >=500 ms
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Monitored loops
+ */
+typedef enum
+{
+    LOOP_MONITOR_DISPLAY = 0,  //!< display_update_task one second cadence
+    LOOP_MONITOR_BUTTON_SCAN,  //!< Button debounce scan timer
+    LOOP_MONITOR_MQTT_DATA,    //!< Sensor data publish timer
+    LOOP_MONITOR_MQTT_METRICS, //!< Metrics publish timer
+    LOOP_MONITOR_MAX           //!< Count, also "not monitored"
+} loop_monitor_id_t;
+
+/**
+ * @brief Figures of one loop since boot or reset
+ */
+typedef struct
+{
+    const char *name;                    //!< Loop name
+    uint32_t period_us;                  //!< Expected period of the last cycle
+    uint32_t cycles;                     //!< Cycles measured
+    uint32_t missed;                     //!< Cycles that missed their deadline
+    uint32_t max_late_us;                //!< Largest lateness
+    uint32_t max_stall_us;               //!< Longest gap between two cycles
+    uint32_t hist[LOOP_MONITOR_BUCKETS]; //!< Cycles per lateness bucket
+} loop_monitor_stats_t;
+
+/**
+ * @brief Figures of all loops
+ */
+typedef struct loop_monitor_report
+{
+    loop_monitor_stats_t loops[LOOP_MONITOR_MAX]; //!< Indexed by loop_monitor_id_t
+} loop_monitor_report_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+#if CONFIG_LOOP_MONITOR_ENABLE
+
+/**
+ * @brief Record the start of a loop cycle
+ *
+ * The first tick, and the first after loop_monitor_restart(), only sets
+ * the reference point.
+ *
+ * @param[in] id Loop, LOOP_MONITOR_MAX is ignored
+ * @param[in] period_us Expected time since the previous cycle
+ */
+void loop_monitor_tick(loop_monitor_id_t id, uint32_t period_us);
+
+/**
+ * @brief Forget the previous tick of a loop
+ *
+ * For loops that pause, are rescheduled or wake out of their cadence, so
+ * the gap is not taken for lateness.
+ *
+ * @param[in] id Loop, LOOP_MONITOR_MAX is ignored
+ */
+void loop_monitor_restart(loop_monitor_id_t id);
+
+/**
+ * @brief Read the figures of all loops
+ *
+ * @param[out] report Destination
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on NULL report
+ */
+esp_err_t loop_monitor_get_report(loop_monitor_report_t *report);
+
+/**
+ * @brief Clear the figures of all loops, e.g. before a test run
+ */
+void loop_monitor_reset(void);
+
+/**
+ * @brief Log the figures of all loops
+ */
+void loop_monitor_log(void);
+
+#else
+
+static inline void loop_monitor_tick(loop_monitor_id_t id, uint32_t period_us) { (void)id; (void)period_us; }
+static inline void loop_monitor_restart(loop_monitor_id_t id) { (void)id; }
+static inline esp_err_t loop_monitor_get_report(loop_monitor_report_t *report) { return ESP_ERR_NOT_SUPPORTED; }
+static inline void loop_monitor_reset(void) {}
+static inline void loop_monitor_log(void) {}
+
+#endif
+
+#endif /* LOOP_MONITOR_H */
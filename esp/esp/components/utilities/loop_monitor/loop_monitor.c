@@ -0,0 +1,211 @@
+/**
+ * @file loop_monitor.c
+ *
+ * @brief Periodic Loop Monitor Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "loop_monitor.h"
+
+#if CONFIG_LOOP_MONITOR_ENABLE
+
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief Loop state
+ */
+typedef struct
+{
+    int64_t last_us;            //!< Previous tick, 0 if none
+    loop_monitor_stats_t stats; //!< Figures, name filled in on read
+} loop_monitor_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "LOOP_MONITOR";
+
+static const char *loop_names[LOOP_MONITOR_MAX] = {
+    [LOOP_MONITOR_DISPLAY] = "display",
+    [LOOP_MONITOR_BUTTON_SCAN] = "button_scan",
+    [LOOP_MONITOR_MQTT_DATA] = "mqtt_data",
+    [LOOP_MONITOR_MQTT_METRICS] = "mqtt_metrics",
+};
+
+// Upper bounds of all buckets but the last
+static const uint32_t bucket_limits_us[LOOP_MONITOR_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 50000, 100000, 500000};
+
+static portMUX_TYPE monitor_lock = portMUX_INITIALIZER_UNLOCKED;
+static loop_monitor_state_t loops[LOOP_MONITOR_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Find the histogram bucket of a lateness
+ *
+ * @param[in] late_us Lateness in microseconds
+ *
+ * @return Bucket index
+ */
+static int loop_monitor_bucket(uint32_t late_us);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Record the start of a loop cycle
+ */
+void loop_monitor_tick(loop_monitor_id_t id, uint32_t period_us)
+{
+    if (id >= LOOP_MONITOR_MAX)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool report_miss = false;
+    uint32_t late_us = 0;
+
+    portENTER_CRITICAL(&monitor_lock);
+    loop_monitor_state_t *loop = &loops[id];
+    if (loop->last_us != 0)
+    {
+        int64_t gap = now - loop->last_us;
+        uint32_t gap_us = (gap > UINT32_MAX) ? UINT32_MAX : (uint32_t)gap;
+        late_us = (gap_us > period_us) ? gap_us - period_us : 0;
+
+        loop->stats.period_us = period_us;
+        loop->stats.cycles++;
+        loop->stats.hist[loop_monitor_bucket(late_us)]++;
+
+        if (gap_us > loop->stats.max_stall_us)
+        {
+            loop->stats.max_stall_us = gap_us;
+        }
+
+        if ((uint64_t)late_us * 100 > (uint64_t)period_us * CONFIG_LOOP_MONITOR_MISS_PERCENT)
+        {
+            loop->stats.missed++;
+            // Warn on a new worst case only, a loop that keeps missing would flood the log
+            report_miss = (late_us > loop->stats.max_late_us);
+        }
+
+        if (late_us > loop->stats.max_late_us)
+        {
+            loop->stats.max_late_us = late_us;
+        }
+    }
+    loop->last_us = now;
+    portEXIT_CRITICAL(&monitor_lock);
+
+    if (report_miss)
+    {
+        ESP_LOGW(TAG, "%s missed its deadline: %lu ms late, period %lu ms",
+                 loop_names[id], (unsigned long)(late_us / 1000), (unsigned long)(period_us / 1000));
+    }
+}
+
+/**
+ * @brief Forget the previous tick of a loop
+ */
+void loop_monitor_restart(loop_monitor_id_t id)
+{
+    if (id >= LOOP_MONITOR_MAX)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&monitor_lock);
+    loops[id].last_us = 0;
+    portEXIT_CRITICAL(&monitor_lock);
+}
+
+/**
+ * @brief Read the figures of all loops
+ */
+esp_err_t loop_monitor_get_report(loop_monitor_report_t *report)
+{
+    if (report == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&monitor_lock);
+    for (int i = 0; i < LOOP_MONITOR_MAX; i++)
+    {
+        report->loops[i] = loops[i].stats;
+    }
+    portEXIT_CRITICAL(&monitor_lock);
+
+    for (int i = 0; i < LOOP_MONITOR_MAX; i++)
+    {
+        report->loops[i].name = loop_names[i];
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Clear the figures of all loops
+ */
+void loop_monitor_reset(void)
+{
+    // Reference points are kept, the next cycle of every loop is measured
+    portENTER_CRITICAL(&monitor_lock);
+    for (int i = 0; i < LOOP_MONITOR_MAX; i++)
+    {
+        memset(&loops[i].stats, 0, sizeof(loops[i].stats));
+    }
+    portEXIT_CRITICAL(&monitor_lock);
+}
+
+/**
+ * @brief Log the figures of all loops
+ */
+void loop_monitor_log(void)
+{
+    loop_monitor_report_t report;
+
+    loop_monitor_get_report(&report);
+
+    for (int i = 0; i < LOOP_MONITOR_MAX; i++)
+    {
+        const loop_monitor_stats_t *l = &report.loops[i];
+        if (l->cycles == 0)
+        {
+            continue;
+        }
+
+        ESP_LOGI(TAG, "%s: period=%lu ms cycles=%lu missed=%lu max late=%lu us max stall=%lu us "
+                      "late ms <1:%lu <2:%lu <5:%lu <10:%lu <50:%lu <100:%lu <500:%lu >=500:%lu",
+                 l->name, (unsigned long)(l->period_us / 1000), (unsigned long)l->cycles,
+                 (unsigned long)l->missed, (unsigned long)l->max_late_us, (unsigned long)l->max_stall_us,
+                 (unsigned long)l->hist[0], (unsigned long)l->hist[1], (unsigned long)l->hist[2],
+                 (unsigned long)l->hist[3], (unsigned long)l->hist[4], (unsigned long)l->hist[5],
+                 (unsigned long)l->hist[6], (unsigned long)l->hist[7]);
+    }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Find the histogram bucket of a lateness
+ */
+static int loop_monitor_bucket(uint32_t late_us)
+{
+    int bucket = 0;
+
+    while (bucket < LOOP_MONITOR_BUCKETS - 1 && late_us >= bucket_limits_us[bucket])
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+#endif /* CONFIG_LOOP_MONITOR_ENABLE */
@@ -0,0 +1,201 @@
+/**
+ * @file task_registry.h
+ *
+ * @brief Static Task Registry API
+ *
+ * Central task placement table: every application-owned task has a fixed
+ * core, a priority derived from its latency class and a statically
+ * allocated stack. Tasks are created from this table and their stack
+ * high-water marks are compared against the configured sizes at runtime.
+ */
+
+#ifndef TASK_REGISTRY_H
+#define TASK_REGISTRY_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define TASK_REGISTRY_HEADROOM_PERCENT  CONFIG_TASK_REGISTRY_HEADROOM_PERCENT
+#define TASK_REGISTRY_SIZE_MARGIN_PERCENT 25  //!< Margin over the measured peak for a stack size
+#define TASK_REGISTRY_SIZE_ALIGN        512   //!< Stack sizes are rounded up to this
+
+#define TASK_STACK_APP_EXECUTOR         CONFIG_APP_EXECUTOR_STACK_SIZE
+#define TASK_STACK_DISPLAY              CONFIG_TASK_DISPLAY_STACK_SIZE
+#define TASK_STACK_DISPLAY_FLUSH        CONFIG_TASK_DISPLAY_FLUSH_STACK_SIZE
+#define TASK_STACK_DNS_SERVER           CONFIG_DNS_SERVER_STACK_SIZE
+#define TASK_STACK_MQTT_PROBE           CONFIG_MQTT_PROBE_STACK_SIZE
+#define TASK_STACK_HISTORY_FLUSH        CONFIG_HISTORY_FLUSH_STACK_SIZE
+#define TASK_STACK_HISTORY_EXPORT       CONFIG_HISTORY_EXPORT_STACK_SIZE
+#define TASK_STACK_OTA                  CONFIG_OTA_MANAGER_STACK_SIZE
+
+#if CONFIG_TASK_PLACEMENT_ENABLE
+#define TASK_CORE_NETWORK               CONFIG_TASK_CORE_NETWORK
+#define TASK_CORE_LOCAL                 CONFIG_TASK_CORE_LOCAL
+#define TASK_PRIO_CONTROL               CONFIG_TASK_PRIO_CONTROL
+#define TASK_PRIO_SAMPLING              CONFIG_TASK_PRIO_SAMPLING
+#define TASK_PRIO_BACKGROUND            CONFIG_TASK_PRIO_BACKGROUND
+#define TASK_PRIO_NETWORK               CONFIG_TASK_PRIO_NETWORK
+#else
+// Unpinned, with the priorities tasks had before the placement table
+#define TASK_CORE_NETWORK               tskNO_AFFINITY
+#define TASK_CORE_LOCAL                 tskNO_AFFINITY
+#define TASK_PRIO_CONTROL               5
+#define TASK_PRIO_SAMPLING              4
+#define TASK_PRIO_BACKGROUND            2
+#define TASK_PRIO_NETWORK               5
+#endif
+
+/**
+ * @brief Declare statically allocated storage for one task
+ *
+ * Expands to a stack array and a task control block named
+ * `<name>_stack` and `<name>_tcb`. Stack size is in bytes.
+ */
+#define TASK_REGISTRY_STORAGE(name, stack_size)                      \
+    static StackType_t name##_stack[(stack_size) / sizeof(StackType_t)]; \
+    static StaticTask_t name##_tcb
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Application-owned tasks in the placement table
+ */
+typedef enum
+{
+    TASK_ID_APP_EXECUTOR = 0, //!< Application executor (buttons, relays, LEDs, MQTT scheduling)
+    TASK_ID_DISPLAY,          //!< Sensor sampling and OLED rendering
+    TASK_ID_DISPLAY_FLUSH,    //!< OLED page flushing
+    TASK_ID_DNS_SERVER,       //!< Captive portal DNS
+    TASK_ID_MQTT_PROBE,       //!< Broker RTT probing and failover
+    TASK_ID_HISTORY_FLUSH,    //!< Sensor history archive writes
+    TASK_ID_HISTORY_EXPORT,   //!< get_history block export
+    TASK_ID_OTA,              //!< Firmware update download, heap stack
+    TASK_ID_MAX
+} task_id_t;
+
+/**
+ * @brief Latency class a task's priority is derived from
+ */
+typedef enum
+{
+    TASK_CLASS_CONTROL = 0, //!< Input to actuator path, must preempt everything local
+    TASK_CLASS_SAMPLING,    //!< Periodic sampling and display refresh
+    TASK_CLASS_NETWORK,     //!< Request/response networking
+    TASK_CLASS_BACKGROUND,  //!< Deferrable bus and flash work
+} task_latency_class_t;
+
+/**
+ * @brief Placement table entry
+ */
+typedef struct
+{
+    const char *name;                   //!< Task name
+    uint32_t stack_size;                //!< Stack size in bytes
+    task_latency_class_t latency_class; //!< Latency class
+    UBaseType_t priority;               //!< Priority derived from latency class
+    BaseType_t core;                    //!< Core id or tskNO_AFFINITY
+} task_placement_t;
+
+/**
+ * @brief Registered task stack report entry
+ */
+typedef struct
+{
+    const char *name;      //!< Task name
+    uint32_t stack_size;   //!< Configured stack size in bytes
+    uint32_t stack_free;   //!< Minimum free stack seen so far in bytes
+    UBaseType_t priority;  //!< Task priority
+    BaseType_t core;       //!< Core id or tskNO_AFFINITY
+} task_registry_entry_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Get the placement of a task
+ *
+ * @param[in] id Task id
+ *
+ * @return Placement entry, NULL for an invalid id
+ */
+const task_placement_t *task_registry_get_placement(task_id_t id);
+
+/**
+ * @brief Create a task from static storage at its table placement
+ *
+ * Name, stack size, priority and core come from the placement table.
+ *
+ * @param[in] id Task id
+ * @param[in] task_fn Task entry function
+ * @param[in] arg Task argument
+ * @param[in] stack Stack buffer, at least the table stack size
+ * @param[in] tcb Task control block storage
+ * @param[out] out_handle Created task handle (may be NULL)
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE
+ *         (already running) or ESP_FAIL on error
+ */
+esp_err_t task_registry_create_static(task_id_t id, TaskFunction_t task_fn, void *arg,
+                                      StackType_t *stack, StaticTask_t *tcb,
+                                      TaskHandle_t *out_handle);
+
+/**
+ * @brief Create a task with a heap stack at its table placement
+ *
+ * For transient tasks whose stack should not stay reserved between runs.
+ * Name, stack size, priority and core come from the placement table. The
+ * task is registered after it is created; one that may end quickly should
+ * wait for a notification from its creator before it can call
+ * task_registry_remove().
+ *
+ * @param[in] id Task id
+ * @param[in] task_fn Task entry function
+ * @param[in] arg Task argument
+ * @param[out] out_handle Created task handle (may be NULL)
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE
+ *         (already running) or ESP_ERR_NO_MEM on error
+ */
+esp_err_t task_registry_create(task_id_t id, TaskFunction_t task_fn, void *arg,
+                               TaskHandle_t *out_handle);
+
+/**
+ * @brief Remove a task from the registry
+ *
+ * Call before the task is deleted so the report never touches a stale
+ * handle.
+ *
+ * @param[in] id Task id
+ */
+void task_registry_remove(task_id_t id);
+
+/**
+ * @brief Read the stack usage and placement of a registered task
+ *
+ * @param[in] id Task id
+ * @param[out] out Entry to fill
+ *
+ * @return ESP_OK if the task is running, ESP_ERR_NOT_FOUND if not
+ */
+esp_err_t task_registry_get(task_id_t id, task_registry_entry_t *out);
+
+/**
+ * @brief Compare stack high-water marks with configured sizes
+ *
+ * Logs one line per registered task with the peak use from
+ * uxTaskGetStackHighWaterMark and the stack size that peak calls for
+ * (plus TASK_REGISTRY_SIZE_MARGIN_PERCENT, rounded up to
+ * TASK_REGISTRY_SIZE_ALIGN), and warns for every task whose unused stack
+ * is below TASK_REGISTRY_HEADROOM_PERCENT of its configured size.
+ *
+ * @return Number of tasks below the headroom threshold
+ */
+int task_registry_check_stacks(void);
+
+#endif /* TASK_REGISTRY_H */
@@ -0,0 +1,226 @@
+/**
+ * @file task_registry.c
+ *
+ * @brief Static Task Registry Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "task_registry.h"
+#include "esp_log.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "TASK_REGISTRY";
+
+/**
+ * @brief Task placement table
+ *
+ * Networking shares core 0 with WiFi, lwIP and the MQTT client; local I/O
+ * (buttons, relays, sensors, display) owns core 1.
+ */
+static const task_placement_t placement_table[TASK_ID_MAX] = {
+    [TASK_ID_APP_EXECUTOR] = {"app_executor", TASK_STACK_APP_EXECUTOR, TASK_CLASS_CONTROL, TASK_PRIO_CONTROL, TASK_CORE_LOCAL},
+    [TASK_ID_DISPLAY] = {"display_task", TASK_STACK_DISPLAY, TASK_CLASS_SAMPLING, TASK_PRIO_SAMPLING, TASK_CORE_LOCAL},
+    [TASK_ID_DISPLAY_FLUSH] = {"display_flush", TASK_STACK_DISPLAY_FLUSH, TASK_CLASS_BACKGROUND, TASK_PRIO_BACKGROUND, TASK_CORE_LOCAL},
+    [TASK_ID_DNS_SERVER] = {"dns_server", TASK_STACK_DNS_SERVER, TASK_CLASS_NETWORK, TASK_PRIO_NETWORK, TASK_CORE_NETWORK},
+    [TASK_ID_MQTT_PROBE] = {"mqtt_probe", TASK_STACK_MQTT_PROBE, TASK_CLASS_BACKGROUND, TASK_PRIO_BACKGROUND, TASK_CORE_NETWORK},
+    [TASK_ID_HISTORY_FLUSH] = {"history_flush", TASK_STACK_HISTORY_FLUSH, TASK_CLASS_BACKGROUND, TASK_PRIO_BACKGROUND, TASK_CORE_NETWORK},
+    [TASK_ID_HISTORY_EXPORT] = {"history_export", TASK_STACK_HISTORY_EXPORT, TASK_CLASS_BACKGROUND, TASK_PRIO_BACKGROUND, TASK_CORE_NETWORK},
+    [TASK_ID_OTA] = {"ota", TASK_STACK_OTA, TASK_CLASS_BACKGROUND, TASK_PRIO_BACKGROUND, TASK_CORE_NETWORK},
+};
+
+static portMUX_TYPE registry_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t task_handles[TASK_ID_MAX];
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Get the placement of a task
+ */
+const task_placement_t *task_registry_get_placement(task_id_t id)
+{
+    if (id < 0 || id >= TASK_ID_MAX)
+    {
+        return NULL;
+    }
+
+    return &placement_table[id];
+}
+
+/**
+ * @brief Create a task from static storage at its table placement
+ */
+esp_err_t task_registry_create_static(task_id_t id, TaskFunction_t task_fn, void *arg,
+                                      StackType_t *stack, StaticTask_t *tcb,
+                                      TaskHandle_t *out_handle)
+{
+    const task_placement_t *placement = task_registry_get_placement(id);
+
+    if (placement == NULL || task_fn == NULL || stack == NULL || tcb == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (task_handles[id] != NULL)
+    {
+        ESP_LOGW(TAG, "Task %s already running", placement->name);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    TaskHandle_t handle = xTaskCreateStaticPinnedToCore(task_fn, placement->name,
+                                                        placement->stack_size, arg,
+                                                        placement->priority, stack,
+                                                        tcb, placement->core);
+    if (handle == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create task %s", placement->name);
+        return ESP_FAIL;
+    }
+
+    portENTER_CRITICAL(&registry_lock);
+    task_handles[id] = handle;
+    portEXIT_CRITICAL(&registry_lock);
+
+    if (out_handle != NULL)
+    {
+        *out_handle = handle;
+    }
+
+    ESP_LOGI(TAG, "Task %s created (stack=%lu, prio=%u, core=%d)",
+             placement->name, (unsigned long)placement->stack_size,
+             (unsigned)placement->priority,
+             placement->core == tskNO_AFFINITY ? -1 : (int)placement->core);
+    return ESP_OK;
+}
+
+/**
+ * @brief Create a task with a heap stack at its table placement
+ */
+esp_err_t task_registry_create(task_id_t id, TaskFunction_t task_fn, void *arg,
+                               TaskHandle_t *out_handle)
+{
+    const task_placement_t *placement = task_registry_get_placement(id);
+
+    if (placement == NULL || task_fn == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (task_handles[id] != NULL)
+    {
+        ESP_LOGW(TAG, "Task %s already running", placement->name);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    TaskHandle_t handle = NULL;
+
+    if (xTaskCreatePinnedToCore(task_fn, placement->name, placement->stack_size, arg,
+                                placement->priority, &handle, placement->core) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create task %s", placement->name);
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&registry_lock);
+    task_handles[id] = handle;
+    portEXIT_CRITICAL(&registry_lock);
+
+    if (out_handle != NULL)
+    {
+        *out_handle = handle;
+    }
+
+    ESP_LOGI(TAG, "Task %s created (heap stack=%lu, prio=%u, core=%d)",
+             placement->name, (unsigned long)placement->stack_size,
+             (unsigned)placement->priority,
+             placement->core == tskNO_AFFINITY ? -1 : (int)placement->core);
+    return ESP_OK;
+}
+
+/**
+ * @brief Remove a task from the registry
+ */
+void task_registry_remove(task_id_t id)
+{
+    if (id < 0 || id >= TASK_ID_MAX)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&registry_lock);
+    task_handles[id] = NULL;
+    portEXIT_CRITICAL(&registry_lock);
+}
+
+/**
+ * @brief Read the stack usage and placement of a registered task
+ */
+esp_err_t task_registry_get(task_id_t id, task_registry_entry_t *out)
+{
+    const task_placement_t *placement = task_registry_get_placement(id);
+
+    if (out == NULL || placement == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    TaskHandle_t handle;
+
+    portENTER_CRITICAL(&registry_lock);
+    handle = task_handles[id];
+    portEXIT_CRITICAL(&registry_lock);
+
+    if (handle == NULL)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    out->name = placement->name;
+    out->stack_size = placement->stack_size;
+    out->stack_free = uxTaskGetStackHighWaterMark(handle);
+    out->priority = placement->priority;
+    out->core = placement->core;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Compare stack high-water marks with configured sizes
+ */
+int task_registry_check_stacks(void)
+{
+    task_registry_entry_t entry;
+    int low = 0;
+
+    for (int id = 0; id < TASK_ID_MAX; id++)
+    {
+        if (task_registry_get((task_id_t)id, &entry) != ESP_OK)
+        {
+            continue;
+        }
+
+        uint32_t used = entry.stack_size - entry.stack_free;
+        uint32_t headroom_pct = (entry.stack_free * 100) / entry.stack_size;
+
+        // Size for the Kconfig default: peak use plus the margin, aligned
+        uint32_t size = used + (used * TASK_REGISTRY_SIZE_MARGIN_PERCENT) / 100;
+        size = (size + TASK_REGISTRY_SIZE_ALIGN - 1) / TASK_REGISTRY_SIZE_ALIGN * TASK_REGISTRY_SIZE_ALIGN;
+
+        if (headroom_pct < TASK_REGISTRY_HEADROOM_PERCENT)
+        {
+            ESP_LOGW(TAG, "Stack %s: used %lu of %lu bytes, only %lu%% free, size %lu",
+                     entry.name, (unsigned long)used,
+                     (unsigned long)entry.stack_size, (unsigned long)headroom_pct, (unsigned long)size);
+            low++;
+        }
+        else
+        {
+            ESP_LOGI(TAG, "Stack %s: used %lu of %lu bytes (%lu%% free), size %lu",
+                     entry.name, (unsigned long)used,
+                     (unsigned long)entry.stack_size, (unsigned long)headroom_pct, (unsigned long)size);
+        }
+    }
+
+    return low;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file bench.c
+ *
+ * @brief Microbenchmark Timing and Report Implementation
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#include "sdkconfig.h"
+#else
+#include <time.h>
+#endif
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_CALIBRATION_ROUNDS 64 //!< Empty start/stop pairs timed at init
+
+#ifdef ESP_PLATFORM
+#define BENCH_TARGET  CONFIG_IDF_TARGET
+#define BENCH_UNIT    "cycles"
+#define BENCH_CPU_MHZ CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#else
+#define BENCH_TARGET  "host"
+#define BENCH_UNIT    "ns"
+#define BENCH_CPU_MHZ 0
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint32_t samples[BENCH_ITERATIONS];
+static uint32_t sample_count = 0;
+static uint32_t warmup_left = 0;
+static uint32_t start_time = 0;
+static uint32_t overhead = 0;
+static const char *current_name = NULL;
+
+static bench_result_t results[BENCH_MAX_RESULTS];
+static uint32_t result_count = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Read the benchmark clock
+ *
+ * @return CPU cycles on target, nanoseconds on host (wrapping)
+ */
+static inline uint32_t bench_now(void);
+
+/**
+ * @brief qsort comparator for samples
+ */
+static int bench_compare(const void *a, const void *b);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Calibrate the timer overhead and clear all results
+ */
+void bench_init(void)
+{
+    uint32_t best = UINT32_MAX;
+
+    overhead = 0;
+    for (int i = 0; i < BENCH_CALIBRATION_ROUNDS; i++)
+    {
+        uint32_t t0 = bench_now();
+        uint32_t elapsed = bench_now() - t0;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    overhead = best;
+
+    result_count = 0;
+    current_name = NULL;
+}
+
+/**
+ * @brief Unit of all results
+ */
+const char *bench_unit(void)
+{
+    return BENCH_UNIT;
+}
+
+/**
+ * @brief Start a benchmark
+ */
+void bench_begin(const char *name)
+{
+    current_name = name;
+    sample_count = 0;
+    warmup_left = BENCH_WARMUP;
+}
+
+/**
+ * @brief Start timing one iteration
+ */
+void bench_start(void)
+{
+    start_time = bench_now();
+}
+
+/**
+ * @brief Stop timing one iteration
+ */
+void bench_stop(void)
+{
+    uint32_t elapsed = bench_now() - start_time;
+
+    if (warmup_left > 0)
+    {
+        warmup_left--;
+        return;
+    }
+
+    if (sample_count < BENCH_ITERATIONS)
+    {
+        samples[sample_count++] = elapsed > overhead ? elapsed - overhead : 0;
+    }
+}
+
+/**
+ * @brief Finish the running benchmark and store its result
+ */
+const bench_result_t *bench_end(void)
+{
+    if (current_name == NULL || sample_count == 0 || result_count >= BENCH_MAX_RESULTS)
+    {
+        current_name = NULL;
+        return NULL;
+    }
+
+    qsort(samples, sample_count, sizeof(samples[0]), bench_compare);
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < sample_count; i++)
+    {
+        sum += samples[i];
+    }
+
+    bench_result_t *r = &results[result_count++];
+    r->name = current_name;
+    r->samples = sample_count;
+    r->min = samples[0];
+    r->median = samples[sample_count / 2];
+    r->p90 = samples[(sample_count * 9) / 10];
+    r->max = samples[sample_count - 1];
+    r->mean = (uint32_t)(sum / sample_count);
+
+    current_name = NULL;
+    return r;
+}
+
+/**
+ * @brief Print the report of all finished benchmarks
+ */
+void bench_print_report(void)
+{
+    printf("BENCH_META {\"target\":\"%s\",\"unit\":\"%s\",\"cpu_mhz\":%d,\"overhead\":%lu,\"warmup\":%d}\n",
+           BENCH_TARGET, BENCH_UNIT, BENCH_CPU_MHZ, (unsigned long)overhead, BENCH_WARMUP);
+
+    for (uint32_t i = 0; i < result_count; i++)
+    {
+        const bench_result_t *r = &results[i];
+        printf("BENCH {\"name\":\"%s\",\"n\":%lu,\"min\":%lu,\"median\":%lu,\"p90\":%lu,\"max\":%lu,\"mean\":%lu}\n",
+               r->name, (unsigned long)r->samples, (unsigned long)r->min, (unsigned long)r->median,
+               (unsigned long)r->p90, (unsigned long)r->max, (unsigned long)r->mean);
+    }
+
+    fflush(stdout);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Read the benchmark clock
+ */
+static inline uint32_t bench_now(void)
+{
+#ifdef ESP_PLATFORM
+    return (uint32_t)esp_cpu_get_cycle_count();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+/**
+ * @brief qsort comparator for samples
+ */
+static int bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
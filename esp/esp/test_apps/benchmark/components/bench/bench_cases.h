@@ -0,0 +1,49 @@
+/**
+ * @file bench_cases.h
+ *
+ * @brief Benchmark Case Groups
+ *
+ * Each group runs its Unity test cases with RUN_TEST(). Every case times
+ * one hot path and checks its result, so a broken path fails instead of
+ * reporting a fast number.
+ */
+
+#ifndef BENCH_CASES_H
+#define BENCH_CASES_H
+
+/**
+ * @brief json_helper message builders and command parser
+ */
+void bench_json_cases(void);
+
+/**
+ * @brief MQTT and LAN API command dispatch
+ */
+void bench_command_cases(void);
+
+/**
+ * @brief Display rendering and panel flush
+ */
+void bench_display_cases(void);
+
+/**
+ * @brief Sensor decoding and RTC read
+ */
+void bench_sensor_cases(void);
+
+/**
+ * @brief history_codec block encoder and reader
+ */
+void bench_history_cases(void);
+
+/**
+ * @brief Print the blocks of the history round trip and their samples
+ *
+ * One "B <hex>" line per block, followed by one "S <timestamp> <temperature>
+ * <humidity> <light>" line per sample in raw units. Used by
+ * host/check_history_codec.py to run the broker decoder on the C encoder's
+ * output.
+ */
+void bench_history_print_vector(void);
+
+#endif /* BENCH_CASES_H */
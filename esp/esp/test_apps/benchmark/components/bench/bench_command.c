@@ -0,0 +1,147 @@
+/**
+ * @file bench_command.c
+ *
+ * @brief Command Dispatch Benchmarks
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "mqtt_callback.h"
+#include "json_helper.h"
+#include "unity.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *const command_json =
+    "{\"id\":\"c3d4\",\"command\":\"set_devices\",\"params\":{\"fan\":1,\"light\":0,\"ac\":1}}";
+
+// Arguments seen by the callbacks
+static int devices_calls = 0;
+static int last_fan = -1;
+static int filter_calls = 0;
+static int last_median = -1;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void on_set_devices(const char *cmd_id, int fan, int light, int ac);
+static void on_set_filter(const char *cmd_id, const char *channel, int median, double alpha);
+static void test_command_set_devices(void);
+static void test_command_set_filter(void);
+static void test_command_parse_dispatch(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief MQTT and LAN API command dispatch
+ */
+void bench_command_cases(void)
+{
+    // Callbacks only record, so the dispatch itself is timed
+    mqtt_callback_register_on_set_devices(on_set_devices);
+    mqtt_callback_register_on_set_filter(on_set_filter);
+
+    RUN_TEST(test_command_set_devices);
+    RUN_TEST(test_command_set_filter);
+    RUN_TEST(test_command_parse_dispatch);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Recording set_devices callback
+ */
+static void on_set_devices(const char *cmd_id, int fan, int light, int ac)
+{
+    (void)cmd_id;
+    (void)light;
+    (void)ac;
+    devices_calls++;
+    last_fan = fan;
+}
+
+/**
+ * @brief Recording set_filter callback
+ */
+static void on_set_filter(const char *cmd_id, const char *channel, int median, double alpha)
+{
+    (void)cmd_id;
+    (void)channel;
+    (void)alpha;
+    filter_calls++;
+    last_median = median;
+}
+
+/**
+ * @brief Dispatch of an early branch with three parameters
+ */
+static void test_command_set_devices(void)
+{
+    cJSON *params = cJSON_Parse("{\"fan\":1,\"light\":0,\"ac\":1}");
+    TEST_ASSERT_NOT_NULL(params);
+
+    devices_calls = 0;
+    bench_begin("command_set_devices");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        mqtt_callback_handle_command("c3d4", "set_devices", params);
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+    cJSON_Delete(params);
+
+    TEST_ASSERT_EQUAL_INT(BENCH_ROUNDS, devices_calls);
+    TEST_ASSERT_EQUAL_INT(1, last_fan);
+}
+
+/**
+ * @brief Dispatch of the last branch, every strcmp before it fails
+ */
+static void test_command_set_filter(void)
+{
+    cJSON *params = cJSON_Parse("{\"channel\":\"temperature\",\"median\":5,\"alpha\":0.25}");
+    TEST_ASSERT_NOT_NULL(params);
+
+    filter_calls = 0;
+    bench_begin("command_set_filter");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        mqtt_callback_handle_command("c3d4", "set_filter", params);
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+    cJSON_Delete(params);
+
+    TEST_ASSERT_EQUAL_INT(BENCH_ROUNDS, filter_calls);
+    TEST_ASSERT_EQUAL_INT(5, last_median);
+}
+
+/**
+ * @brief Payload to callback, as mqtt_manager runs it per message
+ */
+static void test_command_parse_dispatch(void)
+{
+    char cmd_id[16];
+    char command[32];
+
+    devices_calls = 0;
+    bench_begin("command_parse_dispatch");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        cJSON *root = json_helper_parse_command(command_json, cmd_id, sizeof(cmd_id),
+                                                command, sizeof(command));
+        if (root != NULL)
+        {
+            mqtt_callback_handle_command(cmd_id, command, cJSON_GetObjectItem(root, "params"));
+            cJSON_Delete(root);
+        }
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+
+    TEST_ASSERT_EQUAL_INT(BENCH_ROUNDS, devices_calls);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file bench_display.c
+ *
+ * @brief Display Benchmarks
+ *
+ * draw_text() is private to task_display; it is timed through
+ * task_display_show_message(), which is one draw_text() call between a
+ * buffer clear and the frame hand-off.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "bench_fixture.h"
+#include "task_display.h"
+#include "unity.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static bool display_ready = false;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void test_sh1106_update_display(void);
+static void test_display_show_message(void);
+static void test_display_render_full_ui(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Display rendering and panel flush
+ */
+void bench_display_cases(void)
+{
+    bench_fixture_init();
+
+    // Full frame over the bus first, before the flush task is started
+    RUN_TEST(test_sh1106_update_display);
+
+    if (!display_ready && bench_fixture_panel() != NULL)
+    {
+        display_ready = task_display_init() == ESP_OK;
+    }
+
+    RUN_TEST(test_display_show_message);
+    RUN_TEST(test_display_render_full_ui);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Write all eight pages of the frame buffer
+ */
+static void test_sh1106_update_display(void)
+{
+    sh1106_t *panel = bench_fixture_panel();
+    if (panel == NULL)
+    {
+        TEST_IGNORE_MESSAGE("No SH1106 panel");
+    }
+
+    bench_begin("sh1106_update_display");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        esp_err_t ret = sh1106_update_display(panel);
+        bench_stop();
+
+        TEST_ASSERT_EQUAL(ESP_OK, ret);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Centered text line (draw_text path)
+ */
+static void test_display_show_message(void)
+{
+    if (!display_ready)
+    {
+        TEST_IGNORE_MESSAGE("Display not initialized");
+    }
+
+    bench_begin("display_show_message");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        task_display_show_message("CONNECTING 12.5");
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Complete UI frame, rendered once per sample period
+ */
+static void test_display_render_full_ui(void)
+{
+    if (!display_ready)
+    {
+        TEST_IGNORE_MESSAGE("Display not initialized");
+    }
+
+    display_data_t data = {
+        .hour = 12,
+        .minute = 34,
+        .second = 0,
+        .temperature = 23.4f,
+        .humidity = 51.2f,
+        .light = 312.0f,
+        .version = "1.0",
+        .interval = 5,
+    };
+
+    bench_begin("display_render_full_ui");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        // A new second every frame, as on the device
+        data.second = i % 60;
+
+        bench_start();
+        task_display_render_full_ui(&data);
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
@@ -0,0 +1,63 @@
+/**
+ * @file bench_fixture.c
+ *
+ * @brief Devices for the I2C Benchmarks on the Target
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench_fixture.h"
+#include "sensor_manager.h"
+#include "ds3231_sensor.h"
+#include "esp_log.h"
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *TAG = "BENCH_FIXTURE";
+
+static bool fixture_ready = false;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Bring up the bus and the devices
+ */
+void bench_fixture_init(void)
+{
+    if (fixture_ready)
+    {
+        return;
+    }
+
+    // Fails with no sensor attached; the panel may still be up
+    esp_err_t ret = sensor_manager_init_default();
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Sensor manager: %s", esp_err_to_name(ret));
+    }
+
+    fixture_ready = true;
+}
+
+/**
+ * @brief Get the SH1106 panel
+ */
+sh1106_t *bench_fixture_panel(void)
+{
+    return sensor_manager_get_display_device();
+}
+
+/**
+ * @brief Get the DS3231 RTC
+ */
+ds3231_t *bench_fixture_rtc(void)
+{
+    sensor_status_t status;
+
+    if (sensor_manager_get_status(&status) != ESP_OK || !status.ds3231_ok)
+    {
+        return NULL;
+    }
+
+    return ds3231_sensor_get_device();
+}
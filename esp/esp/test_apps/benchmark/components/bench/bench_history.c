@@ -0,0 +1,362 @@
+/**
+ * @file bench_history.c
+ *
+ * @brief history_codec Benchmarks
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "history_codec.h"
+#include "unity.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define HISTORY_SAMPLES     300 //!< Samples of the round-trip run, several blocks
+#define HISTORY_BLOCK_BYTES 256 //!< Block capacity, as small as an MQTT chunk
+
+// Archive of one day at the 5 s publish interval, laid out as history_archive
+// writes it: one record per flush batch, split where a page fills up
+#define HISTORY_DAY_SAMPLES     17280 //!< One day at 5 s
+#define HISTORY_BATCH_SAMPLES   180   //!< Default CONFIG_SENSOR_HISTORY_FLUSH_SAMPLES
+#define HISTORY_PAGE_BYTES      4096  //!< Flash sector
+#define HISTORY_PAGE_HEADER     16    //!< Magic, sequence, first timestamp, CRC
+#define HISTORY_RECORD_HEADER   8     //!< Length, reserved, CRC
+#define HISTORY_RECORD_MIN      64    //!< Smaller remainders close the page
+#define HISTORY_DAY_MAX_BYTES   (HISTORY_DAY_SAMPLES * 3) //!< Regression bound, 3 bytes per sample
+
+/* Private variables ---------------------------------------------------------*/
+
+static history_sample_t samples[HISTORY_SAMPLES];
+static uint8_t block[HISTORY_BLOCK_BYTES];
+static history_sample_t batch[HISTORY_BATCH_SAMPLES];
+static uint8_t record[HISTORY_PAGE_BYTES];
+
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief Fill samples with a fixed series that exercises every prefix class
+ *
+ * One minute cadence with jitter, a three day gap, a run of identical
+ * samples, sub-zero temperatures and light jumps over the 12 bit class.
+ */
+static void history_make_samples(void);
+
+/**
+ * @brief Fill a flush batch of the 5 s series
+ *
+ * Indoor readings with sensor noise around a slow drift: a few hundredths
+ * of a degree and of a percent, a couple of lux, and a timestamp one
+ * second late now and then. The series continues across calls.
+ *
+ * @param[out] batch Destination
+ * @param[in] n Samples to fill
+ */
+static void history_make_cadence_samples(history_sample_t *batch, size_t n);
+
+/**
+ * @brief Compare a decoded sample with the original
+ *
+ * @param[in] expected Encoded sample
+ * @param[in] actual Decoded sample
+ */
+static void history_assert_sample(const history_sample_t *expected, const history_sample_t *actual);
+
+static void test_history_codec_roundtrip(void);
+static void test_history_codec_encode(void);
+static void test_history_codec_decode(void);
+static void test_history_codec_archive_day(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief history_codec block encoder and reader
+ */
+void bench_history_cases(void)
+{
+    history_make_samples();
+
+    RUN_TEST(test_history_codec_roundtrip);
+    RUN_TEST(test_history_codec_encode);
+    RUN_TEST(test_history_codec_decode);
+    RUN_TEST(test_history_codec_archive_day);
+}
+
+/**
+ * @brief Print the round-trip blocks and their samples
+ */
+void bench_history_print_vector(void)
+{
+    size_t done = 0;
+    uint16_t seq = 0;
+
+    history_make_samples();
+
+    while (done < HISTORY_SAMPLES)
+    {
+        size_t len = 0;
+        size_t encoded = 0;
+
+        if (history_codec_encode(&samples[done], HISTORY_SAMPLES - done, seq, block, sizeof(block),
+                                 &len, &encoded) != ESP_OK || encoded == 0)
+        {
+            return;
+        }
+
+        printf("B ");
+        for (size_t i = 0; i < len; i++)
+        {
+            printf("%02x", block[i]);
+        }
+        printf("\n");
+
+        for (size_t i = done; i < done + encoded; i++)
+        {
+            printf("S %lu %d %u %u\n", (unsigned long)samples[i].timestamp, samples[i].temperature,
+                   samples[i].humidity, samples[i].light);
+        }
+
+        done += encoded;
+        seq++;
+    }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Fill samples with a fixed series that exercises every prefix class
+ */
+static void history_make_samples(void)
+{
+    uint32_t seed = 12345;
+    uint32_t timestamp = 1760700000u;
+    int32_t temperature = 2150;
+    int32_t humidity = 5120;
+    int32_t light = 300;
+
+    for (int i = 0; i < HISTORY_SAMPLES; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        uint32_t r = seed >> 16;
+
+        if (i == 150)
+        {
+            timestamp += 3 * 24 * 3600;
+        }
+        else if (i < 40 || i >= 60)
+        {
+            timestamp += 60 + (r % 17) - 8;
+        }
+        else
+        {
+            timestamp += 60;
+        }
+
+        // Samples 40..59 repeat, every delta is a zero bit
+        if (i < 40 || i >= 60)
+        {
+            temperature += (int32_t)(r % 41) - 20;
+            humidity += (int32_t)((r >> 6) % 61) - 30;
+            light += (int32_t)((r >> 4) % 21) - 10;
+        }
+
+        if (i == 100)
+        {
+            temperature = -1850;
+        }
+        if (i % 50 == 25)
+        {
+            light = (light > 30000) ? 120 : 65000;
+        }
+
+        humidity = (humidity < 0) ? 0 : (humidity > 10000) ? 10000 : humidity;
+        light = (light < 0) ? 0 : (light > 65535) ? 65535 : light;
+
+        samples[i].timestamp = timestamp;
+        samples[i].temperature = (int16_t)temperature;
+        samples[i].humidity = (uint16_t)humidity;
+        samples[i].light = (uint16_t)light;
+    }
+}
+
+/**
+ * @brief Fill a flush batch of the 5 s series
+ */
+static void history_make_cadence_samples(history_sample_t *batch, size_t n)
+{
+    static uint32_t seed = 54321;
+    static uint32_t timestamp = 1760700000u;
+    static uint32_t tick = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        uint32_t r = seed >> 16;
+
+        timestamp += (r % 16 == 0) ? 6 : 5;
+        tick++;
+
+        // Drift of 0.01 degC and 0.05 %RH every minute, light follows a ramp
+        int32_t temperature = 2150 + (int32_t)((tick / 12) % 200) + (int32_t)(r % 7) - 3;
+        int32_t humidity = 5120 - (int32_t)((tick / 12) % 100) * 5 + (int32_t)((r >> 3) % 21) - 10;
+        int32_t light = 300 + (int32_t)((tick / 60) % 120) + (int32_t)((r >> 8) % 5) - 2;
+
+        batch[i].timestamp = timestamp;
+        batch[i].temperature = (int16_t)temperature;
+        batch[i].humidity = (uint16_t)humidity;
+        batch[i].light = (uint16_t)light;
+    }
+}
+
+/**
+ * @brief Compare a decoded sample with the original
+ */
+static void history_assert_sample(const history_sample_t *expected, const history_sample_t *actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(expected->timestamp, actual->timestamp);
+    TEST_ASSERT_EQUAL_INT16(expected->temperature, actual->temperature);
+    TEST_ASSERT_EQUAL_UINT16(expected->humidity, actual->humidity);
+    TEST_ASSERT_EQUAL_UINT16(expected->light, actual->light);
+}
+
+/**
+ * @brief Every sample decodes back unchanged, across several blocks
+ */
+static void test_history_codec_roundtrip(void)
+{
+    history_codec_reader_t reader;
+    history_sample_t sample;
+    size_t done = 0;
+    uint16_t seq = 0;
+
+    while (done < HISTORY_SAMPLES)
+    {
+        size_t len = 0;
+        size_t encoded = 0;
+
+        TEST_ASSERT_EQUAL(ESP_OK, history_codec_encode(&samples[done], HISTORY_SAMPLES - done, seq, block,
+                                                       sizeof(block), &len, &encoded));
+        TEST_ASSERT_GREATER_THAN(0, encoded);
+        TEST_ASSERT_LESS_OR_EQUAL(sizeof(block), len);
+
+        // A block cut inside its header is rejected, not read past its end
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE,
+                          history_codec_reader_init(&reader, block, HISTORY_CODEC_HEADER_LEN - 1));
+
+        TEST_ASSERT_EQUAL(ESP_OK, history_codec_reader_init(&reader, block, len));
+        for (size_t i = done; i < done + encoded; i++)
+        {
+            TEST_ASSERT_TRUE(history_codec_reader_next(&reader, &sample));
+            history_assert_sample(&samples[i], &sample);
+        }
+        TEST_ASSERT_FALSE(history_codec_reader_next(&reader, &sample));
+
+        done += encoded;
+        seq++;
+    }
+
+    TEST_ASSERT_GREATER_THAN(1, seq);
+}
+
+/**
+ * @brief Encode one full block, as done per get_history chunk
+ */
+static void test_history_codec_encode(void)
+{
+    size_t len = 0;
+    size_t encoded = 0;
+
+    bench_begin("history_codec_encode");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        esp_err_t ret = history_codec_encode(samples, HISTORY_SAMPLES, 0, block, sizeof(block), &len, &encoded);
+        bench_stop();
+
+        TEST_ASSERT_EQUAL(ESP_OK, ret);
+        TEST_ASSERT_GREATER_THAN(0, encoded);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Validate and read back one full block
+ */
+static void test_history_codec_decode(void)
+{
+    history_codec_reader_t reader;
+    history_sample_t sample;
+    size_t len = 0;
+    size_t encoded = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, history_codec_encode(samples, HISTORY_SAMPLES, 0, block, sizeof(block),
+                                                   &len, &encoded));
+
+    bench_begin("history_codec_decode");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        size_t read = 0;
+
+        bench_start();
+        esp_err_t ret = history_codec_reader_init(&reader, block, len);
+        while (ret == ESP_OK && history_codec_reader_next(&reader, &sample))
+        {
+            read++;
+        }
+        bench_stop();
+
+        TEST_ASSERT_EQUAL(ESP_OK, ret);
+        TEST_ASSERT_EQUAL(encoded, read);
+        history_assert_sample(&samples[encoded - 1], &sample);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Archive size of one day at the 5 s interval, headers included
+ */
+static void test_history_codec_archive_day(void)
+{
+    size_t offset = HISTORY_PAGE_BYTES;
+    uint32_t pages = 0;
+    uint32_t bytes = 0;
+
+    for (size_t day = 0; day < HISTORY_DAY_SAMPLES; day += HISTORY_BATCH_SAMPLES)
+    {
+        size_t done = 0;
+
+        history_make_cadence_samples(batch, HISTORY_BATCH_SAMPLES);
+
+        while (done < HISTORY_BATCH_SAMPLES)
+        {
+            size_t len = 0;
+            size_t encoded = 0;
+
+            if (HISTORY_PAGE_BYTES - offset < HISTORY_RECORD_HEADER + HISTORY_RECORD_MIN)
+            {
+                bytes += (uint32_t)(HISTORY_PAGE_BYTES - offset);
+                offset = HISTORY_PAGE_HEADER;
+                bytes += HISTORY_PAGE_HEADER;
+                pages++;
+            }
+
+            TEST_ASSERT_EQUAL(ESP_OK, history_codec_encode(&batch[done], HISTORY_BATCH_SAMPLES - done, 0, record,
+                                                           HISTORY_PAGE_BYTES - offset - HISTORY_RECORD_HEADER,
+                                                           &len, &encoded));
+            TEST_ASSERT_GREATER_THAN(0, encoded);
+
+            offset += HISTORY_RECORD_HEADER + len;
+            bytes += (uint32_t)(HISTORY_RECORD_HEADER + len);
+            done += encoded;
+        }
+    }
+
+    printf("history_codec: %d samples at 5 s in %lu bytes, %lu pages, %lu.%02lu bytes per sample\n",
+           HISTORY_DAY_SAMPLES, (unsigned long)bytes, (unsigned long)pages,
+           (unsigned long)(bytes / HISTORY_DAY_SAMPLES),
+           (unsigned long)(bytes * 100 / HISTORY_DAY_SAMPLES % 100));
+
+    TEST_ASSERT_LESS_OR_EQUAL(HISTORY_DAY_MAX_BYTES, bytes);
+}
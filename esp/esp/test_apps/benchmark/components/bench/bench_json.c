@@ -0,0 +1,217 @@
+/**
+ * @file bench_json.c
+ *
+ * @brief json_helper Benchmarks
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "json_helper.h"
+#include "esp_wifi.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define SCAN_AP_COUNT 10 //!< Access points in the scan result benchmark
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char *const command_json =
+    "{\"id\":\"a1b2\",\"command\":\"set_devices\",\"params\":{\"fan\":1,\"light\":0,\"ac\":1}}";
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void test_json_create_data(void);
+static void test_json_create_state(void);
+static void test_json_create_info(void);
+static void test_json_create_response(void);
+static void test_json_create_wifi_scan_result(void);
+static void test_json_create_wifi_status(void);
+static void test_json_create_simple_response(void);
+static void test_json_parse_command(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief json_helper message builders and command parser
+ */
+void bench_json_cases(void)
+{
+    RUN_TEST(test_json_create_data);
+    RUN_TEST(test_json_create_state);
+    RUN_TEST(test_json_create_info);
+    RUN_TEST(test_json_create_response);
+    RUN_TEST(test_json_create_wifi_scan_result);
+    RUN_TEST(test_json_create_wifi_status);
+    RUN_TEST(test_json_create_simple_response);
+    RUN_TEST(test_json_parse_command);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Sensor data message, published every interval
+ */
+static void test_json_create_data(void)
+{
+    bench_begin("json_create_data");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_data(1760700000u + i, 23.45f, 51.20f, 312);
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Device state message, published on every change
+ */
+static void test_json_create_state(void)
+{
+    bench_begin("json_create_state");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_state(1760700000u + i, 1, 5000, i & 1, 0, 1);
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Device info message, published on connect
+ */
+static void test_json_create_info(void)
+{
+    bench_begin("json_create_info");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_info(1760700000u + i, "esp_02", "HomeNetwork",
+                                             "192.168.1.42", "broker.local", "1.0");
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Command response, one per command
+ */
+static void test_json_create_response(void)
+{
+    bench_begin("json_create_response");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_response("a1b2", "success");
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Provisioning scan list
+ */
+static void test_json_create_wifi_scan_result(void)
+{
+    static wifi_ap_record_t aps[SCAN_AP_COUNT];
+
+    for (int i = 0; i < SCAN_AP_COUNT; i++)
+    {
+        memset(&aps[i], 0, sizeof(aps[i]));
+        snprintf((char *)aps[i].ssid, sizeof(aps[i].ssid), "Network_%02d", i);
+        aps[i].rssi = (int8_t)(-40 - i * 4);
+        aps[i].authmode = WIFI_AUTH_WPA2_PSK;
+    }
+
+    bench_begin("json_create_wifi_scan_result");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_wifi_scan_result(aps, SCAN_AP_COUNT);
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Provisioning status
+ */
+static void test_json_create_wifi_status(void)
+{
+    bench_begin("json_create_wifi_status");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_wifi_status(true, true, "192.168.1.42", -52);
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Provisioning response
+ */
+static void test_json_create_simple_response(void)
+{
+    bench_begin("json_create_simple_response");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        char *json = json_helper_create_simple_response("ok", "Connecting...");
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(json);
+        cJSON_free(json);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+}
+
+/**
+ * @brief Incoming command parse, one per command
+ */
+static void test_json_parse_command(void)
+{
+    char cmd_id[16];
+    char command[32];
+
+    bench_begin("json_parse_command");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        cJSON *root = json_helper_parse_command(command_json, cmd_id, sizeof(cmd_id),
+                                                command, sizeof(command));
+        bench_stop();
+
+        TEST_ASSERT_NOT_NULL(root);
+        cJSON_Delete(root);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+
+    TEST_ASSERT_EQUAL_STRING("a1b2", cmd_id);
+    TEST_ASSERT_EQUAL_STRING("set_devices", command);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file bench_runner.c
+ *
+ * @brief Benchmark Runner
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "esp_log.h"
+#include "unity.h"
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Run every benchmark under Unity and print the report
+ */
+int bench_run_all(void)
+{
+    // INFO lines would be timed as console output, not as the code under test
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    bench_init();
+
+    UNITY_BEGIN();
+    bench_json_cases();
+    bench_command_cases();
+    bench_sensor_cases();
+    bench_display_cases();
+    bench_history_cases();
+    int failures = UNITY_END();
+
+    bench_print_report();
+
+    return failures;
+}
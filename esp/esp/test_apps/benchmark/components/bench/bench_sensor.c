@@ -0,0 +1,113 @@
+/**
+ * @file bench_sensor.c
+ *
+ * @brief Sensor Benchmarks
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include "bench_fixture.h"
+#include "sht3x.h"
+#include "unity.h"
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void test_sht3x_crc8(void);
+static void test_sht3x_compute_values(void);
+static void test_ds3231_get_timestamp(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Sensor decoding and RTC read
+ */
+void bench_sensor_cases(void)
+{
+    bench_fixture_init();
+
+    RUN_TEST(test_sht3x_crc8);
+    RUN_TEST(test_sht3x_compute_values);
+    RUN_TEST(test_ds3231_get_timestamp);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief CRC of both words of a measurement, as checked per read
+ */
+static void test_sht3x_crc8(void)
+{
+    // Datasheet example: 0xBEEF -> 0x92
+    const uint8_t word[2] = {0xBE, 0xEF};
+    TEST_ASSERT_EQUAL_HEX8(0x92, sht3x_crc8(word, 2));
+
+    const uint8_t raw[6] = {0x66, 0x5C, 0x00, 0x83, 0x3A, 0x00};
+    volatile uint8_t sink = 0;
+
+    bench_begin("sht3x_crc8");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        sink ^= sht3x_crc8(raw, 2);
+        sink ^= sht3x_crc8(raw + 3, 2);
+        bench_stop();
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+    (void)sink;
+}
+
+/**
+ * @brief Raw words to temperature and humidity
+ */
+static void test_sht3x_compute_values(void)
+{
+    sht3x_raw_data_t raw = {0x66, 0x5C, 0x00, 0x83, 0x3A, 0x00};
+    float temperature = 0.0f;
+    float humidity = 0.0f;
+
+    raw[2] = sht3x_crc8(raw, 2);
+    raw[5] = sht3x_crc8(raw + 3, 2);
+
+    bench_begin("sht3x_compute_values");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        esp_err_t ret = sht3x_compute_values(raw, &temperature, &humidity);
+        bench_stop();
+
+        TEST_ASSERT_EQUAL(ESP_OK, ret);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+
+    // 0x665C -> 25.0 C, 0x833A -> 51.3 %RH
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 25.0f, temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 51.3f, humidity);
+}
+
+/**
+ * @brief Time registers to Unix timestamp
+ */
+static void test_ds3231_get_timestamp(void)
+{
+    ds3231_t *rtc = bench_fixture_rtc();
+    if (rtc == NULL)
+    {
+        TEST_IGNORE_MESSAGE("No DS3231 RTC");
+    }
+
+    uint32_t timestamp = 0;
+
+    bench_begin("ds3231_get_timestamp");
+    for (int i = 0; i < BENCH_ROUNDS; i++)
+    {
+        bench_start();
+        esp_err_t ret = ds3231_get_timestamp(rtc, &timestamp);
+        bench_stop();
+
+        TEST_ASSERT_EQUAL(ESP_OK, ret);
+    }
+    TEST_ASSERT_NOT_NULL(bench_end());
+    TEST_ASSERT_NOT_EQUAL(0, timestamp);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file bench.h
+ *
+ * @brief Microbenchmark Timing and Report API
+ *
+ * Times a code section over many iterations and keeps min, median, p90,
+ * max and mean. On the target the clock is the CPU cycle counter; on the
+ * host build it is CLOCK_MONOTONIC in nanoseconds. The timer overhead
+ * measured at bench_init() is subtracted from every sample.
+ *
+ * The report is one line per benchmark, prefixed with "BENCH " and
+ * followed by a JSON object, so it can be cut out of the console log with
+ * grep and compared with tools/bench_compare.py.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define BENCH_ITERATIONS  200 //!< Recorded iterations per benchmark
+#define BENCH_WARMUP      8   //!< Leading iterations not recorded
+#define BENCH_MAX_RESULTS 32  //!< Benchmarks kept for the report
+
+#define BENCH_ROUNDS (BENCH_WARMUP + BENCH_ITERATIONS) //!< Loop count of a benchmark
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief Result of one benchmark in bench_unit() units
+ */
+typedef struct
+{
+    const char *name; //!< Benchmark name
+    uint32_t samples; //!< Recorded iterations
+    uint32_t min;     //!< Fastest iteration
+    uint32_t median;  //!< Median iteration
+    uint32_t p90;     //!< 90th percentile
+    uint32_t max;     //!< Slowest iteration
+    uint32_t mean;    //!< Mean of all iterations
+} bench_result_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Calibrate the timer overhead and clear all results
+ */
+void bench_init(void);
+
+/**
+ * @brief Unit of all results ("cycles" on target, "ns" on host)
+ *
+ * @return Unit name
+ */
+const char *bench_unit(void);
+
+/**
+ * @brief Start a benchmark
+ *
+ * Iterations are timed between bench_start() and bench_stop() until
+ * bench_end(). The first BENCH_WARMUP iterations warm caches and are
+ * discarded, so benchmarks loop BENCH_ROUNDS times.
+ *
+ * @param[in] name Benchmark name, must outlive the report
+ */
+void bench_begin(const char *name);
+
+/**
+ * @brief Start timing one iteration
+ */
+void bench_start(void);
+
+/**
+ * @brief Stop timing one iteration
+ */
+void bench_stop(void);
+
+/**
+ * @brief Finish the running benchmark and store its result
+ *
+ * @return Result, NULL if no iteration was recorded or the table is full
+ */
+const bench_result_t *bench_end(void);
+
+/**
+ * @brief Print the report of all finished benchmarks
+ */
+void bench_print_report(void);
+
+/**
+ * @brief Run every benchmark under Unity and print the report
+ *
+ * @return Number of failed test cases
+ */
+int bench_run_all(void);
+
+#endif /* BENCH_H */
@@ -0,0 +1,43 @@
+/**
+ * @file bench_fixture.h
+ *
+ * @brief Devices for the I2C Benchmarks
+ *
+ * On the target the devices come from sensor_manager on the real bus and
+ * may be missing; their benchmarks are then ignored. The host build
+ * provides the same devices on a simulated bus, so only the driver's own
+ * work is timed there.
+ */
+
+#ifndef BENCH_FIXTURE_H
+#define BENCH_FIXTURE_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "ds3231.h"
+#include "sh1106.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Bring up the bus and the devices
+ *
+ * Safe to call more than once.
+ */
+void bench_fixture_init(void);
+
+/**
+ * @brief Get the SH1106 panel
+ *
+ * @return Panel descriptor, NULL if no panel answered
+ */
+sh1106_t *bench_fixture_panel(void);
+
+/**
+ * @brief Get the DS3231 RTC
+ *
+ * @return RTC descriptor, NULL if no RTC answered
+ */
+ds3231_t *bench_fixture_rtc(void);
+
+#endif /* BENCH_FIXTURE_H */
@@ -0,0 +1,59 @@
+/**
+ * @file bench_fixture_host.c
+ *
+ * @brief Devices for the I2C Benchmarks on the Simulated Bus
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench_fixture.h"
+#include "i2cdev_host.h"
+#include "i2cdev_config.h"
+#include <stdbool.h>
+
+/* Private variables ---------------------------------------------------------*/
+
+static sh1106_t panel;
+static ds3231_t rtc;
+static bool fixture_ready = false;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Attach the panel and the RTC and preload the clock
+ */
+void bench_fixture_init(void)
+{
+    if (fixture_ready)
+    {
+        return;
+    }
+
+    sh1106_init_desc(&panel, SH1106_I2C_ADDR_DEFAULT, 0, I2C_MASTER_SDA_PIN, I2C_MASTER_SCL_PIN);
+    i2c_dev_init(&panel.i2c_dev);
+
+    ds3231_init_desc(&rtc, 0, I2C_MASTER_SDA_PIN, I2C_MASTER_SCL_PIN);
+    i2c_dev_init(&rtc.i2c_dev);
+
+    // 2026-10-17 12:34:56, 24-hour mode, BCD
+    const uint8_t time_regs[7] = {0x56, 0x34, 0x12, 0x07, 0x17, 0x10, 0x26};
+    i2cdev_host_load(DS3231_ADDR, 0x00, time_regs, sizeof(time_regs));
+
+    fixture_ready = true;
+}
+
+/**
+ * @brief Get the SH1106 panel
+ */
+sh1106_t *bench_fixture_panel(void)
+{
+    return fixture_ready ? &panel : NULL;
+}
+
+/**
+ * @brief Get the DS3231 RTC
+ */
+ds3231_t *bench_fixture_rtc(void)
+{
+    return fixture_ready ? &rtc : NULL;
+}
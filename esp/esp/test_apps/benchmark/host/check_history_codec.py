@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+Module: check_history_codec.py
+
+Checks that the broker's history decoder reads the blocks the firmware's
+history_codec encoder writes. The host benchmark binary prints its round-trip
+blocks and their samples (--history-vector); every block is decoded with
+broker/smart_home_scripts/history_codec.py and compared sample by sample.
+
+Usage: check_history_codec.py BENCHMARK_HOST
+"""
+
+import os
+import subprocess
+import sys
+
+SCRIPTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           "..", "..", "..", "..", "..", "broker", "smart_home_scripts")
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.normpath(SCRIPTS_DIR))
+
+from history_codec import decode_block  # noqa: E402
+
+
+def read_vector(binary):
+    """Run the benchmark binary and return [(block bytes, [sample tuples])]."""
+    output = subprocess.run([binary, "--history-vector"], check=True,
+                            capture_output=True, text=True).stdout
+
+    blocks = []
+    for line in output.splitlines():
+        if line.startswith("B "):
+            blocks.append((bytes.fromhex(line[2:]), []))
+        elif line.startswith("S ") and blocks:
+            blocks[-1][1].append(tuple(int(field) for field in line[2:].split()))
+    return blocks
+
+
+def main(binary):
+    blocks = read_vector(binary)
+    if len(blocks) < 2:
+        print(f"expected several blocks, got {len(blocks)}")
+        return 1
+
+    total = 0
+    for seq, (payload, expected) in enumerate(blocks):
+        block = decode_block(payload)
+        if block.seq != seq or len(block.samples) != len(expected):
+            print(f"block {seq}: seq {block.seq}, {len(block.samples)} samples, "
+                  f"expected {len(expected)}")
+            return 1
+
+        for index, (sample, raw) in enumerate(zip(block.samples, expected)):
+            decoded = (sample["timestamp"], round(sample["temperature"] * 100),
+                       round(sample["humidity"] * 100), sample["light"])
+            if decoded != raw:
+                print(f"block {seq} sample {index}: decoded {decoded}, encoded {raw}")
+                return 1
+        total += len(expected)
+
+    print(f"{total} samples in {len(blocks)} blocks decoded as encoded")
+    return 0
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(2)
+    sys.exit(main(sys.argv[1]))
@@ -0,0 +1,84 @@
+/**
+ * @file firmware_fakes.c
+ *
+ * @brief Stand-ins for the Firmware Modules the Benchmarked Code Calls
+ *
+ * Only the functions the benchmarked modules link against are here: the
+ * MQTT and LAN API registrations, the display lookup and the task registry.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench_fixture.h"
+#include "mqtt_manager.h"
+#include "local_api.h"
+#include "sensor_manager.h"
+#include "task_registry.h"
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief No broker on the host
+ */
+esp_err_t mqtt_manager_publish_response(const char *cmd_id, const char *status)
+{
+    (void)cmd_id;
+    (void)status;
+    return ESP_OK;
+}
+
+/**
+ * @brief Registration only
+ */
+void mqtt_manager_register_command_callback(mqtt_command_callback_t callback)
+{
+    (void)callback;
+}
+
+/**
+ * @brief Registration only
+ */
+void mqtt_manager_register_connected_callback(mqtt_event_callback_t callback)
+{
+    (void)callback;
+}
+
+/**
+ * @brief Registration only
+ */
+void mqtt_manager_register_disconnected_callback(mqtt_event_callback_t callback)
+{
+    (void)callback;
+}
+
+/**
+ * @brief Registration only
+ */
+void local_api_register_command_callback(local_api_command_callback_t callback)
+{
+    (void)callback;
+}
+
+/**
+ * @brief The simulated panel
+ */
+sh1106_t *sensor_manager_get_display_device(void)
+{
+    return bench_fixture_panel();
+}
+
+/**
+ * @brief No tasks on the host; the display flushes inline
+ */
+esp_err_t task_registry_create_static(task_id_t id, TaskFunction_t task_fn, void *arg,
+                                      StackType_t *stack, StaticTask_t *tcb,
+                                      TaskHandle_t *out_handle)
+{
+    (void)id;
+    (void)task_fn;
+    (void)arg;
+    (void)stack;
+    (void)tcb;
+    (void)out_handle;
+    return ESP_ERR_NOT_SUPPORTED;
+}
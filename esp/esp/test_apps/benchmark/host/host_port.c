@@ -0,0 +1,142 @@
+/**
+ * @file host_port.c
+ *
+ * @brief Host Implementations of the ESP-IDF and FreeRTOS Shims
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Private variables ---------------------------------------------------------*/
+
+static esp_log_level_t log_level = ESP_LOG_INFO;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Name of an error code
+ */
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:
+        return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE:
+        return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC:
+        return "ESP_ERR_INVALID_CRC";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+/**
+ * @brief Set the log level
+ */
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    (void)tag;
+    log_level = level;
+}
+
+/**
+ * @brief Print one log line if its level is enabled
+ */
+void host_log(esp_log_level_t level, const char *letter, const char *tag, const char *fmt, ...)
+{
+    if (level > log_level)
+    {
+        return;
+    }
+
+    va_list args;
+    va_start(args, fmt);
+    printf("%s (%s) ", letter, tag);
+    vprintf(fmt, args);
+    printf("\n");
+    va_end(args);
+}
+
+/**
+ * @brief Microseconds since start
+ */
+int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief Ticks since start
+ */
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / (1000 * portTICK_PERIOD_MS));
+}
+
+/**
+ * @brief Sleep for a number of ticks
+ */
+void vTaskDelay(TickType_t ticks)
+{
+    uint64_t ns = (uint64_t)ticks * portTICK_PERIOD_MS * 1000000ULL;
+    struct timespec ts = {
+        .tv_sec = (time_t)(ns / 1000000000ULL),
+        .tv_nsec = (long)(ns % 1000000000ULL),
+    };
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Handle of the calling task
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    static int host_task;
+    return &host_task;
+}
+
+/**
+ * @brief Give a task notification
+ */
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
+
+/**
+ * @brief Take a task notification
+ */
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    (void)clear_on_exit;
+    (void)ticks_to_wait;
+    return 0;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file i2cdev_host.c
+ *
+ * @brief Simulated I2C Bus for the Host Build
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "i2cdev_host.h"
+#include "i2cdev.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define I2C_HOST_ADDRESSES 128 //!< 7-bit address space
+#define I2C_HOST_REGISTERS 256 //!< Register image per device
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t registers[I2C_HOST_ADDRESSES][I2C_HOST_REGISTERS];
+static uint8_t pointer[I2C_HOST_ADDRESSES];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void host_read(uint8_t addr, uint8_t reg, void *data, size_t len);
+static void host_write(uint8_t addr, uint8_t reg, const void *data, size_t len);
+static void host_account(i2c_dev_t *dev, size_t bytes);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Preload registers of a simulated device
+ */
+void i2cdev_host_load(uint8_t addr, uint8_t reg, const void *data, size_t len)
+{
+    host_write(addr & 0x7F, reg, data, len);
+}
+
+/**
+ * @brief Initialize the bus
+ */
+esp_err_t i2c_bus_init(int port, gpio_num_t sda_gpio, gpio_num_t scl_gpio, uint32_t clk_speed)
+{
+    (void)port;
+    (void)sda_gpio;
+    (void)scl_gpio;
+    (void)clk_speed;
+    return ESP_OK;
+}
+
+/**
+ * @brief Attach a device
+ */
+esp_err_t i2c_dev_init(i2c_dev_t *dev)
+{
+    if (dev == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (dev->clk_speed == 0)
+    {
+        dev->clk_speed = I2C_MASTER_FREQ_HZ;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief No mutex on the single-threaded host
+ */
+esp_err_t i2c_dev_create_mutex(i2c_dev_t *dev)
+{
+    if (dev == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    dev->mutex = NULL;
+    return ESP_OK;
+}
+
+/**
+ * @brief No mutex on the single-threaded host
+ */
+esp_err_t i2c_dev_delete_mutex(i2c_dev_t *dev)
+{
+    return dev == NULL ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+/**
+ * @brief Read registers from the device image
+ */
+esp_err_t i2c_dev_read_reg(i2c_dev_t *dev, uint8_t reg, void *data, size_t len)
+{
+    if (dev == NULL || data == NULL || len == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    host_read(dev->addr & 0x7F, reg, data, len);
+    host_account(dev, len + 1);
+    return ESP_OK;
+}
+
+/**
+ * @brief Write registers to the device image
+ */
+esp_err_t i2c_dev_write_reg(i2c_dev_t *dev, uint8_t reg, const void *data, size_t len)
+{
+    if (dev == NULL || data == NULL || len == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    host_write(dev->addr & 0x7F, reg, data, len);
+    host_account(dev, len + 1);
+    return ESP_OK;
+}
+
+/**
+ * @brief Read from the register pointer
+ */
+esp_err_t i2c_dev_read(i2c_dev_t *dev, void *data, size_t len)
+{
+    if (dev == NULL || data == NULL || len == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t addr = dev->addr & 0x7F;
+    host_read(addr, pointer[addr], data, len);
+    host_account(dev, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief First byte sets the register pointer, the rest is stored from it
+ */
+esp_err_t i2c_dev_write(i2c_dev_t *dev, const void *data, size_t len)
+{
+    if (dev == NULL || data == NULL || len == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint8_t addr = dev->addr & 0x7F;
+
+    pointer[addr] = bytes[0];
+    if (len > 1)
+    {
+        host_write(addr, bytes[0], bytes + 1, len - 1);
+    }
+    host_account(dev, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Record the clock
+ */
+esp_err_t i2c_dev_set_speed(i2c_dev_t *dev, uint32_t clk_speed)
+{
+    if (dev == NULL || clk_speed == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    dev->clk_speed = clk_speed;
+    return ESP_OK;
+}
+
+/**
+ * @brief Nothing to probe; keep the configured clock
+ */
+esp_err_t i2c_dev_probe_speed(i2c_dev_t *dev, i2c_dev_verify_cb_t verify, void *arg)
+{
+    (void)verify;
+    (void)arg;
+    return dev == NULL ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+/**
+ * @brief Count a driver-detected error
+ */
+void i2c_dev_report_error(i2c_dev_t *dev, esp_err_t err)
+{
+    if (dev == NULL || err == ESP_OK)
+    {
+        return;
+    }
+
+    dev->stats.errors++;
+    if (err == ESP_ERR_INVALID_CRC)
+    {
+        dev->stats.crc_errors++;
+    }
+}
+
+/**
+ * @brief No bus report on the host
+ */
+void i2c_bus_report(void)
+{
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Copy out of a register image
+ */
+static void host_read(uint8_t addr, uint8_t reg, void *data, size_t len)
+{
+    uint8_t *out = (uint8_t *)data;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        out[i] = registers[addr][(uint8_t)(reg + i)];
+    }
+}
+
+/**
+ * @brief Copy into a register image
+ */
+static void host_write(uint8_t addr, uint8_t reg, const void *data, size_t len)
+{
+    const uint8_t *in = (const uint8_t *)data;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        registers[addr][(uint8_t)(reg + i)] = in[i];
+    }
+}
+
+/**
+ * @brief Bus statistics, as the real driver keeps them
+ */
+static void host_account(i2c_dev_t *dev, size_t bytes)
+{
+    dev->stats.transactions++;
+    dev->stats.bytes += (uint32_t)bytes;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file i2cdev_host.h
+ *
+ * @brief Simulated I2C Bus for the Host Build
+ *
+ * Every address has a 256-byte register image. Register reads and writes
+ * go to that image; a plain write sets the register pointer from its first
+ * byte and a plain read continues from it. No transfer ever fails, so the
+ * host numbers are the drivers' CPU work without the bus time.
+ */
+
+#ifndef I2CDEV_HOST_H
+#define I2CDEV_HOST_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Preload registers of a simulated device
+ *
+ * @param[in] addr 7-bit device address
+ * @param[in] reg First register
+ * @param[in] data Register contents
+ * @param[in] len Number of registers (wraps at 256)
+ */
+void i2cdev_host_load(uint8_t addr, uint8_t reg, const void *data, size_t len);
+
+#endif /* I2CDEV_HOST_H */
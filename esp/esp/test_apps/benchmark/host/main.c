@@ -0,0 +1,29 @@
+/**
+ * @file main.c
+ *
+ * @brief Host Entry Point of the Benchmark Suite
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "bench_cases.h"
+#include <string.h>
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Run the suite; the exit status is the number of failed tests
+ *
+ * With --history-vector, print the history_codec test vector instead.
+ */
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--history-vector") == 0)
+    {
+        bench_history_print_vector();
+        return 0;
+    }
+
+    return bench_run_all() == 0 ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file gpio.h
+ *
+ * @brief Host Shim: GPIO Numbers
+ */
+
+#ifndef DRIVER_GPIO_H
+#define DRIVER_GPIO_H
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef int gpio_num_t;
+
+#endif /* DRIVER_GPIO_H */
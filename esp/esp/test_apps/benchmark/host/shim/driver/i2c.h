@@ -0,0 +1,14 @@
+/**
+ * @file i2c.h
+ *
+ * @brief Host Shim: Legacy I2C Driver Header
+ */
+
+#ifndef DRIVER_I2C_H
+#define DRIVER_I2C_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "driver/i2c_types.h"
+
+#endif /* DRIVER_I2C_H */
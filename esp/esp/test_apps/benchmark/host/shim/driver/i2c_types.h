@@ -0,0 +1,14 @@
+/**
+ * @file i2c_types.h
+ *
+ * @brief Host Shim: I2C Types
+ */
+
+#ifndef DRIVER_I2C_TYPES_H
+#define DRIVER_I2C_TYPES_H
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef int i2c_port_t;
+
+#endif /* DRIVER_I2C_TYPES_H */
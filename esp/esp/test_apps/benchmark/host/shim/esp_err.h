@@ -0,0 +1,41 @@
+/**
+ * @file esp_err.h
+ *
+ * @brief Host Shim: ESP-IDF Error Codes
+ */
+
+#ifndef ESP_ERR_H
+#define ESP_ERR_H
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef int esp_err_t;
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+#define ESP_ERR_NO_MEM          0x101
+#define ESP_ERR_INVALID_ARG     0x102
+#define ESP_ERR_INVALID_STATE   0x103
+#define ESP_ERR_INVALID_SIZE    0x104
+#define ESP_ERR_NOT_FOUND       0x105
+#define ESP_ERR_NOT_SUPPORTED   0x106
+#define ESP_ERR_TIMEOUT         0x107
+#define ESP_ERR_INVALID_RESPONSE 0x108
+#define ESP_ERR_INVALID_CRC     0x109
+#define ESP_ERR_INVALID_VERSION 0x10A
+#define ESP_ERR_NOT_FINISHED    0x10C
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Name of an error code
+ *
+ * @param[in] code Error code
+ *
+ * @return Constant string
+ */
+const char *esp_err_to_name(esp_err_t code);
+
+#endif /* ESP_ERR_H */
@@ -0,0 +1,51 @@
+/**
+ * @file esp_log.h
+ *
+ * @brief Host Shim: ESP-IDF Logging
+ */
+
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef enum
+{
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+/* Exported macros -----------------------------------------------------------*/
+
+#define ESP_LOGE(tag, fmt, ...) host_log(ESP_LOG_ERROR, "E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) host_log(ESP_LOG_WARN, "W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) host_log(ESP_LOG_INFO, "I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) host_log(ESP_LOG_DEBUG, "D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) host_log(ESP_LOG_VERBOSE, "V", tag, fmt, ##__VA_ARGS__)
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Set the log level; the tag is ignored, one level applies to all
+ *
+ * @param[in] tag Tag, "*" on the target for all
+ * @param[in] level Highest level printed
+ */
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+
+/**
+ * @brief Print one log line if its level is enabled
+ *
+ * @param[in] level Message level
+ * @param[in] letter Level letter
+ * @param[in] tag Module tag
+ * @param[in] fmt printf format
+ */
+void host_log(esp_log_level_t level, const char *letter, const char *tag, const char *fmt, ...)
+    __attribute__((format(printf, 4, 5)));
+
+#endif /* ESP_LOG_H */
@@ -0,0 +1,23 @@
+/**
+ * @file esp_timer.h
+ *
+ * @brief Host Shim: ESP-IDF High Resolution Timer
+ */
+
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Microseconds since start
+ *
+ * @return Monotonic time in us
+ */
+int64_t esp_timer_get_time(void);
+
+#endif /* ESP_TIMER_H */
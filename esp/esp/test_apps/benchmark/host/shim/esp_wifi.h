@@ -0,0 +1,38 @@
+/**
+ * @file esp_wifi.h
+ *
+ * @brief Host Shim: the Wi-Fi Scan Record used by json_helper
+ */
+
+#ifndef ESP_WIFI_H
+#define ESP_WIFI_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "esp_err.h"
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef enum
+{
+    WIFI_AUTH_OPEN,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK,
+    WIFI_AUTH_WPA2_WPA3_PSK,
+} wifi_auth_mode_t;
+
+typedef struct
+{
+    uint8_t bssid[6];          //!< MAC address of the AP
+    uint8_t ssid[33];          //!< SSID, NUL terminated
+    uint8_t primary;           //!< Channel
+    int8_t rssi;               //!< Signal strength
+    wifi_auth_mode_t authmode; //!< Authentication mode
+} wifi_ap_record_t;
+
+#endif /* ESP_WIFI_H */
@@ -0,0 +1,61 @@
+/**
+ * @file FreeRTOS.h
+ *
+ * @brief Host Shim: FreeRTOS Types and Port Macros
+ *
+ * The host run is single threaded, so critical sections compile away.
+ */
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "sdkconfig.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint8_t StackType_t;
+
+typedef struct
+{
+    int owner; //!< Unused on the host
+} portMUX_TYPE;
+
+typedef struct
+{
+    uint8_t reserved[344]; //!< Unused on the host
+} StaticTask_t;
+
+typedef struct
+{
+    uint8_t reserved[84]; //!< Unused on the host
+} StaticSemaphore_t;
+
+/* Exported defines ----------------------------------------------------------*/
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdFAIL  0
+#define pdPASS  1
+
+#define portMAX_DELAY       ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS  (1000 / CONFIG_FREERTOS_HZ)
+#define tskNO_AFFINITY      0x7FFFFFFF
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+/* Exported macros -----------------------------------------------------------*/
+
+#define pdMS_TO_TICKS(ms)     ((TickType_t)(((uint64_t)(ms) * CONFIG_FREERTOS_HZ) / 1000))
+#define pdTICKS_TO_MS(ticks)  ((uint32_t)(((uint64_t)(ticks) * 1000) / CONFIG_FREERTOS_HZ))
+
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux)  ((void)(mux))
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,61 @@
+/**
+ * @file task.h
+ *
+ * @brief Host Shim: FreeRTOS Task API
+ */
+
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "freertos/FreeRTOS.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief Ticks since start, derived from the monotonic clock
+ *
+ * @return Tick count
+ */
+TickType_t xTaskGetTickCount(void);
+
+/**
+ * @brief Sleep for a number of ticks
+ *
+ * @param[in] ticks Ticks to sleep
+ */
+void vTaskDelay(TickType_t ticks);
+
+/**
+ * @brief Handle of the calling task; the host run has a single one
+ *
+ * @return Task handle
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+/**
+ * @brief Give a task notification; no tasks run on the host
+ *
+ * @param[in] task Task handle
+ *
+ * @return pdPASS
+ */
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+/**
+ * @brief Take a task notification; returns at once on the host
+ *
+ * @param[in] clear_on_exit Clear the count
+ * @param[in] ticks_to_wait Timeout
+ *
+ * @return 0
+ */
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+
+#endif /* FREERTOS_TASK_H */
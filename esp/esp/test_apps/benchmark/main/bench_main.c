@@ -0,0 +1,29 @@
+/**
+ * @file bench_main.c
+ *
+ * @brief Benchmark Application Entry Point
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "bench.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief The application entry point.
+ */
+void app_main(void)
+{
+    // Give the console time to attach after reset
+    vTaskDelay(pdMS_TO_TICKS(1000));
+
+    bench_run_all();
+
+    while (1)
+    {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+}
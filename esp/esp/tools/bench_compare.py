@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Compare two benchmark reports.
+
+Reads the BENCH_META and BENCH lines printed by the benchmark test app
+(test_apps/benchmark) from two console logs, prints the median of every
+benchmark side by side and exits non-zero if any median grew by more than
+the threshold. Lines that are not part of the report are ignored, so a
+raw idf.py monitor capture works as input.
+
+Usage: bench_compare.py <baseline log> <current log> [--threshold PERCENT]
+"""
+
+import argparse
+import json
+import sys
+
+META_PREFIX = 'BENCH_META '
+RESULT_PREFIX = 'BENCH '
+
+
+def load_report(path):
+    """Return (meta, {name: result}) from a console log."""
+    meta = {}
+    results = {}
+
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            # Monitor captures may carry a timestamp or log prefix
+            for prefix in (META_PREFIX, RESULT_PREFIX):
+                pos = line.find(prefix)
+                if pos < 0:
+                    continue
+                try:
+                    record = json.loads(line[pos + len(prefix):])
+                except ValueError:
+                    continue
+                if prefix == META_PREFIX:
+                    meta = record
+                else:
+                    results[record['name']] = record
+                break
+
+    return meta, results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare benchmark medians')
+    parser.add_argument('baseline', help='Console log of the baseline run')
+    parser.add_argument('current', help='Console log of the run to check')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Allowed median growth in percent (default 10)')
+    args = parser.parse_args()
+
+    base_meta, base = load_report(args.baseline)
+    cur_meta, cur = load_report(args.current)
+
+    if not base or not cur:
+        print('No BENCH lines in %s' % (args.baseline if not base else args.current))
+        return 2
+
+    for key in ('target', 'unit'):
+        if base_meta.get(key) != cur_meta.get(key):
+            print('Reports differ in %s: %s vs %s' % (key, base_meta.get(key), cur_meta.get(key)))
+            return 2
+
+    unit = cur_meta.get('unit', '')
+    regressions = 0
+
+    print('%-32s %12s %12s %8s' % ('benchmark', 'base ' + unit, 'now ' + unit, 'change'))
+    for name in sorted(set(base) | set(cur)):
+        if name not in base or name not in cur:
+            print('%-32s %12s %12s %8s' % (name,
+                                            base[name]['median'] if name in base else '-',
+                                            cur[name]['median'] if name in cur else '-',
+                                            'n/a'))
+            continue
+
+        before = base[name]['median']
+        after = cur[name]['median']
+        change = (after - before) * 100.0 / before if before else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions += 1
+        print('%-32s %12d %12d %+7.1f%%%s' % (name, before, after, change, flag))
+
+    if regressions:
+        print('%d benchmark(s) slower by more than %.1f%%' % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""App image size check against the OTA slots.
+
+Reads the app partitions from the partition table CSV and fails when the
+image does not fit the smallest of them, so an update can always be
+written to the inactive slot. Warns when less than the given share of the
+slot is left.
+
+Usage: check_app_size.py <app .bin> <partitions.csv> [warn free percent]
+"""
+
+import os
+import sys
+
+DEFAULT_WARN_FREE_PERCENT = 10
+
+
+def parse_size(text):
+    """Partition table size: hex, decimal or with a K/M suffix."""
+    text = text.strip().upper()
+    scale = 1
+    if text.endswith('K'):
+        scale, text = 1024, text[:-1]
+    elif text.endswith('M'):
+        scale, text = 1024 * 1024, text[:-1]
+    return int(text, 0) * scale
+
+
+def app_slots(csv_path):
+    """Return [(name, size)] of the app partitions."""
+    slots = []
+    with open(csv_path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(',')]
+            if len(fields) >= 5 and fields[1] == 'app' and fields[4]:
+                slots.append((fields[0], parse_size(fields[4])))
+    return slots
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        print(__doc__.strip().splitlines()[-1], file=sys.stderr)
+        return 1
+
+    bin_path, csv_path = sys.argv[1], sys.argv[2]
+    warn_free = int(sys.argv[3]) if len(sys.argv) == 4 else DEFAULT_WARN_FREE_PERCENT
+
+    if not os.path.isfile(bin_path):
+        print('check_app_size: image not found: %s' % bin_path, file=sys.stderr)
+        return 0
+
+    slots = app_slots(csv_path)
+    if not slots:
+        print('check_app_size: no app partition in %s' % csv_path, file=sys.stderr)
+        return 1
+
+    name, slot = min(slots, key=lambda s: s[1])
+    size = os.path.getsize(bin_path)
+    free = slot - size
+
+    print('App image %d bytes, slot %s 0x%x bytes, %d bytes (%d%%) free'
+          % (size, name, slot, free, max(free, 0) * 100 // slot))
+
+    if free < 0:
+        print('check_app_size: image is %d bytes larger than %s, OTA updates cannot be written'
+              % (-free, name), file=sys.stderr)
+        return 1
+
+    if free * 100 < slot * warn_free:
+        print('check_app_size: warning: less than %d%% of %s left' % (warn_free, name), file=sys.stderr)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
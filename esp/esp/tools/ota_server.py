@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Local HTTP server for OTA testing.
+
+Serves a directory with HTTP Range support (206 Partial Content), which the
+OTA manager uses to resume interrupted downloads. --drop-after cuts every
+response after N bytes to exercise the resume path.
+
+Usage: ota_server.py [--port 8070] [--dir build] [--drop-after BYTES]
+"""
+
+import argparse
+import http.server
+import os
+import re
+
+RANGE_RE = re.compile(r'bytes=(\d+)-(\d*)$')
+
+
+class RangeHandler(http.server.SimpleHTTPRequestHandler):
+    drop_after = 0
+
+    def do_GET(self):
+        path = self.translate_path(self.path)
+        if not os.path.isfile(path):
+            self.send_error(404)
+            return
+
+        size = os.path.getsize(path)
+        start, end = 0, size - 1
+        match = RANGE_RE.match(self.headers.get('Range', ''))
+
+        if match:
+            start = int(match.group(1))
+            if match.group(2):
+                end = min(int(match.group(2)), size - 1)
+            if start > end:
+                self.send_error(416)
+                return
+            self.send_response(206)
+            self.send_header('Content-Range', 'bytes %d-%d/%d' % (start, end, size))
+        else:
+            self.send_response(200)
+
+        length = end - start + 1
+        self.send_header('Content-Type', 'application/octet-stream')
+        self.send_header('Content-Length', str(length))
+        self.send_header('Accept-Ranges', 'bytes')
+        self.end_headers()
+
+        limit = min(length, self.drop_after) if self.drop_after else length
+        with open(path, 'rb') as f:
+            f.seek(start)
+            sent = 0
+            while sent < limit:
+                chunk = f.read(min(4096, limit - sent))
+                if not chunk:
+                    break
+                self.wfile.write(chunk)
+                sent += len(chunk)
+
+        if sent < length:
+            self.log_message('dropped connection after %d of %d bytes', sent, length)
+            self.close_connection = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', type=int, default=8070)
+    parser.add_argument('--dir', default='.')
+    parser.add_argument('--drop-after', type=int, default=0, help='cut each response after N bytes')
+    args = parser.parse_args()
+
+    RangeHandler.drop_after = args.drop_after
+    os.chdir(args.dir)
+    server = http.server.ThreadingHTTPServer(('', args.port), RangeHandler)
+    print('Serving %s on port %d' % (os.getcwd(), args.port))
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""OTA image tooling: delta patches and MQTT ota commands.
+
+delta     Build a COPY/INSERT delta from the running image to a new image,
+          in the format decoded by components/communication/ota_manager
+          (see ota_patch.h).
+apply     Apply a delta on the host, to check it reproduces the new image.
+command   Print the MQTT ota command for an image, with its SHA-256 and an
+          optional signature made with openssl.
+
+Usage:
+  ota_tool.py delta <base.bin> <new.bin> <out.delta>
+  ota_tool.py apply <base.bin> <in.delta> <out.bin>
+  ota_tool.py command <new.bin> <url> [--key private.pem] [--cmd-id ID]
+"""
+
+import argparse
+import hashlib
+import json
+import struct
+import subprocess
+import sys
+
+MAGIC = b'SHD1'
+OP_END = 0x00
+OP_COPY = 0x01
+OP_INSERT = 0x02
+
+BLOCK = 32       # Match granularity
+MIN_COPY = 64    # Shorter matches are cheaper as INSERT
+
+
+def image_hash(image):
+    """SHA-256 of an app image as reported by esp_partition_get_sha256().
+
+    Images built with the default hash_appended option end with the SHA-256
+    of everything before it; the partition hash is that appended digest.
+    """
+    body, tail = image[:-32], image[-32:]
+    if len(image) > 32 and hashlib.sha256(body).digest() == tail:
+        return tail
+    return hashlib.sha256(image).digest()
+
+
+def build_delta(base, new):
+    """Greedy block matching delta: COPY runs found in base, INSERT the rest."""
+    index = {}
+    for off in range(0, len(base) - BLOCK + 1, 4):
+        index.setdefault(base[off:off + BLOCK], off)
+
+    ops = []
+    literal = bytearray()
+    pos = 0
+
+    def flush_literal():
+        if literal:
+            ops.append(struct.pack('<BI', OP_INSERT, len(literal)) + bytes(literal))
+            literal.clear()
+
+    while pos < len(new):
+        src = index.get(new[pos:pos + BLOCK]) if pos + BLOCK <= len(new) else None
+        if src is not None:
+            length = BLOCK
+            while (pos + length < len(new) and src + length < len(base)
+                   and new[pos + length] == base[src + length]):
+                length += 1
+            if length >= MIN_COPY:
+                flush_literal()
+                ops.append(struct.pack('<BII', OP_COPY, src, length))
+                pos += length
+                continue
+        literal.append(new[pos])
+        pos += 1
+
+    flush_literal()
+    ops.append(bytes([OP_END]))
+
+    header = MAGIC + image_hash(base) + struct.pack('<I', len(new))
+    return header + b''.join(ops)
+
+
+def apply_delta(base, delta):
+    """Reference decoder, mirrors ota_patch.c."""
+    if delta[:4] != MAGIC:
+        raise ValueError('not a delta')
+    if delta[4:36] != image_hash(base):
+        raise ValueError('delta built for another base image')
+    target_size, = struct.unpack_from('<I', delta, 36)
+    out = bytearray()
+    pos = 40
+    while True:
+        op = delta[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            src, length = struct.unpack_from('<II', delta, pos)
+            pos += 8
+            out += base[src:src + length]
+        elif op == OP_INSERT:
+            length, = struct.unpack_from('<I', delta, pos)
+            pos += 4
+            out += delta[pos:pos + length]
+            pos += length
+        else:
+            raise ValueError('unknown op 0x%02x' % op)
+    if len(out) != target_size:
+        raise ValueError('size mismatch')
+    return bytes(out)
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def cmd_delta(args):
+    base, new = read(args.base), read(args.new)
+    delta = build_delta(base, new)
+    if apply_delta(base, delta) != new:
+        sys.exit('internal error: delta does not reproduce the image')
+    with open(args.out, 'wb') as f:
+        f.write(delta)
+    print('%s: %d bytes (%.1f%% of %d)' % (args.out, len(delta), 100.0 * len(delta) / len(new), len(new)))
+
+
+def cmd_apply(args):
+    with open(args.out, 'wb') as f:
+        f.write(apply_delta(read(args.base), read(args.delta)))
+
+
+def cmd_command(args):
+    image = read(args.image)
+    params = {'url': args.url, 'sha256': hashlib.sha256(image).hexdigest()}
+    if args.key:
+        sig = subprocess.run(['openssl', 'dgst', '-sha256', '-sign', args.key],
+                             input=image, stdout=subprocess.PIPE, check=True).stdout
+        params['signature'] = sig.hex()
+    print(json.dumps({'cmd_id': args.cmd_id, 'command': 'ota', 'params': params}))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='cmd', required=True)
+
+    p = sub.add_parser('delta')
+    p.add_argument('base')
+    p.add_argument('new')
+    p.add_argument('out')
+    p.set_defaults(func=cmd_delta)
+
+    p = sub.add_parser('apply')
+    p.add_argument('base')
+    p.add_argument('delta')
+    p.add_argument('out')
+    p.set_defaults(func=cmd_apply)
+
+    p = sub.add_parser('command')
+    p.add_argument('image', help='new full image (the sha256 is always of the full image)')
+    p.add_argument('url', help='URL of the image or of its delta')
+    p.add_argument('--key', help='PEM private key for the signature')
+    p.add_argument('--cmd-id', default='ota1')
+    p.set_defaults(func=cmd_command)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
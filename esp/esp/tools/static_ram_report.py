@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Static RAM report per subsystem.
+
+Parses the GNU ld map file produced by the ESP-IDF build and sums the
+.data/.bss input sections placed in internal DRAM, grouped by component
+and by the layer directory the component lives in (application,
+communication, hardware, sensor, utilities). Everything else is reported
+as the framework.
+
+Usage: static_ram_report.py <map file> <components dir>
+"""
+
+import os
+import re
+import sys
+
+# Output sections that hold statically allocated internal RAM
+RAM_OUTPUT_SECTIONS = ('.dram0.data', '.dram0.bss', '.noinit')
+
+OUTPUT_RE = re.compile(r'^(\.\S+)')
+INPUT_RE = re.compile(r'^\s+(\S+)?\s*0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+\.a)\((\S+)\)')
+NAME_ONLY_RE = re.compile(r'^\s+(\.\S+|COMMON)\s*$')
+LIB_RE = re.compile(r'lib([^/\\]+)\.a$')
+
+
+def load_layers(components_dir):
+    """Map component name to its layer directory."""
+    layers = {}
+    for layer in sorted(os.listdir(components_dir)):
+        layer_dir = os.path.join(components_dir, layer)
+        if not os.path.isdir(layer_dir):
+            continue
+        for comp in os.listdir(layer_dir):
+            if os.path.isfile(os.path.join(layer_dir, comp, 'CMakeLists.txt')):
+                layers[comp] = layer
+    return layers
+
+
+def parse_map(map_path):
+    """Return {component: [data_bytes, bss_bytes]} for internal RAM."""
+    usage = {}
+    current = None
+    pending_name = None
+
+    with open(map_path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            out = OUTPUT_RE.match(line)
+            if out:
+                current = out.group(1)
+                pending_name = None
+                continue
+
+            if current not in RAM_OUTPUT_SECTIONS:
+                continue
+
+            name_only = NAME_ONLY_RE.match(line)
+            if name_only:
+                # Long section names wrap: address and size follow on the next line
+                pending_name = name_only.group(1)
+                continue
+
+            inp = INPUT_RE.match(line)
+            if not inp:
+                pending_name = None
+                continue
+
+            size = int(inp.group(3), 16)
+            lib = LIB_RE.search(inp.group(4))
+            pending_name = None
+            if size == 0 or not lib:
+                continue
+
+            entry = usage.setdefault(lib.group(1), [0, 0])
+            entry[0 if current == '.dram0.data' else 1] += size
+
+    return usage
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip().splitlines()[-1], file=sys.stderr)
+        return 1
+
+    map_path, components_dir = sys.argv[1], sys.argv[2]
+    if not os.path.isfile(map_path):
+        print('static_ram_report: map file not found: %s' % map_path, file=sys.stderr)
+        return 0
+
+    layers = load_layers(components_dir)
+    usage = parse_map(map_path)
+
+    per_layer = {}
+    for comp, (data, bss) in usage.items():
+        layer = layers.get(comp, 'framework')
+        per_layer.setdefault(layer, []).append((comp, data, bss))
+
+    print('Static RAM per subsystem (internal DRAM, bytes)')
+    print('%-14s %-22s %8s %8s %8s' % ('Layer', 'Component', '.data', '.bss', 'Total'))
+
+    grand = 0
+    framework_total = 0
+    for layer in sorted(per_layer):
+        rows = sorted(per_layer[layer], key=lambda r: r[1] + r[2], reverse=True)
+        layer_total = sum(r[1] + r[2] for r in rows)
+        grand += layer_total
+        if layer == 'framework':
+            # Only the total: ESP-IDF components are not ours to plan
+            framework_total = layer_total
+            continue
+        for comp, data, bss in rows:
+            print('%-14s %-22s %8d %8d %8d' % (layer, comp, data, bss, data + bss))
+        print('%-14s %-22s %8s %8s %8d' % (layer, '(subtotal)', '', '', layer_total))
+
+    print('%-14s %-22s %8s %8s %8d' % ('framework', '(ESP-IDF)', '', '', framework_total))
+    print('%-14s %-22s %8s %8s %8d' % ('total', '', '', '', grand))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,20 +0,0 @@
-/**
- * @file main.H
- *
- * @brief Smart Home Project - Main Header File
- */
-
-#ifndef MAIN_H
-#define MAIN_H
-
-/* Includes ------------------------------------------------------------------*/
-
-#include "task_manager.h"
-#include "esp_log.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include <stdio.h>
-
-/* Exported functions --------------------------------------------------------*/
-
-#endif /* MAIN_H */
\ No newline at end of file
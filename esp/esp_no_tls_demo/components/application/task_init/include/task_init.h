@@ -1,18 +0,0 @@
-/**
- * @file task_init.h
- * @brief Task Init Header File
- */
-
-#ifndef TASK_INIT_H
-#define TASK_INIT_H
-
-/* Exported functions --------------------------------------------------------*/
-
-/**
- * @brief Initialize all system components
- *
- * @note Must be called once at system startup from app_main().
- */
-void task_init(void);
-
-#endif /* TASK_INIT_H */
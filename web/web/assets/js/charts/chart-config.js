@@ -6,6 +6,17 @@
 export const CHART_CONFIG = {
     MAX_DATA_POINTS: 20,    //!< Maximum points to show on chart
     animation: false,       //!< Disable animation for smooth real-time updates
+    incremental: true,      //!< Live range: load the window once, then apply child_added deltas
+    updateThrottleMs: 1000, //!< Minimum time between live redraws in incremental mode
+
+    // History ranges; resolutionMs picks the rollup level (see history-rollup.js)
+    ranges: {
+        live: { label: 'Live' },
+        hour: { label: '1H', spanMs: 60 * 60 * 1000, resolutionMs: 60 * 1000 },
+        day: { label: '24H', spanMs: 24 * 60 * 60 * 1000, resolutionMs: 15 * 60 * 1000 },
+        week: { label: '7D', spanMs: 7 * 24 * 60 * 60 * 1000, resolutionMs: 60 * 60 * 1000 },
+        month: { label: '30D', spanMs: 30 * 24 * 60 * 60 * 1000, resolutionMs: 4 * 60 * 60 * 1000 }
+    },
 
     types: {
         temp: {
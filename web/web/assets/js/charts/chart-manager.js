@@ -5,13 +5,71 @@
  */
 
 import { db } from '../core/firebase-config.js';
-import { ref, query, limitToLast, onValue } from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
+import {
+    ref, query, limitToLast, onValue, get, orderByKey, startAfter, onChildAdded
+} from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
 import { CHART_CONFIG } from './chart-config.js';
+import { fetchHistory, toMillis } from '../history/history-rollup.js';
 
 let myChartInstance = null;
 let currentChartType = 'temp';
 let currentDeviceId = null;
+let currentRange = 'live';
 let chartListener = null;
+let rangeRequestId = 0;
+let liveRing = null;
+let flushTimer = null;
+
+const DATA_FIELDS = { temp: 'temperature', humid: 'humidity', light: 'light' };
+
+/**
+ * Fixed-size ring of chart samples, oldest overwritten first
+ */
+class SampleRing {
+    /**
+     * @param {number} capacity - Number of samples kept
+     */
+    constructor(capacity) {
+        this.capacity = capacity;
+        this.values = new Float64Array(capacity);
+        this.labels = new Array(capacity);
+        this.start = 0;
+        this.count = 0;
+    }
+
+    /**
+     * Append a sample
+     * @param {number} value - Sensor value
+     * @param {string} label - Formatted time label
+     */
+    push(value, label) {
+        const index = (this.start + this.count) % this.capacity;
+        this.values[index] = value;
+        this.labels[index] = label;
+
+        if (this.count < this.capacity) {
+            this.count++;
+        } else {
+            this.start = (this.start + 1) % this.capacity;
+        }
+    }
+
+    /**
+     * Copy samples oldest first into existing arrays
+     * @param {Array} labels - Destination labels, resized in place
+     * @param {Array} values - Destination values, resized in place
+     */
+    copyTo(labels, values) {
+        labels.length = this.count;
+        values.length = this.count;
+
+        for (let i = 0; i < this.count; i++) {
+            const index = (this.start + i) % this.capacity;
+            labels[i] = this.labels[index];
+            values[i] = this.values[index];
+        }
+    }
+}
 
 /**
  * Initialize chart for a device
@@ -23,13 +81,44 @@ export function initializeChart(deviceId, chartType = 'temp') {
     currentChartType = chartType;
 
     // Clear existing listener
-    if (chartListener) {
-        chartListener();
-        chartListener = null;
+    stopLiveUpdates();
+
+    if (currentRange === 'live') {
+        rangeRequestId++;
+        // Setup Firebase listener for chart data
+        if (CHART_CONFIG.incremental) {
+            setupIncrementalListener(deviceId, chartType);
+        } else {
+            setupChartListener(deviceId, chartType);
+        }
+    } else {
+        loadRangeData(deviceId, chartType, currentRange);
     }
+}
 
-    // Setup Firebase listener for chart data
-    setupChartListener(deviceId, chartType);
+/**
+ * Load a history range once, from rollups when the range is long
+ * @param {string} deviceId - Device identifier
+ * @param {string} chartType - Chart type
+ * @param {string} range - Key of CHART_CONFIG.ranges
+ */
+async function loadRangeData(deviceId, chartType, range) {
+    const rangeConfig = CHART_CONFIG.ranges[range];
+    const requestId = ++rangeRequestId;
+    const now = Date.now();
+
+    try {
+        const points = await fetchHistory(deviceId, now - rangeConfig.spanMs, now, rangeConfig.resolutionMs);
+
+        // Ignore results of a superseded request (range/type/device changed)
+        if (requestId !== rangeRequestId) return;
+
+        const { labels, values } = processChartData(points, chartType, rangeConfig.spanMs > 24 * 60 * 60 * 1000);
+        console.log(`[Chart] Loaded ${values.length} points for ${chartType} (${range})`);
+        updateChart(chartType, labels, values);
+    } catch (error) {
+        console.error('[Chart] History query error:', error);
+    }
 }
 
 /**
@@ -66,29 +155,171 @@ function setupChartListener(deviceId, chartType) {
     });
 }
 
+/**
+ * Load the live window once, then apply child_added deltas to a ring
+ * @param {string} deviceId - Device identifier
+ * @param {string} chartType - Chart type
+ */
+async function setupIncrementalListener(deviceId, chartType) {
+    if (!db) {
+        console.error('[Chart] Firebase not initialized');
+        return;
+    }
+
+    const requestId = rangeRequestId;
+    const recordsRef = ref(db, `history/${deviceId}/records`);
+    const dataField = DATA_FIELDS[chartType];
+    const ring = new SampleRing(CHART_CONFIG.MAX_DATA_POINTS);
+    let lastKey = null;
+
+    try {
+        const snapshot = await get(query(recordsRef, limitToLast(CHART_CONFIG.MAX_DATA_POINTS)));
+
+        // Ignore results of a superseded request (range/type/device changed)
+        if (requestId !== rangeRequestId) return;
+
+        snapshot.forEach((child) => {
+            lastKey = child.key;
+            appendSample(ring, child.val(), dataField);
+        });
+    } catch (error) {
+        console.error('[Chart] History query error:', error);
+        return;
+    }
+
+    liveRing = ring;
+
+    const labels = [];
+    const values = [];
+    ring.copyTo(labels, values);
+    console.log(`[Chart] Loaded ${values.length} data points for ${chartType}`);
+    updateChart(chartType, labels, values);
+
+    // Push keys are chronological, so only records after the window arrive here
+    const deltaQuery = lastKey
+        ? query(recordsRef, orderByKey(), startAfter(lastKey))
+        : query(recordsRef, orderByKey());
+
+    chartListener = onChildAdded(deltaQuery, (child) => {
+        appendSample(ring, child.val(), dataField);
+        scheduleFlush();
+    }, (error) => {
+        console.error('[Chart] Firebase listener error:', error);
+    });
+}
+
+/**
+ * Add one history record to the ring
+ * @param {SampleRing} ring - Destination ring
+ * @param {Object} entry - History record
+ * @param {string} dataField - Sensor field to plot
+ */
+function appendSample(ring, entry, dataField) {
+    if (entry && entry[dataField] !== undefined) {
+        ring.push(entry[dataField], formatLabel(entry.timestamp, false));
+    }
+}
+
+/**
+ * Redraw the live chart at most once per CHART_CONFIG.updateThrottleMs
+ */
+function scheduleFlush() {
+    if (flushTimer) return;
+
+    flushTimer = setTimeout(() => {
+        flushTimer = null;
+        flushLiveRing();
+    }, CHART_CONFIG.updateThrottleMs);
+}
+
+/**
+ * Copy the ring into the existing chart and redraw without animation
+ */
+function flushLiveRing() {
+    if (!liveRing || !myChartInstance) return;
+
+    const data = myChartInstance.data;
+    const values = data.datasets[0].data;
+    liveRing.copyTo(data.labels, values);
+
+    const { minY, maxY } = computeYRange(values);
+    myChartInstance.options.scales.y.min = minY;
+    myChartInstance.options.scales.y.max = maxY;
+
+    myChartInstance.update('none');
+}
+
+/**
+ * Detach the live listener and drop pending redraws
+ */
+function stopLiveUpdates() {
+    if (chartListener) {
+        chartListener();
+        chartListener = null;
+    }
+
+    if (flushTimer) {
+        clearTimeout(flushTimer);
+        flushTimer = null;
+    }
+
+    liveRing = null;
+}
+
+/**
+ * Format a record timestamp as a chart label
+ * @param {number} timestamp - Milliseconds, or seconds in older records
+ * @param {boolean} withDate - Include the date
+ * @returns {string} Label
+ */
+function formatLabel(timestamp, withDate) {
+    const date = new Date(timestamp ? toMillis(timestamp) : Date.now());
+    return withDate
+        ? date.toLocaleString('en-US', { month: 'short', day: 'numeric', hour: '2-digit' })
+        : date.toLocaleTimeString('en-US', { hour: '2-digit', minute: '2-digit' });
+}
+
+/**
+ * Y-axis range with 20% padding, rounded to whole units
+ * @param {Array} values - Plotted values
+ * @returns {Object} minY and maxY, null when there is no data
+ */
+function computeYRange(values) {
+    if (values.length === 0) {
+        return { minY: null, maxY: null };
+    }
+
+    let min = values[0];
+    let max = values[0];
+    for (let i = 1; i < values.length; i++) {
+        if (values[i] < min) min = values[i];
+        if (values[i] > max) max = values[i];
+    }
+
+    const padding = (max - min) * 0.2; // 20% padding
+
+    return {
+        minY: Math.floor(Math.max(0, min - padding)), // Don't go below 0
+        maxY: Math.ceil(max + padding)
+    };
+}
+
 /**
  * Process raw Firebase data for chart
- * @param {Object} data - Raw Firebase data
+ * @param {Object|Array} data - Raw Firebase data or history points
  * @param {string} chartType - Chart type
+ * @param {boolean} withDate - Include the date in labels
  * @returns {Object} Processed labels and values
  */
-function processChartData(data, chartType) {
+function processChartData(data, chartType, withDate = false) {
     const labels = [];
     const values = [];
 
-    const dataField = chartType === 'temp' ? 'temperature' :
-        chartType === 'humid' ? 'humidity' : 'light';
+    const dataField = DATA_FIELDS[chartType];
 
     Object.values(data).forEach(entry => {
         if (entry[dataField] !== undefined) {
-            // Format timestamp for label
-            const date = new Date(entry.timestamp || Date.now());
-            const timeLabel = date.toLocaleTimeString('en-US', {
-                hour: '2-digit',
-                minute: '2-digit'
-            });
-
-            labels.push(timeLabel);
+            labels.push(formatLabel(entry.timestamp, withDate));
             values.push(entry[dataField]);
         }
     });
@@ -123,21 +354,7 @@ function updateChart(chartType, labels, values) {
     }
 
     // Calculate dynamic Y-axis range for better visualization
-    let minY = null;
-    let maxY = null;
-    if (values.length > 0) {
-        const min = Math.min(...values);
-        const max = Math.max(...values);
-        const range = max - min;
-        const padding = range * 0.2; // 20% padding
-        
-        minY = Math.max(0, min - padding); // Don't go below 0
-        maxY = max + padding;
-        
-        // Round to nice numbers
-        minY = Math.floor(minY);
-        maxY = Math.ceil(maxY);
-    }
+    const { minY, maxY } = computeYRange(values);
 
     // Create gradient for fill
     const gradient = ctx.createLinearGradient(0, 0, 0, canvas.height);
@@ -287,6 +504,23 @@ export function switchChartType(newType) {
     initializeChart(currentDeviceId, newType);
 }
 
+/**
+ * Switch chart history range
+ * @param {string} range - Key of CHART_CONFIG.ranges (live/hour/day/week/month)
+ */
+export function setChartRange(range) {
+    if (!CHART_CONFIG.ranges[range]) {
+        console.error('[Chart] Unknown range:', range);
+        return;
+    }
+
+    currentRange = range;
+
+    if (currentDeviceId) {
+        initializeChart(currentDeviceId, currentChartType);
+    }
+}
+
 /**
  * Update chart button active states
  * @param {string} activeType - Active chart type
@@ -343,13 +577,12 @@ export function cleanupChart() {
         myChartInstance = null;
     }
 
-    if (chartListener) {
-        chartListener();
-        chartListener = null;
-    }
+    stopLiveUpdates();
 
+    rangeRequestId++;
     currentDeviceId = null;
     currentChartType = 'temp';
+    currentRange = 'live';
 }
 
 /**
@@ -360,6 +593,7 @@ export function getChartState() {
     return {
         deviceId: currentDeviceId,
         chartType: currentChartType,
+        range: currentRange,
         isActive: myChartInstance !== null
     };
 }
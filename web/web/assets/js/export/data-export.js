@@ -7,6 +7,9 @@
 import { db } from '../core/firebase-config.js';
 import { ref, get } from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
 import { escapeHtml } from '../utils/helpers.js';
+import { fetchHistory, toMillis } from '../history/history-rollup.js';
+
+const EXPORT_MAX_POINTS = 2000;   //!< Per device; longer ranges use rollup buckets
 
 /**
  * Fetch all historical data from Firebase
@@ -50,7 +53,7 @@ export async function fetchAllHistoryData() {
                     flatData.push({
                         deviceId: deviceId,
                         deviceName: deviceNames[deviceId] || deviceId,
-                        timestamp: entry.timestamp || Date.now(),
+                        timestamp: entry.timestamp ? toMillis(entry.timestamp) : Date.now(),
                         temperature: parseFloat(entry.temperature) || 0,
                         humidity: parseFloat(entry.humidity) || 0,
                         light: parseInt(entry.light) || 0
@@ -71,6 +74,57 @@ export async function fetchAllHistoryData() {
     }
 }
 
+/**
+ * Fetch history for a time range, per device
+ * Ranges that would exceed EXPORT_MAX_POINTS per device are served from
+ * rollup buckets (average values) instead of raw samples
+ * @param {number} fromTs - Range start (ms)
+ * @param {number} toTs - Range end (ms)
+ * @returns {Promise<Array>} History rows (newest first)
+ */
+export async function fetchHistoryRange(fromTs, toTs) {
+    if (!db) {
+        throw new Error('Firebase not initialized');
+    }
+
+    const devicesSnapshot = await get(ref(db, 'devices'));
+    if (!devicesSnapshot.exists()) {
+        return [];
+    }
+
+    const devices = Object.entries(devicesSnapshot.val());
+    const resolutionMs = (toTs - fromTs) / EXPORT_MAX_POINTS;
+
+    const perDevice = await Promise.all(devices.map(async ([deviceId, device]) => {
+        const points = await fetchHistory(deviceId, fromTs, toTs, resolutionMs);
+        return points.map(point => ({
+            deviceId: deviceId,
+            deviceName: device.name || deviceId,
+            timestamp: point.timestamp,
+            bucketMs: point.bucketMs,
+            temperature: point.temperature || 0,
+            humidity: point.humidity || 0,
+            light: Math.round(point.light || 0)
+        }));
+    }));
+
+    const rows = perDevice.flat();
+    rows.sort((a, b) => b.timestamp - a.timestamp);
+
+    console.log('[Export] Fetched history rows:', rows.length);
+    return rows;
+}
+
+/**
+ * Format a row timestamp, marking bucket averages
+ * @param {Object} entry - History row
+ * @returns {string} Formatted date/time
+ */
+function formatRowTime(entry) {
+    const dateStr = new Date(entry.timestamp).toLocaleString('en-US');
+    return entry.bucketMs ? `${dateStr} (avg ${entry.bucketMs / 60000} min)` : dateStr;
+}
+
 /**
  * Render history data table
  * @param {Array} data - History data array
@@ -95,8 +149,7 @@ export function renderHistoryTable(data) {
     }
 
     const rows = data.map((entry, index) => {
-        const date = new Date(entry.timestamp);
-        const dateStr = date.toLocaleString('en-US');
+        const dateStr = formatRowTime(entry);
 
         return `
             <tr>
@@ -164,8 +217,7 @@ export function exportTableToExcel() {
     console.log('[Export] Data exported to CSV');
 }
 
-// Store all data and filtered data
-let allHistoryData = [];
+// Data of the last applied filter
 let filteredData = [];
 
 /**
@@ -193,22 +245,24 @@ export function filterDataByDateRange(data, fromDate, toDate) {
  */
 export async function applyFilters() {
     try {
-        // Fetch all data if not already loaded
-        if (allHistoryData.length === 0) {
-            allHistoryData = await fetchAllHistoryData();
-        }
-
         const fromDateInput = document.getElementById('filter-from-date');
         const toDateInput = document.getElementById('filter-to-date');
 
         const fromDate = fromDateInput.value ? new Date(fromDateInput.value) : null;
         const toDate = toDateInput.value ? new Date(toDateInput.value) : null;
 
-        filteredData = filterDataByDateRange(allHistoryData, fromDate, toDate);
+        if (fromDate) {
+            // Query only the range, long ranges come from rollups
+            const toTs = toDate ? toDate.setHours(23, 59, 59, 999) : Date.now();
+            filteredData = await fetchHistoryRange(fromDate.getTime(), toTs);
+        } else {
+            // Default and "All Time" export every raw sample, never averages
+            filteredData = filterDataByDateRange(await fetchAllHistoryData(), null, toDate);
+        }
 
         renderHistoryTable(filteredData);
 
-        console.log(`[Export] Filtered ${filteredData.length} / ${allHistoryData.length} entries`);
+        console.log(`[Export] Loaded ${filteredData.length} entries`);
 
     } catch (error) {
         console.error('[Export] Apply filters error:', error);
@@ -223,8 +277,7 @@ export function resetFilters() {
     document.getElementById('filter-from-date').value = '';
     document.getElementById('filter-to-date').value = '';
 
-    filteredData = allHistoryData;
-    renderHistoryTable(filteredData);
+    applyFilters();
 
     console.log('[Export] Filters reset');
 }
@@ -303,8 +356,7 @@ export function exportFilteredData() {
 
     // Add data rows
     filteredData.forEach((entry, index) => {
-        const date = new Date(entry.timestamp);
-        const dateStr = date.toLocaleString('en-US');
+        const dateStr = formatRowTime(entry);
 
         const row = [
             index + 1,
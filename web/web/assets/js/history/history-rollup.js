@@ -0,0 +1,219 @@
+/**
+ * history-rollup.js
+ * Time-bucketed sensor history rollups
+ * Maintains 1-minute, 15-minute and 1-hour min/max/avg buckets as samples
+ * arrive, and serves range queries from the coarsest bucket that still
+ * meets the requested resolution
+ */
+
+import { db } from '../core/firebase-config.js';
+import {
+    ref,
+    get,
+    query,
+    orderByKey,
+    orderByChild,
+    startAt,
+    endAt,
+    runTransaction
+} from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
+
+/**
+ * Rollup levels, finest first
+ * Stored at /history/{deviceId}/rollups/{level}/{bucketStartMs}
+ */
+export const ROLLUP_LEVELS = [
+    { name: '1m', bucketMs: 60 * 1000 },
+    { name: '15m', bucketMs: 15 * 60 * 1000 },
+    { name: '1h', bucketMs: 60 * 60 * 1000 }
+];
+
+const METRICS = ['temperature', 'humidity', 'light'];
+
+// Records written before the ms switch hold Unix seconds; any value below
+// this is seconds (1e12 ms is 2001, 1e12 s is far in the future)
+const LEGACY_SECONDS_MAX = 1e12;
+
+/**
+ * Normalize a timestamp to milliseconds
+ * Devices publish Unix seconds and older history records store them as is;
+ * newer records, rollups and range queries use ms
+ * @param {number} timestamp - Timestamp in seconds or milliseconds
+ * @returns {number} Timestamp in milliseconds
+ */
+export function toMillis(timestamp) {
+    return timestamp < LEGACY_SECONDS_MAX ? timestamp * 1000 : timestamp;
+}
+
+/**
+ * Merge one sample into a bucket
+ * @param {Object|null} bucket - Current bucket value
+ * @param {Object} sample - Sample with temperature/humidity/light
+ * @returns {Object} Updated bucket
+ */
+function mergeSample(bucket, sample) {
+    const next = bucket || { count: 0 };
+    next.count = (next.count || 0) + 1;
+
+    METRICS.forEach(metric => {
+        const value = sample[metric];
+        const stats = next[metric];
+        if (!stats) {
+            next[metric] = { sum: value, min: value, max: value };
+        } else {
+            stats.sum += value;
+            stats.min = Math.min(stats.min, value);
+            stats.max = Math.max(stats.max, value);
+        }
+    });
+
+    return next;
+}
+
+/**
+ * Fold a sample into every rollup level
+ * Each bucket is updated in a transaction, so concurrent writers merge
+ * instead of overwriting each other
+ * @param {string} deviceId - Device identifier
+ * @param {Object} sample - { temperature, humidity, light, timestamp }
+ * @returns {Promise} Resolves when all levels are updated
+ */
+export function updateRollups(deviceId, sample) {
+    return Promise.all(ROLLUP_LEVELS.map(level => {
+        const bucketStart = Math.floor(sample.timestamp / level.bucketMs) * level.bucketMs;
+        const bucketRef = ref(db, `history/${deviceId}/rollups/${level.name}/${bucketStart}`);
+        return runTransaction(bucketRef, bucket => mergeSample(bucket, sample), { applyLocally: false });
+    }));
+}
+
+/**
+ * Pick the coarsest rollup level whose bucket is not wider than resolutionMs
+ * @param {number} resolutionMs - Requested spacing between points
+ * @returns {Object|null} Rollup level, or null when raw samples are needed
+ */
+export function pickRollupLevel(resolutionMs) {
+    let picked = null;
+    ROLLUP_LEVELS.forEach(level => {
+        if (level.bucketMs <= resolutionMs) {
+            picked = level;
+        }
+    });
+    return picked;
+}
+
+/**
+ * Convert a stored bucket into a history point
+ * @param {string} bucketStart - Bucket key (start time in ms)
+ * @param {Object} bucket - Stored bucket
+ * @param {number} bucketMs - Bucket width
+ * @returns {Object} Point with avg values and per-metric min/max
+ */
+function bucketToPoint(bucketStart, bucket, bucketMs) {
+    const point = {
+        timestamp: Number(bucketStart),
+        bucketMs: bucketMs,
+        count: bucket.count || 0
+    };
+
+    METRICS.forEach(metric => {
+        const stats = bucket[metric];
+        if (stats && point.count > 0) {
+            point[metric] = stats.sum / point.count;
+            point[`${metric}Min`] = stats.min;
+            point[`${metric}Max`] = stats.max;
+        }
+    });
+
+    return point;
+}
+
+/**
+ * Fetch raw records with a timestamp in [fromMs, toMs], in either unit
+ * Runs the ms range query and, for records stored before the switch to
+ * ms, the same range in seconds
+ * @param {string} deviceId - Device identifier
+ * @param {number} fromMs - Range start (ms)
+ * @param {number} toMs - Range end (ms)
+ * @param {boolean} legacyOnly - Skip the ms query
+ * @returns {Promise<Array>} Samples with ms timestamps, oldest first
+ */
+async function fetchRecords(deviceId, fromMs, toMs, legacyOnly = false) {
+    const recordsRef = ref(db, `history/${deviceId}/records`);
+    const ranges = [[Math.floor(fromMs / 1000), Math.min(Math.ceil(toMs / 1000), LEGACY_SECONDS_MAX - 1)]];
+    if (!legacyOnly) {
+        ranges.push([fromMs, toMs]);
+    }
+
+    const snapshots = await Promise.all(ranges.map(([from, to]) =>
+        get(query(recordsRef, orderByChild('timestamp'), startAt(from), endAt(to)))));
+
+    // An open range (fromMs 0) returns seconds records from both queries
+    const byKey = new Map();
+    snapshots.forEach(snapshot => snapshot.forEach(child => {
+        const entry = child.val();
+        const timestamp = toMillis(entry.timestamp);
+        if (timestamp >= fromMs && timestamp <= toMs) {
+            byKey.set(child.key, {
+                timestamp: timestamp,
+                temperature: parseFloat(entry.temperature) || 0,
+                humidity: parseFloat(entry.humidity) || 0,
+                light: parseInt(entry.light) || 0
+            });
+        }
+    }));
+
+    return [...byKey.values()].sort((a, b) => a.timestamp - b.timestamp);
+}
+
+/**
+ * Fetch sensor history for a time range at a requested resolution
+ * Raw samples are returned when resolutionMs is finer than the finest
+ * rollup, bucket averages (with min/max) otherwise. Records stored in
+ * seconds are read too; they predate the rollups, so their buckets are
+ * computed here
+ * @param {string} deviceId - Device identifier
+ * @param {number} fromTs - Range start (ms)
+ * @param {number} toTs - Range end (ms)
+ * @param {number} resolutionMs - Requested spacing between points
+ * @returns {Promise<Array>} Points sorted by timestamp (oldest first)
+ */
+export async function fetchHistory(deviceId, fromTs, toTs, resolutionMs) {
+    if (!db) {
+        throw new Error('Firebase not initialized');
+    }
+
+    const level = pickRollupLevel(resolutionMs);
+
+    if (!level) {
+        return fetchRecords(deviceId, fromTs, toTs);
+    }
+
+    // Bucket keys are 13-digit ms timestamps, so key order is time order
+    const firstBucket = Math.floor(fromTs / level.bucketMs) * level.bucketMs;
+    const rollupQuery = query(
+        ref(db, `history/${deviceId}/rollups/${level.name}`),
+        orderByKey(),
+        startAt(String(firstBucket)),
+        endAt(String(toTs))
+    );
+    const [snapshot, legacy] = await Promise.all([
+        get(rollupQuery),
+        fetchRecords(deviceId, fromTs, toTs, true)
+    ]);
+
+    const buckets = new Map();
+    snapshot.forEach(child => {
+        buckets.set(Number(child.key), child.val());
+    });
+    legacy.forEach(sample => {
+        const bucketStart = Math.floor(sample.timestamp / level.bucketMs) * level.bucketMs;
+        buckets.set(bucketStart, mergeSample(buckets.get(bucketStart) || null, sample));
+    });
+
+    const points = [...buckets.entries()]
+        .sort((a, b) => a[0] - b[0])
+        .map(([bucketStart, bucket]) => bucketToPoint(bucketStart, bucket, level.bucketMs));
+
+    console.log(`[History] ${deviceId}: ${points.length} ${level.name} buckets`);
+    return points;
+}
@@ -13,13 +13,14 @@ import { ref, get } from "https://www.gstatic.com/firebasejs/10.7.1/firebase-dat
 import { initializeMQTTClient, subscribeToDevice, sendMQTTCommand } from './mqtt/mqtt-client.js';
 import { handleMQTTMessage, handleMQTTConnect, handleMQTTConnectionLost, getMQTTCachedState } from './mqtt/mqtt-handlers.js';
 import { startPingService, stopPingService, performInitialPing } from './mqtt/ping-service.js';
+import { startMirrorLease, stopMirrorLease } from './mqtt/mirror-lease.js';
 
 // Device modules
 import { initializeDeviceManager, addDevice, updateDevice, deleteDevice, getAllDevices, setViewType } from './devices/device-manager.js';
 import { getAllDevicesData, getDeviceData, isDeviceOnline, initializeDevicesOffline, disableMqttOnlineControl, enableMqttOnlineControl } from './devices/device-card.js';
 
 // Chart modules
-import { initializeChart, switchChartType, cleanupChart } from './charts/chart-manager.js';
+import { initializeChart, switchChartType, setChartRange, cleanupChart } from './charts/chart-manager.js';
 
 // UI modules
 import {
@@ -118,6 +119,7 @@ function initializeLogoutButton() {
     if (logoutBtn) {
         logoutBtn.addEventListener('click', async () => {
             try {
+                await stopMirrorLease();
                 await logout();
                 window.location.href = 'login.html';
             } catch (error) {
@@ -186,6 +188,9 @@ function initializeMQTT() {
         }, 500); // Small delay to ensure subscriptions are ready
     };
 
+    // Elect one tab per device to mirror MQTT into Firebase
+    startMirrorLease();
+
     initializeMQTTClient(onConnect, handleMQTTMessage, handleMQTTConnectionLost);
 }
 
@@ -528,6 +533,9 @@ function exposeGlobalFunctions() {
 
         showModal('report-detail');
 
+        const rangeSelect = document.getElementById('chart-range');
+        if (rangeSelect) rangeSelect.value = 'live';
+
         // Initialize chart with temp as default
         initializeChart(deviceId, 'temp');
     };
@@ -542,6 +550,10 @@ function exposeGlobalFunctions() {
         switchChartType(type);
     };
 
+    window.selectChartRange = (range) => {
+        setChartRange(range);
+    };
+
     window.toggleFeature = (feature) => {
         const deviceId = window.currentDetailDeviceId;
         if (!deviceId) {
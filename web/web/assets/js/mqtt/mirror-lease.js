@@ -0,0 +1,214 @@
+/**
+ * mirror-lease.js
+ * Single-writer election for MQTT-to-Firebase mirroring
+ * Each device has a lease node in /bridge/leases/{deviceId}. Only the tab
+ * holding an unexpired lease writes that device's MQTT traffic to Firebase;
+ * every other tab stays read-only and takes over once the lease expires
+ */
+
+import { db } from '../core/firebase-config.js';
+import {
+    ref,
+    onValue,
+    runTransaction,
+    onDisconnect
+} from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
+
+// Lease configuration
+export const LEASE_CONFIG = {
+    TTL: 15000,             // Lease lifetime without renewal
+    RENEW_INTERVAL: 5000,   // Heartbeat: renew held leases, retry expired ones
+    PATH: 'bridge/leases'
+};
+
+// Identifies this tab as lease owner
+const tabId = `tab_${Date.now().toString(36)}_${Math.random().toString(36).slice(2, 8)}`;
+
+// deviceId -> { held, owner, expires, pending }
+const leases = {};
+
+let serverTimeOffset = 0;
+let offsetUnsubscribe = null;
+let heartbeatId = null;
+
+/**
+ * Current time on the Firebase server clock
+ * Leases compare expiry across tabs, so local clock skew must not matter
+ * @returns {number} Milliseconds since epoch
+ */
+function serverNow() {
+    return Date.now() + serverTimeOffset;
+}
+
+/**
+ * Get or create the local lease record of a device
+ * @param {string} deviceId - Device identifier
+ * @returns {Object} Lease record
+ */
+function getLease(deviceId) {
+    if (!leases[deviceId]) {
+        leases[deviceId] = { held: false, owner: null, expires: 0, pending: null };
+    }
+    return leases[deviceId];
+}
+
+/**
+ * Acquire or renew the lease of a device
+ * Succeeds when the lease is free, expired or already ours
+ * @param {string} deviceId - Device identifier
+ * @returns {Promise<boolean>} True when this tab holds the lease
+ */
+function acquireLease(deviceId) {
+    const lease = getLease(deviceId);
+
+    // One transaction per device at a time
+    if (lease.pending) return lease.pending;
+
+    const leaseRef = ref(db, `${LEASE_CONFIG.PATH}/${deviceId}`);
+    const now = serverNow();
+    const expires = now + LEASE_CONFIG.TTL;
+
+    lease.pending = runTransaction(leaseRef, (current) => {
+        if (current && current.owner !== tabId && current.expires > now) {
+            return; // Held by another tab, abort
+        }
+        return { owner: tabId, expires: expires };
+    }, { applyLocally: false })
+        .then((result) => {
+            const wasHeld = lease.held;
+            const value = result.snapshot.val();
+
+            lease.held = result.committed;
+            lease.owner = value ? value.owner : null;
+            lease.expires = value ? value.expires : 0;
+
+            if (lease.held && !wasHeld) {
+                // Free the lease right away if this tab drops off
+                onDisconnect(leaseRef).remove();
+                console.log(`[MirrorLease] Mirroring ${deviceId}`);
+            } else if (!lease.held && wasHeld) {
+                onDisconnect(leaseRef).cancel();
+                console.log(`[MirrorLease] Lost ${deviceId} to ${lease.owner}`);
+            }
+
+            return lease.held;
+        })
+        .catch((error) => {
+            console.error(`[MirrorLease] Lease error for ${deviceId}:`, error);
+            lease.held = false;
+            return false;
+        })
+        .finally(() => {
+            lease.pending = null;
+        });
+
+    return lease.pending;
+}
+
+/**
+ * Release a held lease
+ * @param {string} deviceId - Device identifier
+ * @returns {Promise} Resolves when released
+ */
+function releaseLease(deviceId) {
+    const lease = getLease(deviceId);
+    if (!lease.held) return Promise.resolve();
+
+    lease.held = false;
+    const leaseRef = ref(db, `${LEASE_CONFIG.PATH}/${deviceId}`);
+
+    onDisconnect(leaseRef).cancel();
+    return runTransaction(leaseRef, (current) => {
+        if (current && current.owner !== tabId) {
+            return; // Already taken over
+        }
+        return null;
+    }).catch((error) => {
+        console.error(`[MirrorLease] Release error for ${deviceId}:`, error);
+    });
+}
+
+/**
+ * Renew held leases and retry expired ones
+ */
+function heartbeat() {
+    const now = serverNow();
+
+    Object.keys(leases).forEach((deviceId) => {
+        const lease = leases[deviceId];
+        if (lease.held || lease.expires <= now) {
+            acquireLease(deviceId);
+        }
+    });
+}
+
+/**
+ * Check whether this tab should mirror a device
+ * Followers answer from the cached lease and only contact Firebase once
+ * the leader's lease has expired, so they add no writes per message
+ * @param {string} deviceId - Device identifier
+ * @returns {Promise<boolean>} True when this tab is the device's writer
+ */
+export async function isMirrorLeader(deviceId) {
+    if (!db) return false;
+
+    const lease = getLease(deviceId);
+    const now = serverNow();
+
+    // Stop writing as soon as our own lease may have run out, even if a
+    // throttled background tab missed its renewal
+    if (lease.held && lease.expires > now) return true;
+    if (!lease.held && lease.owner && lease.expires > now) return false;
+
+    return acquireLease(deviceId);
+}
+
+/**
+ * Start lease heartbeat and server clock tracking
+ */
+export function startMirrorLease() {
+    if (!db || heartbeatId) return;
+
+    offsetUnsubscribe = onValue(ref(db, '.info/serverTimeOffset'), (snapshot) => {
+        serverTimeOffset = snapshot.val() || 0;
+    });
+
+    heartbeatId = setInterval(heartbeat, LEASE_CONFIG.RENEW_INTERVAL);
+    window.addEventListener('pagehide', stopMirrorLease);
+
+    console.log(`[MirrorLease] Started as ${tabId}`);
+}
+
+/**
+ * Stop heartbeat and release all held leases
+ * @returns {Promise} Resolves when leases are released
+ */
+export function stopMirrorLease() {
+    if (heartbeatId) {
+        clearInterval(heartbeatId);
+        heartbeatId = null;
+    }
+
+    if (offsetUnsubscribe) {
+        offsetUnsubscribe();
+        offsetUnsubscribe = null;
+    }
+
+    window.removeEventListener('pagehide', stopMirrorLease);
+
+    const releases = Object.keys(leases).map(releaseLease);
+    return Promise.all(releases);
+}
+
+/**
+ * Get lease state of all devices seen by this tab
+ * @returns {Object} deviceId -> { leader, owner, expires }
+ */
+export function getMirrorLeaseState() {
+    const state = {};
+    Object.keys(leases).forEach((deviceId) => {
+        const lease = leases[deviceId];
+        state[deviceId] = { leader: lease.held, owner: lease.owner, expires: lease.expires };
+    });
+    return { tabId, leases: state };
+}
@@ -2,10 +2,13 @@
  * mqtt-to-firebase.js
  * Synchronizes MQTT data to Firebase Realtime Database
  * Ensures data persistence and consistency between MQTT and Firebase
+ * Only the tab holding a device's mirror lease writes, see mirror-lease.js
  */
 
 import { db } from '../core/firebase-config.js';
 import { ref, set, update, push } from "https://www.gstatic.com/firebasejs/10.7.1/firebase-database.js";
+import { toMillis, updateRollups } from '../history/history-rollup.js';
+import { isMirrorLeader } from './mirror-lease.js';
 
 /**
  * Sync sensor data from MQTT to Firebase
@@ -22,8 +25,17 @@ export async function syncSensorDataToFirebase(deviceId, sensorData) {
         return;
     }
 
+    // Another tab is mirroring this device
+    if (!(await isMirrorLeader(deviceId))) return;
+
     try {
-        const timestamp = sensorData.timestamp || Date.now();
+        const timestamp = toMillis(sensorData.timestamp || Date.now());
+        const sample = {
+            temperature: parseFloat(sensorData.temperature || 0),
+            humidity: parseFloat(sensorData.humidity || 0),
+            light: parseInt(sensorData.light || 0),
+            timestamp: timestamp
+        };
 
         // 1. Update current device sensors in /devices/{deviceId}/sensors
         const deviceSensorsRef = ref(db, `devices/${deviceId}/sensors`);
@@ -37,14 +49,12 @@ export async function syncSensorDataToFirebase(deviceId, sensorData) {
         // 2. Store historical data in /history/{deviceId}/records
         const historyRef = ref(db, `history/${deviceId}/records`);
         const newRecordRef = push(historyRef);
-        await set(newRecordRef, {
-            temperature: parseFloat(sensorData.temperature || 0),
-            humidity: parseFloat(sensorData.humidity || 0),
-            light: parseInt(sensorData.light || 0),
-            timestamp: timestamp
-        });
+        await set(newRecordRef, sample);
 
-        // 3. Update SmartHome/{deviceId}/data (mirror MQTT structure)
+        // 3. Fold into 1m/15m/1h rollups in /history/{deviceId}/rollups
+        await updateRollups(deviceId, sample);
+
+        // 4. Update SmartHome/{deviceId}/data (mirror MQTT structure)
         const smartHomeDataRef = ref(db, `SmartHome/${deviceId}/data`);
         await set(smartHomeDataRef, {
             temperature: parseFloat(sensorData.temperature || 0),
@@ -75,6 +85,9 @@ export async function syncStateToFirebase(deviceId, stateData) {
         return;
     }
 
+    // Another tab is mirroring this device
+    if (!(await isMirrorLeader(deviceId))) return;
+
     try {
         const timestamp = Date.now();
 
@@ -129,6 +142,9 @@ export async function syncInfoToFirebase(deviceId, infoData) {
         return;
     }
 
+    // Another tab is mirroring this device
+    if (!(await isMirrorLeader(deviceId))) return;
+
     try {
         const timestamp = Date.now();
 